@@ -70,6 +70,12 @@ enum class StatusCode {
   kNoDoublePrecision         = -2044, // Double precision (64-bits) not supported by the device
   kInvalidVectorDot          = -2043, // Vector dot is not a valid OpenCL buffer
   kInsufficientMemoryDot     = -2042, // Vector dot's OpenCL buffer is too small
+  kInvalidHandle             = -2041, // Handle is not a valid CLBlast handle (see CreateHandle)
+  kInsufficientMemoryBlob    = -2040, // Buffer for the cache blob is too small (see ExportCache)
+  kInsufficientMemoryTemp    = -2039, // Workspace for the temporary buffers is too small
+  kInvalidBatchCount         = -2038, // The batch count needs to be positive
+  kInvalidGroupBuffer        = -2037, // Per-problem argument buffer is invalid or too small
+  kInvalidEpilogueBuffer     = -2036, // Bias or scale vector of the epilogue is invalid or too small
 };
 
 // Matrix layout and transpose types
@@ -78,11 +84,17 @@ enum class Transpose { kNo = 111, kYes = 112, kConjugate = 113 };
 enum class Triangle { kUpper = 121, kLower = 122 };
 enum class Diagonal { kNonUnit = 131, kUnit = 132 };
 enum class Side { kLeft = 141, kRight = 142 };
+enum class Bias { kNoBias = 151, kRowBias = 152, kColumnBias = 153 };
+enum class Activation { kIdentity = 161, kRelu = 162, kGelu = 163 };
 
 // Precision scoped enum (values in bits)
 enum class Precision { kHalf = 16, kSingle = 32, kDouble = 64,
                        kComplexSingle = 3232, kComplexDouble = 6464 };
 
+// Opaque handle which binds CLBlast to an OpenCL command queue (see 'CreateHandle' below)
+struct HandleImpl;
+using Handle = HandleImpl*;
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 // =================================================================================================
@@ -121,28 +133,28 @@ StatusCode Rotm(const size_t n,
                 cl_mem sparam_buffer, const size_t sparam_offset,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
-// Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP
+// Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
 template <typename T>
 StatusCode Swap(const size_t n,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
-// Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL
+// Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
 template <typename T>
 StatusCode Scal(const size_t n,
                 const T alpha,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
-// Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY
+// Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
 template <typename T>
 StatusCode Copy(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
-// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY
+// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
 template <typename T>
 StatusCode Axpy(const size_t n,
                 const T alpha,
@@ -150,7 +162,7 @@ StatusCode Axpy(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
-// Dot product of two vectors: SDOT/DDOT
+// Dot product of two vectors: SDOT/DDOT/HDOT
 template <typename T>
 StatusCode Dot(const size_t n,
                cl_mem dot_buffer, const size_t dot_offset,
@@ -220,7 +232,7 @@ StatusCode Min(const size_t n,
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
 
-// General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV
+// General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
 template <typename T>
 StatusCode Gemv(const Layout layout, const Transpose a_transpose,
                 const size_t m, const size_t n,
@@ -356,7 +368,7 @@ StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
-// General rank-1 matrix update: SGER/DGER
+// General rank-1 matrix update: SGER/DGER/HGER
 template <typename T>
 StatusCode Ger(const Layout layout,
                const size_t m, const size_t n,
@@ -466,7 +478,7 @@ StatusCode Spr2(const Layout layout, const Triangle triangle,
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
 template <typename T>
 StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                 const size_t m, const size_t n, const size_t k,
@@ -559,6 +571,303 @@ StatusCode Trsm(const Layout layout, const Side side, const Triangle triangle, c
                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
+// =================================================================================================
+// Extra non-BLAS routines (level-X)
+// =================================================================================================
+
+// Strided-batched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED
+template <typename T>
+StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const T beta,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+// Handle-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================
+
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+template <typename T>
+StatusCode Gemm(Handle handle,
+                const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event = nullptr);
+
+// Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
+template <typename T>
+StatusCode Symm(Handle handle,
+                const Layout layout, const Side side, const Triangle triangle,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event = nullptr);
+
+// Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
+template <typename T>
+StatusCode Hemm(Handle handle,
+                const Layout layout, const Side side, const Triangle triangle,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event = nullptr);
+
+// Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK
+template <typename T>
+StatusCode Syrk(Handle handle,
+                const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event = nullptr);
+
+// Rank-K update of a hermitian matrix: CHERK/ZHERK
+template <typename T>
+StatusCode Herk(Handle handle,
+                const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event = nullptr);
+
+// Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K
+template <typename T>
+StatusCode Syr2k(Handle handle,
+                 const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                 const size_t n, const size_t k,
+                 const T alpha,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const T beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_event* event = nullptr);
+
+// Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
+template <typename T, typename U>
+StatusCode Her2k(Handle handle,
+                 const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                 const size_t n, const size_t k,
+                 const T alpha,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const U beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_event* event = nullptr);
+
+// Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM
+template <typename T>
+StatusCode Trmm(Handle handle,
+                const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                cl_event* event = nullptr);
+
+// =================================================================================================
+// Workspace-size queries and workspace-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================
+
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+template <typename T>
+StatusCode GemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             cl_command_queue* queue, size_t* workspace_size);
+template <typename T>
+StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
+template <typename T>
+StatusCode SymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                             const size_t m, const size_t n,
+                             cl_command_queue* queue, size_t* workspace_size);
+template <typename T>
+StatusCode Symm(const Layout layout, const Side side, const Triangle triangle,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
+template <typename T>
+StatusCode HemmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                             const size_t m, const size_t n,
+                             cl_command_queue* queue, size_t* workspace_size);
+template <typename T>
+StatusCode Hemm(const Layout layout, const Side side, const Triangle triangle,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK
+template <typename T>
+StatusCode SyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                             const size_t n, const size_t k,
+                             cl_command_queue* queue, size_t* workspace_size);
+template <typename T>
+StatusCode Syrk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// Rank-K update of a hermitian matrix: CHERK/ZHERK
+template <typename T>
+StatusCode HerkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                             const size_t n, const size_t k,
+                             cl_command_queue* queue, size_t* workspace_size);
+template <typename T>
+StatusCode Herk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K
+template <typename T>
+StatusCode Syr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                              const size_t n, const size_t k,
+                              cl_command_queue* queue, size_t* workspace_size);
+template <typename T>
+StatusCode Syr2k(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                 const size_t n, const size_t k,
+                 const T alpha,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const T beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_mem workspace, const size_t workspace_size,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
+template <typename T, typename U>
+StatusCode Her2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                              const size_t n, const size_t k,
+                              cl_command_queue* queue, size_t* workspace_size);
+template <typename T, typename U>
+StatusCode Her2k(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                 const size_t n, const size_t k,
+                 const T alpha,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const U beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_mem workspace, const size_t workspace_size,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM
+template <typename T>
+StatusCode TrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                             const size_t m, const size_t n,
+                             cl_command_queue* queue, size_t* workspace_size);
+template <typename T>
+StatusCode Trmm(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Grouped version of GEMM: computes a group of 'group_count' problems of different sizes. These are
+// described in device memory by 'problems_buffer', holding 9 integers (cl_int) per problem: m, n,
+// k, a_offset, a_ld, b_offset, b_ld, c_offset, and c_ld. The scalars are given per problem as well,
+// in 'alphas_buffer' and 'betas_buffer'. All matrices of the group are stored in 'a_buffer',
+// 'b_buffer', and 'c_buffer'. Since the sizes are only known on the device, the matrices can not be
+// tested for validity: the caller has to make sure they fit in their buffers.
+template <typename T>
+StatusCode GemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t group_count, const cl_mem problems_buffer,
+                              const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                              const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// Mixed-precision version of GEMM: matrices A and B are stored in half-precision (cl_half), whereas
+// matrix C and the scalars are in single-precision. The products are accumulated in single-
+// precision as well. The device doesn't need to support half-precision arithmetic (cl_khr_fp16).
+StatusCode GemmMixed(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                     const size_t m, const size_t n, const size_t k,
+                     const float alpha,
+                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                     const float beta,
+                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                     cl_command_queue* queue, cl_event* event = nullptr);
+
+// Converts a vector of single-precision values on the device into half-precision (rounding to the
+// nearest even value) or vice-versa, e.g. to prepare the inputs of 'GemmMixed'
+StatusCode ConvertFloatToHalf(const size_t n,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+StatusCode ConvertHalfToFloat(const size_t n,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// GEMM with an epilogue applied when storing the result, i.e. without additional passes over C:
+// C[i][j] = row_scale[i] * col_scale[j] * activation(alpha*A*B + beta*C + bias)[i][j]. The bias
+// vector holds one value per row of C ('kRowBias', m values) or per column ('kColumnBias', n
+// values). The scale vectors hold m and n values: passing a null-pointer skips the scaling. The
+// activation is either the identity, ReLU, or GELU (tanh approximation). Real precisions only.
+template <typename T>
+StatusCode GemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        const Bias bias, const cl_mem bias_buffer, const size_t bias_offset,
+                        const Activation activation,
+                        const cl_mem row_scale_buffer, const size_t row_scale_offset,
+                        const cl_mem col_scale_buffer, const size_t col_scale_offset,
+                        cl_command_queue* queue, cl_event* event = nullptr);
+
 // =================================================================================================
 
 // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
@@ -569,6 +878,118 @@ StatusCode ClearCache();
 // Further CLBlast routine calls will then run at maximum speed.
 StatusCode FillCache(const cl_device_id device);
 
+// As above, but only for a selection of routines, given as a comma-separated list of names with a
+// precision prefix (e.g. "SGEMM,DGEMV,CHERK"). A null-pointer selects all routines. The kernels are
+// compiled concurrently by 'num_threads' host threads; zero selects the number of hardware threads.
+StatusCode FillCache(const cl_device_id device, const char* routines, const size_t num_threads);
+
+// Non-blocking variant of the above: returns immediately and fills the cache in the background. A
+// routine call which needs a kernel that is still being compiled waits only for that kernel.
+StatusCode FillCacheAsync(const cl_device_id device, const char* routines,
+                          const size_t num_threads);
+
+// Compiled binaries can also be stored persistently on disk, such that they can be re-used across
+// process restarts. This sets the directory of that on-disk cache. Passing an empty string or a
+// null-pointer disables it. By default, the 'CLBLAST_CACHE_DIR' environmental variable is used.
+StatusCode SetCacheDirectory(const char* directory);
+
+// The cache is bounded: when the total size of the binaries or the number of programs exceeds its
+// limit, the least-recently-used entries are evicted. Zero means no limit. The defaults are 512MB
+// of binaries and 4096 programs.
+StatusCode SetCacheLimits(const size_t max_binary_bytes, const size_t max_programs);
+
+// Cached programs keep their OpenCL context alive. Applications which create and release many
+// contexts should therefore remove a context's programs from the cache before releasing it.
+StatusCode ClearCacheForContext(const cl_context context);
+
+// Statistics about the usage of the cache, retrieved through 'GetCacheStatistics'
+struct CacheStatistics {
+  size_t program_hits;        // Programs found in the cache
+  size_t program_misses;      // Programs which had to be created from a binary or from source
+  size_t compilations;        // Programs compiled from source
+  double compilation_time_ms; // Total time spent compiling from source
+  size_t num_binaries;        // Binaries currently held
+  size_t binary_bytes;        // Total size of the binaries currently held
+  size_t num_programs;        // Programs currently held
+  size_t evictions;           // Entries evicted because of the limits
+};
+StatusCode GetCacheStatistics(CacheStatistics* statistics);
+
+// The binaries in the cache for a specific device can be exported as a single blob, such that they
+// can be compiled once and shipped to other machines with the same device and driver. If 'blob' is
+// a null-pointer (or 'blob_size' is too small), only the required size is returned in 'blob_size'.
+StatusCode ExportCache(const cl_device_id device, char* blob, size_t* blob_size);
+
+// Adds the binaries of an exported blob to the cache. Entries for another device (name) or driver
+// version are ignored. An invalid or corrupt blob is rejected as a whole.
+StatusCode ImportCache(const cl_device_id device, const char* blob, const size_t blob_size);
+
+// =================================================================================================
+
+// The built-in tuning parameters can be overridden at run-time by the JSON output files of the
+// tuners (e.g. 'clblast_xgemm_32.json'), such that newly tuned devices don't require a re-build of
+// the library. The path is either a single file or a directory with the tuner output files. Invalid
+// or incomplete files are ignored, in which case the built-in parameters are used. Passing an empty
+// string or a null-pointer disables this. By default, the 'CLBLAST_TUNING_PATH' environmental
+// variable is used.
+StatusCode SetTuningParametersPath(const char* path);
+
+// =================================================================================================
+
+// Temporary device buffers (e.g. padded copies of matrices) are taken from a pool, such that they
+// are re-used across routine calls. An idle buffer is only re-used on the in-order queue it was
+// last used on. This limits the total size of the idle buffers (256MB by default), releasing the
+// least-recently-used ones when exceeded. A limit of zero disables the pool.
+StatusCode SetBufferPoolLimit(const size_t max_idle_bytes);
+
+// Releases the idle buffers of a specific context, or of all contexts in case of a null-pointer.
+// Idle buffers keep their OpenCL context alive, so this should be called before releasing it.
+StatusCode ClearBufferPool(const cl_context context);
+
+// Statistics about the usage of the buffer pool, retrieved through 'GetBufferPoolStatistics'
+struct BufferPoolStatistics {
+  size_t allocations;  // Buffers newly allocated
+  size_t reuses;       // Buffers re-used from the pool instead of allocated
+  size_t releases;     // Idle buffers released because of the limit or because of clearing
+  size_t bytes_in_use; // Total size of the buffers currently in use by routines
+  size_t num_idle;     // Idle buffers currently held by the pool
+  size_t idle_bytes;   // Total size of the idle buffers currently held by the pool
+};
+StatusCode GetBufferPoolStatistics(BufferPoolStatistics* statistics);
+
+// Sets a memory budget for the temporary buffers of a single routine call on a specific context.
+// GEMM-based routines whose temporary matrices would exceed it compute the result in blocks instead,
+// which is slower but needs less memory. Zero removes the budget, which is also the default.
+StatusCode SetMemoryBudget(const cl_context context, const size_t max_bytes);
+
+// Sets the accuracy mode of the GEMM routines. In the fast mode, large complex problems are
+// computed with the 3M algorithm: three real matrix-multiplications instead of four, which is
+// faster but less accurate, since the imaginary parts suffer from cancellation. Very large problems
+// are also computed with the Strassen-Winograd recursion (see below). The default is the precise
+// mode.
+enum class GemmAccuracy { kPrecise = 171, kFast = 172 };
+StatusCode SetGemmAccuracy(const GemmAccuracy accuracy);
+
+// Sets the maximum number of levels of the Strassen-Winograd recursion used in the fast accuracy
+// mode. Each level splits the matrices into quadrants and computes 7 instead of 8 products of them,
+// at the cost of accuracy and temporary memory. The depth is also limited by the memory budget (if
+// any) or by half the device memory. The default is 2, zero disables the recursion.
+StatusCode SetGemmStrassenDepth(const size_t max_depth);
+
+// =================================================================================================
+
+// Creates a handle bound to an OpenCL command queue. The handle-based variants of the routines
+// (e.g. 'Gemm(handle, ...)') keep their routine objects alive within the handle, such that the
+// tuning parameters, device properties, and compiled program are only retrieved on first use.
+// This reduces the host overhead for small problem sizes. A handle should not be used by multiple
+// host threads at the same time. The queue should remain valid until the handle is released.
+// Changing the tuning parameters (see 'SetTuningParametersPath') or clearing the cache discards
+// the routine objects of all handles, which are then set-up again on their next use.
+StatusCode CreateHandle(cl_command_queue* queue, Handle* handle);
+
+// Releases a handle created with 'CreateHandle'
+StatusCode ReleaseHandle(Handle handle);
+
 // =================================================================================================
 
 } // namespace clblast
@@ -79,6 +79,12 @@ typedef enum StatusCode_ {
   kNoDoublePrecision         = -2044, // Double precision (64-bits) not supported by the device
   kInvalidVectorDot          = -2043, // Vector dot is not a valid OpenCL buffer
   kInsufficientMemoryDot     = -2042, // Vector dot's OpenCL buffer is too small
+  kInvalidHandle             = -2041, // Handle is not a valid CLBlast handle (see CreateHandle)
+  kInsufficientMemoryBlob    = -2040, // Buffer for the cache blob is too small (see ExportCache)
+  kInsufficientMemoryTemp    = -2039, // Workspace for the temporary buffers is too small
+  kInvalidBatchCount         = -2038, // The batch count needs to be positive
+  kInvalidGroupBuffer        = -2037, // Per-problem argument buffer is invalid or too small
+  kInvalidEpilogueBuffer     = -2036, // Bias or scale vector of the epilogue is invalid or too small
 } StatusCode;
 
 // Matrix layout and transpose types
@@ -87,11 +93,16 @@ typedef enum Transpose_ { kNo = 111, kYes = 112, kConjugate = 113 } Transpose;
 typedef enum Triangle_ { kUpper = 121, kLower = 122 } Triangle;
 typedef enum Diagonal_ { kNonUnit = 131, kUnit = 132 } Diagonal;
 typedef enum Side_ { kLeft = 141, kRight = 142 } Side;
+typedef enum Bias_ { kNoBias = 151, kRowBias = 152, kColumnBias = 153 } Bias;
+typedef enum Activation_ { kIdentity = 161, kRelu = 162, kGelu = 163 } Activation;
 
 // Precision scoped enum (values in bits)
 typedef enum Precision_ { kHalf = 16, kSingle = 32, kDouble = 64,
                           kComplexSingle = 3232, kComplexDouble = 6464 } Precision;
 
+// Opaque handle which binds CLBlast to an OpenCL command queue (see 'CLBlastCreateHandle' below)
+typedef struct CLBlastHandleImpl* CLBlastHandle;
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 // =================================================================================================
@@ -148,7 +159,7 @@ StatusCode PUBLIC_API CLBlastDrotm(const size_t n,
                                    cl_mem sparam_buffer, const size_t sparam_offset,
                                    cl_command_queue* queue, cl_event* event);
 
-// Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP
+// Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
 StatusCode PUBLIC_API CLBlastSswap(const size_t n,
                                    cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
@@ -165,8 +176,12 @@ StatusCode PUBLIC_API CLBlastZswap(const size_t n,
                                    cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                    cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHswap(const size_t n,
+                                   cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event);
 
-// Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL
+// Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
 StatusCode PUBLIC_API CLBlastSscal(const size_t n,
                                    const float alpha,
                                    cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -183,8 +198,12 @@ StatusCode PUBLIC_API CLBlastZscal(const size_t n,
                                    const cl_double2 alpha,
                                    cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                    cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHscal(const size_t n,
+                                   const cl_half alpha,
+                                   cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_command_queue* queue, cl_event* event);
 
-// Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY
+// Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
 StatusCode PUBLIC_API CLBlastScopy(const size_t n,
                                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
@@ -201,8 +220,12 @@ StatusCode PUBLIC_API CLBlastZcopy(const size_t n,
                                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                    cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHcopy(const size_t n,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event);
 
-// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY
+// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
 StatusCode PUBLIC_API CLBlastSaxpy(const size_t n,
                                    const float alpha,
                                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -223,8 +246,13 @@ StatusCode PUBLIC_API CLBlastZaxpy(const size_t n,
                                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                    cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHaxpy(const size_t n,
+                                   const cl_half alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event);
 
-// Dot product of two vectors: SDOT/DDOT
+// Dot product of two vectors: SDOT/DDOT/HDOT
 StatusCode PUBLIC_API CLBlastSdot(const size_t n,
                                   cl_mem dot_buffer, const size_t dot_offset,
                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -235,6 +263,11 @@ StatusCode PUBLIC_API CLBlastDdot(const size_t n,
                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                   const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                   cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHdot(const size_t n,
+                                  cl_mem dot_buffer, const size_t dot_offset,
+                                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                  cl_command_queue* queue, cl_event* event);
 
 // Dot product of two complex vectors: CDOTU/ZDOTU
 StatusCode PUBLIC_API CLBlastCdotu(const size_t n,
@@ -372,7 +405,7 @@ StatusCode PUBLIC_API CLBlastiZmin(const size_t n,
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
 
-// General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV
+// General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
 StatusCode PUBLIC_API CLBlastSgemv(const Layout layout, const Transpose a_transpose,
                                    const size_t m, const size_t n,
                                    const float alpha,
@@ -405,6 +438,14 @@ StatusCode PUBLIC_API CLBlastZgemv(const Layout layout, const Transpose a_transp
                                    const cl_double2 beta,
                                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                    cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHgemv(const Layout layout, const Transpose a_transpose,
+                                   const size_t m, const size_t n,
+                                   const cl_half alpha,
+                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   const cl_half beta,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event);
 
 // General banded matrix-vector multiplication: SGBMV/DGBMV/CGBMV/ZGBMV
 StatusCode PUBLIC_API CLBlastSgbmv(const Layout layout, const Transpose a_transpose,
@@ -680,7 +721,7 @@ StatusCode PUBLIC_API CLBlastZtpsv(const Layout layout, const Triangle triangle,
                                    cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                    cl_command_queue* queue, cl_event* event);
 
-// General rank-1 matrix update: SGER/DGER
+// General rank-1 matrix update: SGER/DGER/HGER
 StatusCode PUBLIC_API CLBlastSger(const Layout layout,
                                   const size_t m, const size_t n,
                                   const float alpha,
@@ -695,6 +736,13 @@ StatusCode PUBLIC_API CLBlastDger(const Layout layout,
                                   const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                   cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                                   cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHger(const Layout layout,
+                                  const size_t m, const size_t n,
+                                  const cl_half alpha,
+                                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                  const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                  cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  cl_command_queue* queue, cl_event* event);
 
 // General rank-1 complex matrix update: CGERU/ZGERU
 StatusCode PUBLIC_API CLBlastCgeru(const Layout layout,
@@ -852,7 +900,7 @@ StatusCode PUBLIC_API CLBlastDspr2(const Layout layout, const Triangle triangle,
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
 StatusCode PUBLIC_API CLBlastSgemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                                    const size_t m, const size_t n, const size_t k,
                                    const float alpha,
@@ -885,6 +933,14 @@ StatusCode PUBLIC_API CLBlastZgemm(const Layout layout, const Transpose a_transp
                                    const cl_double2 beta,
                                    cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                                    cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHgemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                   const size_t m, const size_t n, const size_t k,
+                                   const cl_half alpha,
+                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const cl_half beta,
+                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                   cl_command_queue* queue, cl_event* event);
 
 // Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
 StatusCode PUBLIC_API CLBlastSsymm(const Layout layout, const Side side, const Triangle triangle,
@@ -1088,6 +1144,711 @@ StatusCode PUBLIC_API CLBlastZtrsm(const Layout layout, const Side side, const T
                                    cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                                    cl_command_queue* queue, cl_event* event);
 
+// =================================================================================================
+// Extra non-BLAS routines (level-X)
+// =================================================================================================
+
+// Strided-batched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED
+StatusCode PUBLIC_API CLBlastSgemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                 const size_t m, const size_t n, const size_t k,
+                                                 const float alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const float beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastDgemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                 const size_t m, const size_t n, const size_t k,
+                                                 const double alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const double beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastCgemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                 const size_t m, const size_t n, const size_t k,
+                                                 const cl_float2 alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const cl_float2 beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZgemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                 const size_t m, const size_t n, const size_t k,
+                                                 const cl_double2 alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                                 const cl_double2 beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+// Handle-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================
+
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+StatusCode PUBLIC_API CLBlastSgemmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastDgemmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastCgemmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastZgemmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastHgemmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_half beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+
+// Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
+StatusCode PUBLIC_API CLBlastSsymmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastDsymmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastCsymmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastZsymmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+
+// Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
+StatusCode PUBLIC_API CLBlastChemmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastZhemmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+
+// Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK
+StatusCode PUBLIC_API CLBlastSsyrkWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastDsyrkWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastCsyrkWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastZsyrkWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+
+// Rank-K update of a hermitian matrix: CHERK/ZHERK
+StatusCode PUBLIC_API CLBlastCherkWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastZherkWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                             const size_t n, const size_t k,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_event* event);
+
+// Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K
+StatusCode PUBLIC_API CLBlastSsyr2kWithHandle(CLBlastHandle handle,
+                                              const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                              const size_t n, const size_t k,
+                                              const float alpha,
+                                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                              const float beta,
+                                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                              cl_event* event);
+StatusCode PUBLIC_API CLBlastDsyr2kWithHandle(CLBlastHandle handle,
+                                              const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                              const size_t n, const size_t k,
+                                              const double alpha,
+                                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                              const double beta,
+                                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                              cl_event* event);
+StatusCode PUBLIC_API CLBlastCsyr2kWithHandle(CLBlastHandle handle,
+                                              const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                              const size_t n, const size_t k,
+                                              const cl_float2 alpha,
+                                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                              const cl_float2 beta,
+                                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                              cl_event* event);
+StatusCode PUBLIC_API CLBlastZsyr2kWithHandle(CLBlastHandle handle,
+                                              const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                              const size_t n, const size_t k,
+                                              const cl_double2 alpha,
+                                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                              const cl_double2 beta,
+                                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                              cl_event* event);
+
+// Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
+StatusCode PUBLIC_API CLBlastCher2kWithHandle(CLBlastHandle handle,
+                                              const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                              const size_t n, const size_t k,
+                                              const cl_float2 alpha,
+                                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                              const float beta,
+                                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                              cl_event* event);
+StatusCode PUBLIC_API CLBlastZher2kWithHandle(CLBlastHandle handle,
+                                              const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                              const size_t n, const size_t k,
+                                              const cl_double2 alpha,
+                                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                              const double beta,
+                                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                              cl_event* event);
+
+// Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM
+StatusCode PUBLIC_API CLBlastStrmmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastDtrmmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastCtrmmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             cl_event* event);
+StatusCode PUBLIC_API CLBlastZtrmmWithHandle(CLBlastHandle handle,
+                                             const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             cl_event* event);
+
+// =================================================================================================
+// Workspace-size queries and workspace-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================
+
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+StatusCode PUBLIC_API CLBlastSgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastDgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastCgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastZgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastHgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastSgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const float alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const float beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastDgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const double alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const double beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastCgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_float2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_float2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_double2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_double2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_half alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_half beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
+StatusCode PUBLIC_API CLBlastSsymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastDsymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastCsymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastZsymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastSsymmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                const float alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const float beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastDsymmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                const double alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const double beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastCsymmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                const cl_float2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_float2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZsymmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                const cl_double2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_double2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
+StatusCode PUBLIC_API CLBlastChemmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastZhemmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastChemmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                const cl_float2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_float2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZhemmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                                const size_t m, const size_t n,
+                                                const cl_double2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_double2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK
+StatusCode PUBLIC_API CLBlastSsyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastDsyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastCsyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastZsyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastSsyrkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                const float alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const float beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastDsyrkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                const double alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const double beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastCsyrkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                const cl_float2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_float2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZsyrkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                const cl_double2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_double2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Rank-K update of a hermitian matrix: CHERK/ZHERK
+StatusCode PUBLIC_API CLBlastCherkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastZherkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastCherkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                const float alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const float beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZherkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                                const size_t n, const size_t k,
+                                                const double alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const double beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K
+StatusCode PUBLIC_API CLBlastSsyr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastDsyr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastCsyr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastZsyr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastSsyr2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 const float alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                 const float beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                 cl_mem workspace, const size_t workspace_size,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastDsyr2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 const double alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                 const double beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                 cl_mem workspace, const size_t workspace_size,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastCsyr2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 const cl_float2 alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                 const cl_float2 beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                 cl_mem workspace, const size_t workspace_size,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZsyr2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 const cl_double2 alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                 const cl_double2 beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                 cl_mem workspace, const size_t workspace_size,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
+StatusCode PUBLIC_API CLBlastCher2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastZher2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastCher2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 const cl_float2 alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                 const float beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                 cl_mem workspace, const size_t workspace_size,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZher2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                                 const size_t n, const size_t k,
+                                                 const cl_double2 alpha,
+                                                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                 const double beta,
+                                                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                 cl_mem workspace, const size_t workspace_size,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM
+StatusCode PUBLIC_API CLBlastStrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastDtrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastCtrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastZtrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                                const size_t m, const size_t n,
+                                                cl_command_queue* queue, size_t* workspace_size);
+StatusCode PUBLIC_API CLBlastStrmmWithWorkspace(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                                const size_t m, const size_t n,
+                                                const float alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastDtrmmWithWorkspace(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                                const size_t m, const size_t n,
+                                                const double alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastCtrmmWithWorkspace(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                                const size_t m, const size_t n,
+                                                const cl_float2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZtrmmWithWorkspace(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                                const size_t m, const size_t n,
+                                                const cl_double2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                cl_mem workspace, const size_t workspace_size,
+                                                cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Grouped version of GEMM: computes a group of problems of different sizes, of which the arguments
+// are given per problem in device memory (see 'GemmGroupedBatched' in the C++ API for details)
+StatusCode PUBLIC_API CLBlastSgemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                 const size_t group_count, const cl_mem problems_buffer,
+                                                 const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                                                 const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastDgemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                 const size_t group_count, const cl_mem problems_buffer,
+                                                 const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                                                 const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastCgemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                 const size_t group_count, const cl_mem problems_buffer,
+                                                 const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                                                 const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                                                 cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastZgemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                                 const size_t group_count, const cl_mem problems_buffer,
+                                                 const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                                                 const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// Mixed-precision version of GEMM: matrices A and B are stored in half-precision (cl_half), whereas
+// matrix C, the scalars, and the accumulation are in single-precision (see 'GemmMixed' in C++)
+StatusCode PUBLIC_API CLBlastGemmMixed(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const float alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const float beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event);
+
+// Converts a vector of single-precision values on the device into half-precision or vice-versa
+StatusCode PUBLIC_API CLBlastConvertFloatToHalf(const size_t n,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastConvertHalfToFloat(const size_t n,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+
+// GEMM with a bias, activation, and scaling epilogue applied when storing the result
+StatusCode PUBLIC_API CLBlastSgemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                           const size_t m, const size_t n, const size_t k,
+                                           const float alpha,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           const float beta,
+                                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                           const Bias bias, const cl_mem bias_buffer, const size_t bias_offset,
+                                           const Activation activation,
+                                           const cl_mem row_scale_buffer, const size_t row_scale_offset,
+                                           const cl_mem col_scale_buffer, const size_t col_scale_offset,
+                                           cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastDgemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                           const size_t m, const size_t n, const size_t k,
+                                           const double alpha,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           const double beta,
+                                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                           const Bias bias, const cl_mem bias_buffer, const size_t bias_offset,
+                                           const Activation activation,
+                                           const cl_mem row_scale_buffer, const size_t row_scale_offset,
+                                           const cl_mem col_scale_buffer, const size_t col_scale_offset,
+                                           cl_command_queue* queue, cl_event* event);
+StatusCode PUBLIC_API CLBlastHgemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                           const size_t m, const size_t n, const size_t k,
+                                           const cl_half alpha,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                           const cl_half beta,
+                                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                           const Bias bias, const cl_mem bias_buffer, const size_t bias_offset,
+                                           const Activation activation,
+                                           const cl_mem row_scale_buffer, const size_t row_scale_offset,
+                                           const cl_mem col_scale_buffer, const size_t col_scale_offset,
+                                           cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 
 // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
@@ -1098,6 +1859,119 @@ StatusCode PUBLIC_API CLBlastClearCache();
 // Further CLBlast routine calls will then run at maximum speed.
 StatusCode PUBLIC_API CLBlastFillCache(const cl_device_id device);
 
+// As above, but only for a selection of routines, given as a comma-separated list of names with a
+// precision prefix (e.g. "SGEMM,DGEMV,CHERK"). A null-pointer selects all routines. The kernels are
+// compiled concurrently by 'num_threads' host threads; zero selects the number of hardware threads.
+StatusCode PUBLIC_API CLBlastFillCacheSelection(const cl_device_id device, const char* routines,
+                                                const size_t num_threads);
+
+// Non-blocking variant of the above: returns immediately and fills the cache in the background. A
+// routine call which needs a kernel that is still being compiled waits only for that kernel.
+StatusCode PUBLIC_API CLBlastFillCacheAsync(const cl_device_id device, const char* routines,
+                                            const size_t num_threads);
+
+// Compiled binaries can also be stored persistently on disk, such that they can be re-used across
+// process restarts. This sets the directory of that on-disk cache. Passing an empty string or a
+// null-pointer disables it. By default, the 'CLBLAST_CACHE_DIR' environmental variable is used.
+StatusCode PUBLIC_API CLBlastSetCacheDirectory(const char* directory);
+
+// The cache is bounded: when the total size of the binaries or the number of programs exceeds its
+// limit, the least-recently-used entries are evicted. Zero means no limit. The defaults are 512MB
+// of binaries and 4096 programs.
+StatusCode PUBLIC_API CLBlastSetCacheLimits(const size_t max_binary_bytes,
+                                            const size_t max_programs);
+
+// Cached programs keep their OpenCL context alive. Applications which create and release many
+// contexts should therefore remove a context's programs from the cache before releasing it.
+StatusCode PUBLIC_API CLBlastClearCacheForContext(const cl_context context);
+
+// Statistics about the usage of the cache, retrieved through 'CLBlastGetCacheStatistics'
+typedef struct {
+  size_t program_hits;        // Programs found in the cache
+  size_t program_misses;      // Programs which had to be created from a binary or from source
+  size_t compilations;        // Programs compiled from source
+  double compilation_time_ms; // Total time spent compiling from source
+  size_t num_binaries;        // Binaries currently held
+  size_t binary_bytes;        // Total size of the binaries currently held
+  size_t num_programs;        // Programs currently held
+  size_t evictions;           // Entries evicted because of the limits
+} CLBlastCacheStatistics;
+StatusCode PUBLIC_API CLBlastGetCacheStatistics(CLBlastCacheStatistics* statistics);
+
+// The binaries in the cache for a specific device can be exported as a single blob, such that they
+// can be compiled once and shipped to other machines with the same device and driver. If 'blob' is
+// a null-pointer (or 'blob_size' is too small), only the required size is returned in 'blob_size'.
+StatusCode PUBLIC_API CLBlastExportCache(const cl_device_id device, char* blob, size_t* blob_size);
+
+// Adds the binaries of an exported blob to the cache. Entries for another device (name) or driver
+// version are ignored. An invalid or corrupt blob is rejected as a whole.
+StatusCode PUBLIC_API CLBlastImportCache(const cl_device_id device, const char* blob,
+                                         const size_t blob_size);
+
+// =================================================================================================
+
+// The built-in tuning parameters can be overridden at run-time by the JSON output files of the
+// tuners (e.g. 'clblast_xgemm_32.json'), such that newly tuned devices don't require a re-build of
+// the library. The path is either a single file or a directory with the tuner output files. Invalid
+// or incomplete files are ignored, in which case the built-in parameters are used. Passing an empty
+// string or a null-pointer disables this. By default, the 'CLBLAST_TUNING_PATH' environmental
+// variable is used.
+StatusCode PUBLIC_API CLBlastSetTuningParametersPath(const char* path);
+
+// =================================================================================================
+
+// Temporary device buffers (e.g. padded copies of matrices) are taken from a pool, such that they
+// are re-used across routine calls. An idle buffer is only re-used on the in-order queue it was
+// last used on. This limits the total size of the idle buffers (256MB by default), releasing the
+// least-recently-used ones when exceeded. A limit of zero disables the pool.
+StatusCode PUBLIC_API CLBlastSetBufferPoolLimit(const size_t max_idle_bytes);
+
+// Releases the idle buffers of a specific context, or of all contexts in case of a null-pointer.
+// Idle buffers keep their OpenCL context alive, so this should be called before releasing it.
+StatusCode PUBLIC_API CLBlastClearBufferPool(const cl_context context);
+
+// Statistics about the usage of the buffer pool, retrieved through 'CLBlastGetBufferPoolStatistics'
+typedef struct {
+  size_t allocations;  // Buffers newly allocated
+  size_t reuses;       // Buffers re-used from the pool instead of allocated
+  size_t releases;     // Idle buffers released because of the limit or because of clearing
+  size_t bytes_in_use; // Total size of the buffers currently in use by routines
+  size_t num_idle;     // Idle buffers currently held by the pool
+  size_t idle_bytes;   // Total size of the idle buffers currently held by the pool
+} CLBlastBufferPoolStatistics;
+StatusCode PUBLIC_API CLBlastGetBufferPoolStatistics(CLBlastBufferPoolStatistics* statistics);
+
+// Sets a memory budget for the temporary buffers of a single routine call on a specific context.
+// GEMM-based routines whose temporary matrices would exceed it compute the result in blocks instead,
+// which is slower but needs less memory. Zero removes the budget, which is also the default.
+StatusCode PUBLIC_API CLBlastSetMemoryBudget(const cl_context context, const size_t max_bytes);
+
+// Sets the accuracy mode of the GEMM routines. In the fast mode, large complex problems are
+// computed with the 3M algorithm: three real matrix-multiplications instead of four, which is
+// faster but less accurate, since the imaginary parts suffer from cancellation. Very large problems
+// are also computed with the Strassen-Winograd recursion (see below). The default is the precise
+// mode.
+typedef enum GemmAccuracy_ { kPrecise = 171, kFast = 172 } GemmAccuracy;
+StatusCode PUBLIC_API CLBlastSetGemmAccuracy(const GemmAccuracy accuracy);
+
+// Sets the maximum number of levels of the Strassen-Winograd recursion used in the fast accuracy
+// mode. Each level splits the matrices into quadrants and computes 7 instead of 8 products of them,
+// at the cost of accuracy and temporary memory. The depth is also limited by the memory budget (if
+// any) or by half the device memory. The default is 2, zero disables the recursion.
+StatusCode PUBLIC_API CLBlastSetGemmStrassenDepth(const size_t max_depth);
+
+// =================================================================================================
+
+// Creates a handle bound to an OpenCL command queue. The handle-based variants of the routines
+// (e.g. 'CLBlastSgemmWithHandle') keep their routine objects alive within the handle, such that the
+// tuning parameters, device properties, and compiled program are only retrieved on first use.
+// This reduces the host overhead for small problem sizes. A handle should not be used by multiple
+// host threads at the same time. The queue should remain valid until the handle is released.
+StatusCode PUBLIC_API CLBlastCreateHandle(cl_command_queue* queue, CLBlastHandle* handle);
+
+// Releases a handle created with 'CLBlastCreateHandle'
+StatusCode PUBLIC_API CLBlastReleaseHandle(CLBlastHandle handle);
+
 // =================================================================================================
 
 #ifdef __cplusplus
@@ -0,0 +1,105 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file provides the host data-type for half-precision (16-bit) floating-point values, as used
+// by the half-precision routines of both the C++ and the C interfaces. The host doesn't compute in
+// half-precision: values are stored as their raw bits and converted from and to single-precision
+// using the two functions below. This header can be included from both C and C++ code.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_HALF_H_
+#define CLBLAST_HALF_H_
+
+#include <string.h>
+
+// Includes the normal OpenCL C header
+#if defined(__APPLE__) || defined(__MACOSX)
+  #include <OpenCL/opencl.h>
+#else
+  #include <CL/opencl.h>
+#endif
+
+// =================================================================================================
+
+// The host data-type for half-precision floating-point values: the IEEE 754-2008 binary16 bits
+typedef cl_half half;
+
+// Converts a single-precision value into half-precision. Rounds to the nearest representable value
+// (ties to even), turns values beyond the half-precision range into infinities and keeps NaNs.
+static inline half FloatToHalf(const float value) {
+  cl_uint bits;
+  memcpy(&bits, &value, sizeof(bits));
+  const cl_uint sign = (bits >> 16) & 0x8000;
+  const cl_uint exponent = (bits >> 23) & 0xFF;
+  cl_uint mantissa = bits & 0x7FFFFF;
+
+  // Infinities and NaNs (the latter are kept quiet)
+  if (exponent == 0xFF) {
+    return (half)(sign | 0x7C00 | ((mantissa != 0) ? 0x0200 : 0));
+  }
+
+  // Re-biases the exponent: beyond 30 overflows into infinity, below 1 results in a sub-normal
+  const int half_exponent = (int)exponent - 127 + 15;
+  if (half_exponent >= 0x1F) {
+    return (half)(sign | 0x7C00);
+  }
+  if (half_exponent <= 0) {
+    if (half_exponent < -10) { return (half)sign; } // Rounds to (signed) zero
+    mantissa |= 0x800000; // Adds the implicit leading one
+    const cl_uint shift = (cl_uint)(14 - half_exponent);
+    const cl_uint remainder = mantissa & ((1u << shift) - 1);
+    const cl_uint halfway = 1u << (shift - 1);
+    cl_uint result = mantissa >> shift;
+    if (remainder > halfway || (remainder == halfway && (result & 1))) { result++; }
+    return (half)(sign | result);
+  }
+
+  // Regular numbers. A carry of the rounding correctly moves into the exponent (or to infinity).
+  cl_uint result = ((cl_uint)half_exponent << 10) | (mantissa >> 13);
+  const cl_uint remainder = mantissa & 0x1FFF;
+  if (remainder > 0x1000 || (remainder == 0x1000 && (result & 1))) { result++; }
+  return (half)(sign | result);
+}
+
+// Converts a half-precision value into single-precision. This is exact: every half-precision value
+// can be represented in single-precision.
+static inline float HalfToFloat(const half value) {
+  const cl_uint sign = ((cl_uint)value & 0x8000) << 16;
+  cl_uint exponent = ((cl_uint)value >> 10) & 0x1F;
+  cl_uint mantissa = (cl_uint)value & 0x03FF;
+  cl_uint bits;
+
+  // Infinities and NaNs
+  if (exponent == 0x1F) {
+    bits = sign | 0x7F800000 | (mantissa << 13);
+  }
+  // Regular numbers
+  else if (exponent != 0) {
+    bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  }
+  // Zeros
+  else if (mantissa == 0) {
+    bits = sign;
+  }
+  // Sub-normal numbers: these are normalised in single-precision
+  else {
+    exponent = 127 - 15 + 1;
+    while ((mantissa & 0x0400) == 0) { mantissa <<= 1; exponent--; }
+    bits = sign | (exponent << 23) | ((mantissa & 0x03FF) << 13);
+  }
+  float result;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+// =================================================================================================
+
+// CLBLAST_HALF_H_
+#endif
@@ -0,0 +1,82 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a pool of temporary device buffers. Routines obtain their temporary buffers
+// (e.g. padded copies of matrices) from this pool, such that these are re-used across calls instead
+// of being allocated and released each time.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_BUFFER_POOL_H_
+#define CLBLAST_BUFFER_POOL_H_
+
+#include <memory>
+
+#include "internal/utilities.h"
+
+namespace clblast {
+namespace pool {
+// =================================================================================================
+
+// Retrieves a buffer of at least the given size (in bytes) for use on a specific queue: either an
+// idle buffer from the pool or a newly allocated one. Once the last copy of the returned pointer is
+// destroyed, the buffer becomes idle again. An idle buffer is only re-used on the (in-order) queue
+// it was last used on, such that it is never used by two routine calls at the same time. Buffers
+// for out-of-order queues are therefore not pooled.
+std::shared_ptr<cl_mem> AcquireBuffer(const Context &context, const Queue &queue,
+                                      const size_t bytes);
+
+// As above, but returns a buffer of (at least) 'size' elements of type T
+template <typename T>
+Buffer<T> GetBuffer(const Context &context, const Queue &queue, const size_t size) {
+  return Buffer<T>(AcquireBuffer(context, queue, size*sizeof(T)));
+}
+
+// Finds out whether a queue executes its commands in-order, i.e. whether subsequent commands can
+// rely on earlier ones without events. Queues which can't be queried are assumed out-of-order.
+bool IsInOrderQueue(const cl_command_queue queue);
+
+// Releases the idle buffers of a specific context, or of all contexts in case of a null-pointer.
+// Idle buffers keep their context alive, so this should be called before releasing a context.
+void ClearPool(const cl_context context);
+
+// Limits the total size of the idle buffers held by the pool. When the limit is exceeded, the
+// least-recently-used idle buffers are released. Zero disables the pool altogether.
+void SetPoolLimit(const size_t max_idle_bytes);
+
+// The default limit of the pool
+constexpr auto kDefaultMaxIdleBytes = size_t{256*1024*1024};
+
+// Sets the maximum total size of the temporary buffers a single routine call may use on a specific
+// context. Routines which would exceed it fall back to an approach requiring less memory (e.g.
+// computing the result in blocks). Zero means no budget, which is also the default.
+void SetMemoryBudget(const cl_context context, const size_t max_bytes);
+
+// Retrieves the memory budget of a context (zero if there is none)
+size_t GetMemoryBudget(const cl_context context);
+
+// Statistics about the usage of the pool
+struct Statistics {
+  size_t allocations;  // Buffers newly allocated
+  size_t reuses;       // Buffers re-used from the pool instead of allocated
+  size_t releases;     // Idle buffers released because of the limit or because of clearing the pool
+  size_t bytes_in_use; // Total size of the buffers currently in use by routines
+  size_t num_idle;     // Idle buffers currently held by the pool
+  size_t idle_bytes;   // Total size of the idle buffers currently held by the pool
+};
+
+// Retrieves the current statistics
+Statistics GetStatistics();
+
+// =================================================================================================
+} // namespace pool
+} // namespace clblast
+
+// CLBLAST_BUFFER_POOL_H_
+#endif
@@ -17,6 +17,11 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <memory>
+#include <functional>
+#include <future>
+#include <atomic>
+#include <unordered_map>
 
 #include "internal/utilities.h"
 
@@ -24,19 +29,22 @@ namespace clblast {
 namespace cache {
 // =================================================================================================
 
-// The cache of compiled OpenCL binaries, along with some meta-data
+// The cache of compiled OpenCL binaries, along with some meta-data. Binaries are content-addressed:
+// the name is the hash of the full source code they were compiled from (see 'SourceHash'), such
+// that routines with identical kernel sources share a single binary.
 struct BinaryCache {
   std::string binary;
   std::string device_name;
   Precision precision;
-  std::string routine_name_;
+  std::string name;
+  size_t last_used; // Value of the cache's clock at the last use, for least-recently-used eviction
 
   // Finds out whether the properties match
   bool MatchInCache(const std::string &ref_device, const Precision &ref_precision,
-                    const std::string &ref_routine) {
+                    const std::string &ref_name) {
     return (device_name == ref_device &&
             precision == ref_precision &&
-            routine_name_ == ref_routine);
+            name == ref_name);
   }
 };
 
@@ -46,52 +54,220 @@ static std::mutex binary_cache_mutex_;
 
 // =================================================================================================
 
-// The cache of compiled OpenCL programs, along with some meta-data
-struct ProgramCache {
-  Program program;
-  ContextPointer context_ptr;
+// The key of the cache of compiled OpenCL programs. Note that this uses the OpenCL context itself
+// and not a pointer to it, since each 'Context' object holds its own copy of the 'cl_context'. The
+// name is either the hash of the program's full source code (see 'SourceHash'), such that programs
+// are shared among routines, or the name of a routine, which serves as a fast look-up of the former.
+struct ProgramKey {
+  cl_context context;
   Precision precision;
-  std::string routine_name_;
+  std::string name;
 
   // Finds out whether the properties match
-  bool MatchInCache(const ContextPointer ref_context, const Precision &ref_precision,
-                    const std::string &ref_routine) {
-    return (context_ptr == ref_context &&
-            precision == ref_precision &&
-            routine_name_ == ref_routine);
+  bool operator==(const ProgramKey &other) const {
+    return (context == other.context &&
+            precision == other.precision &&
+            name == other.name);
   }
 };
 
-// The actual cache, implemented as a vector of the above data-type, and its mutex
-static std::vector<ProgramCache> program_cache_;
-static std::mutex program_cache_mutex_;
+// Hash function for the above key, combining the hashes of the individual properties
+struct ProgramKeyHash {
+  size_t operator()(const ProgramKey &key) const {
+    auto hash = std::hash<std::string>()(key.name);
+    const auto context_hash = std::hash<cl_context>()(key.context);
+    const auto precision_hash = std::hash<int>()(static_cast<int>(key.precision));
+    hash ^= context_hash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= precision_hash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+
+// The cache of compiled OpenCL programs, implemented as a hash map. It is read on every routine call
+// but modified rarely, so it is never changed in-place: readers atomically obtain a pointer to the
+// current (immutable) map without locking, whereas writers publish a modified copy. The actual
+// cache and the mutex to serialize the writers are found in the corresponding source file. Each
+// entry records when it was last used, which readers update atomically. It is shared among all
+// versions of the map, such that a new version does not lose the usage information.
+struct CachedProgram {
+  Program program;
+  std::shared_ptr<std::atomic<size_t>> last_used;
+};
+using ProgramCache = std::unordered_map<ProgramKey, CachedProgram, ProgramKeyHash>;
+
+// =================================================================================================
+
+// The key of the cache of OpenCL kernels: the program it was created from and the kernel's name
+struct KernelKey {
+  cl_program program;
+  std::string kernel_name;
+
+  // Finds out whether the properties match
+  bool operator==(const KernelKey &other) const {
+    return (program == other.program && kernel_name == other.kernel_name);
+  }
+};
+
+// Hash function for the above key, combining the hashes of the individual properties
+struct KernelKeyHash {
+  size_t operator()(const KernelKey &key) const {
+    auto hash = std::hash<std::string>()(key.kernel_name);
+    const auto program_hash = std::hash<cl_program>()(key.program);
+    hash ^= program_hash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+
+// The cache of OpenCL kernels and their local memory usage. Creating a kernel and querying its
+// properties is expensive on some platforms, so kernels are re-used across calls. Since kernel
+// arguments are shared state, each host thread has its own cache (found in the source file). This
+// is safe because OpenCL captures the arguments when a kernel is enqueued.
+struct KernelCache {
+  size_t generation;
+  std::unordered_map<KernelKey, Kernel, KernelKeyHash> kernels;
+  std::unordered_map<cl_kernel, size_t> local_mem_usages;
+};
 
 // =================================================================================================
 
+// Computes the hash of a program's full source code (including the defines), which is used as the
+// name of content-addressed binaries and programs in the caches
+std::string SourceHash(const std::string &source);
+
 // Stores the compiled binary or program in the cache
 void StoreBinaryToCache(const std::string &binary, const std::string &device_name,
-                        const Precision &precision, const std::string &routine_name);
+                        const Precision &precision, const std::string &name);
 void StoreProgramToCache(const Program &program, const Context &context,
-                         const Precision &precision, const std::string &routine_name);
+                         const Precision &precision, const std::string &name);
 
 // Queries the cache and retrieves a matching binary or program. Assumes that the match is
-// available, throws otherwise.
-const std::string& GetBinaryFromCache(const std::string &device_name, const Precision &precision,
-                                      const std::string &routine_name);
-const Program& GetProgramFromCache(const Context &context, const Precision &precision,
-                                   const std::string &routine_name);
+// available, throws otherwise. The binary is returned by value, since it might be evicted.
+std::string GetBinaryFromCache(const std::string &device_name, const Precision &precision,
+                                      const std::string &name);
+Program GetProgramFromCache(const Context &context, const Precision &precision,
+                            const std::string &name);
+
+// Queries the cache for a matching program and retrieves it in case it is available. This performs
+// a single look-up and can thus be used instead of the 'IsInCache' and 'FromCache' combination.
+bool FindProgramInCache(const Context &context, const Precision &precision,
+                        const std::string &name, std::shared_ptr<Program> &program);
+
+// Retrieves a kernel from the cache of the calling thread. It is created on first use.
+Kernel GetKernelFromCache(const Program &program, const std::string &kernel_name);
+
+// Retrieves the local memory usage of a kernel from the cache of the calling thread. It is queried
+// on first use. The kernel should be obtained through 'GetKernelFromCache', which keeps it alive.
+size_t GetLocalMemUsageFromCache(const Kernel &kernel, const Device &device);
 
 // Queries the cache to see whether or not the compiled kernel is already there
 bool BinaryIsInCache(const std::string &device_name, const Precision &precision,
-                     const std::string &routine_name);
+                     const std::string &name);
 bool ProgramIsInCache(const Context &context, const Precision &precision,
-                      const std::string &routine_name);
+                      const std::string &name);
 
 // =================================================================================================
 
 // Clears the cache of stored binaries
 StatusCode ClearCache();
 
+// Removes all programs of a specific context from the cache. The cached programs keep the context
+// alive, so this should be called before releasing a context for good. Kernels are removed from the
+// per-thread caches as well, each thread does so upon its next access.
+void ClearCacheForContext(const cl_context context);
+
+// Removes all programs (of all contexts) from the cache, but keeps the binaries. This is needed when
+// the tuning parameters change, since programs are also cached under their routine's name.
+void ClearProgramCache();
+
+// Retrieves the number of times the programs were cleared by one of the above, e.g. because the
+// tuning parameters changed. Long-lived routine objects (see 'handle.h') are outdated when this
+// changes, since they hold their program and their tuning parameters.
+size_t GetClearGeneration();
+
+// Limits the total size of the binaries and the number of programs held by the cache. When either
+// limit is exceeded, the least-recently-used entries are evicted. Zero means no limit.
+void SetCacheLimits(const size_t max_binary_bytes, const size_t max_programs);
+
+// The default limits of the cache
+constexpr auto kDefaultMaxBinaryBytes = size_t{512*1024*1024};
+constexpr auto kDefaultMaxPrograms = size_t{4096};
+
+// Statistics about the usage of the cache
+struct Statistics {
+  size_t program_hits;        // Programs found in the cache
+  size_t program_misses;      // Programs which had to be created from a binary or from source
+  size_t compilations;        // Programs compiled from source
+  double compilation_time_ms; // Total time spent compiling from source
+  size_t num_binaries;        // Binaries currently held
+  size_t binary_bytes;        // Total size of the binaries currently held
+  size_t num_programs;        // Programs currently held
+  size_t evictions;           // Entries evicted because of the limits
+};
+
+// Retrieves the current statistics
+Statistics GetStatistics();
+
+// Records a program which could not be found in the cache, and the compilation of a program
+void RecordProgramMiss();
+void RecordCompilation(const double time_ms);
+
+// =================================================================================================
+
+// Sets the directory of the persistent on-disk binary cache. An empty string disables the on-disk
+// cache. If this function is never called, the 'CLBLAST_CACHE_DIR' environmental variable is used.
+void SetCacheDirectory(const std::string &directory);
+
+// Retrieves the current on-disk cache directory, or an empty string if the on-disk cache is off
+std::string GetCacheDirectory();
+
+// Creates the key of an on-disk cache entry. It is unique for a combination of device, driver and
+// platform versions, precision, and the full kernel source (including the defines).
+std::string DiskCacheKey(const Device &device, const Precision &precision,
+                         const std::string &source);
+
+// Loads a binary from the on-disk cache. Returns false if there is no valid entry for the given
+// key, e.g. because it is missing, stale, or corrupted.
+bool LoadBinaryFromDisk(const std::string &key, std::string &binary);
+
+// Stores a binary in the on-disk cache, overwriting any existing entry with the same key. Failures
+// are silently ignored, since the on-disk cache is merely an optimisation.
+void StoreBinaryToDisk(const std::string &key, const std::string &binary);
+
+// =================================================================================================
+
+// Serializes all binaries of a specific device into a single versioned blob. Each entry records
+// the device name and driver version, such that it can be validated when it is imported again.
+std::string ExportBinaries(const std::string &device_name, const std::string &driver_version);
+
+// Adds the binaries from a blob to the cache. Entries for another device or driver version and
+// entries which are already in the cache are skipped. Returns false if the blob is invalid, in which
+// case nothing is added at all.
+bool ImportBinaries(const std::string &blob, const std::string &device_name,
+                    const std::string &driver_version);
+
+// =================================================================================================
+
+// Marks a binary as pending, i.e. as about to be compiled in the background (e.g. by
+// 'FillCacheAsync'). Routines needing it will then wait for it instead of compiling it themselves.
+void MarkBinaryAsPending(const std::string &device_name, const Precision &precision,
+                         const std::string &routine_name);
+
+// Claims a pending binary for compilation by the calling thread, such that it does not wait for it
+void ClaimPendingBinary(const std::string &device_name, const Precision &precision,
+                        const std::string &routine_name);
+
+// Removes the pending mark of a binary (whether or not it was compiled successfully), including the
+// claim of the calling thread (if any), and wakes up the threads waiting for it
+void UnmarkPendingBinary(const std::string &device_name, const Precision &precision,
+                         const std::string &routine_name);
+
+// Blocks as long as the binary is pending and claimed by another thread (or not yet claimed)
+void WaitForPendingBinary(const std::string &device_name, const Precision &precision,
+                          const std::string &routine_name);
+
+// Takes ownership of a background task, such that it is completed before the library is unloaded
+void AddBackgroundTask(std::future<void> &&task);
+
 // =================================================================================================
 } // namespace cache
 } // namespace clblast
@@ -135,6 +135,16 @@ class Platform {
     return static_cast<size_t>(result);
   }
 
+  // Retrieves the OpenCL version string of this platform
+  std::string Version() const {
+    auto bytes = size_t{0};
+    CheckError(clGetPlatformInfo(platform_, CL_PLATFORM_VERSION, 0, nullptr, &bytes));
+    auto result = std::string{};
+    result.resize(bytes);
+    CheckError(clGetPlatformInfo(platform_, CL_PLATFORM_VERSION, bytes, &result[0], nullptr));
+    return std::string{result.c_str()}; // Removes any trailing '\0'-characters
+  }
+
   // Accessor to the private data-member
   const cl_platform_id& operator()() const { return platform_; }
  private:
@@ -165,6 +175,8 @@ class Device {
   std::string Version() const { return GetInfoString(CL_DEVICE_VERSION); }
   std::string Vendor() const { return GetInfoString(CL_DEVICE_VENDOR); }
   std::string Name() const { return GetInfoString(CL_DEVICE_NAME); }
+  std::string DriverVersion() const { return GetInfoString(CL_DRIVER_VERSION); }
+  Platform GetPlatform() const { return Platform(GetInfo<cl_platform_id>(CL_DEVICE_PLATFORM)); }
   std::string Type() const {
     auto type = GetInfo<cl_device_type>(CL_DEVICE_TYPE);
     switch(type) {
@@ -187,8 +199,13 @@ class Device {
   std::string Capabilities() const { return GetInfoString(CL_DEVICE_EXTENSIONS); }
   size_t CoreClock() const { return GetInfo(CL_DEVICE_MAX_CLOCK_FREQUENCY); }
   size_t ComputeUnits() const { return GetInfo(CL_DEVICE_MAX_COMPUTE_UNITS); }
-  size_t MemorySize() const { return GetInfo(CL_DEVICE_GLOBAL_MEM_SIZE); }
-  size_t MaxAllocSize() const { return GetInfo(CL_DEVICE_MAX_MEM_ALLOC_SIZE); }
+  size_t MemorySize() const {
+    return static_cast<size_t>(GetInfo<cl_ulong>(CL_DEVICE_GLOBAL_MEM_SIZE));
+  }
+  size_t MaxAllocSize() const {
+    return static_cast<size_t>(GetInfo<cl_ulong>(CL_DEVICE_MAX_MEM_ALLOC_SIZE));
+  }
+  size_t MemBaseAddrAlign() const { return GetInfo(CL_DEVICE_MEM_BASE_ADDR_ALIGN) / 8; } // bytes
   size_t MemoryClock() const { return 0; } // Not exposed in OpenCL
   size_t MemoryBusWidth() const { return 0; } // Not exposed in OpenCL
 
@@ -485,6 +502,13 @@ class Buffer {
     Buffer<T>(context, BufferAccess::kReadWrite, size) {
   }
 
+  // Constructor based on an existing shared OpenCL buffer: memory management is handled by the
+  // deleter of the shared pointer (e.g. returning the buffer to a pool)
+  explicit Buffer(const std::shared_ptr<cl_mem> buffer):
+      buffer_(buffer),
+      access_(BufferAccess::kReadWrite) {
+  }
+
   // Constructs a new buffer based on an existing host-container
   template <typename Iterator>
   explicit Buffer(const Context &context, const Queue &queue, Iterator start, Iterator end):
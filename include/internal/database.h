@@ -11,6 +11,9 @@
 // information. The class also provides utility functions to search the database and to access a
 // found entry by parameter-key. The database itself is filled in the corresponding source-file and
 // partially also by the database/xxxxx.h files, in which kernel-specific parameters are found.
+// Parameter-keys are enumerated, such that accessing a parameter of a found entry is an array load.
+// Entries can be overridden at run-time by the JSON output files of the tuners. Besides the regular
+// parameters, an entry can hold parameters for specific ranges of problem sizes.
 //
 // =================================================================================================
 
@@ -19,6 +22,10 @@
 
 #include <string>
 #include <vector>
+#include <limits>
+#include <array>
+#include <bitset>
+#include <utility>
 #include <unordered_map>
 
 #include "internal/utilities.h"
@@ -26,17 +33,47 @@
 namespace clblast {
 // =================================================================================================
 
+// The keys of all tuning parameters in the database. The names of the keys are equal to the names of
+// the parameters (prefixed by 'k'), which are also the names of the OpenCL pre-processor defines.
+enum DatabaseParameter: size_t {
+  kCOPY_DIMX, kCOPY_DIMY, kCOPY_VW, kCOPY_WPT,
+  kDBUF, kKWG, kKWI, kMDIMA, kMDIMC, kMWG, kNDIMB, kNDIMC, kNWG, kSA, kSB, kSTRM, kSTRN, kVWM, kVWN,
+  kKWID, kMDIMAD, kMDIMCD, kNDIMBD, kNDIMCD, kPADA, kPADB, kWGD,
+  kPADTRA_PAD, kPADTRA_TILE, kPADTRA_WPT,
+  kPAD_DIMX, kPAD_DIMY, kPAD_WPTX, kPAD_WPTY,
+  kTRA_DIM, kTRA_PAD, kTRA_SHUFFLE, kTRA_WPT,
+  kVW, kVW2, kVW3, kWGS, kWGS1, kWGS2, kWGS3, kWPT, kWPT1, kWPT2, kWPT3,
+  kXGEMM_MIN_INDIRECT_SIZE, kXGEMM_SPLITK_MIN_K, kXGEMM_SPLITK_RATIO,
+  kXGEMM_MIN_3M_SIZE, kXGEMM_MIN_STRASSEN_SIZE,
+  kNumDatabaseParameters // Not a parameter: the total number of parameters
+};
+
 // See comment at top of file for a description of the class
 class Database {
  public:
 
   // Type alias for the database parameters
-  using Parameters = std::unordered_map<std::string,size_t>;
+  using Parameters = std::vector<std::pair<DatabaseParameter,size_t>>;
+
+  // Parameters for a specific range of problem sizes: these replace the regular parameters if the
+  // sizes m, n, and k are all at most the given maximum sizes
+  struct DatabaseSizeEntry {
+    const size_t max_m;
+    const size_t max_n;
+    const size_t max_k;
+    const Parameters parameters;
+  };
 
-  // Structures for content inside the database
+  // Structures for content inside the database. The size-specific entries of a device are optional
+  // and ordered from most to least specific: the first one matching the problem size is selected.
   struct DatabaseDevice {
+    DatabaseDevice(const std::string &device_name, const Parameters &device_parameters,
+                   const std::vector<DatabaseSizeEntry> &device_size_entries =
+                     std::vector<DatabaseSizeEntry>()):
+      name(device_name), parameters(device_parameters), size_entries(device_size_entries) { }
     const std::string name;
     const Parameters parameters;
+    const std::vector<DatabaseSizeEntry> size_entries;
   };
   struct DatabaseVendor {
     const std::string type;
@@ -55,27 +92,31 @@ class Database {
   static constexpr auto kDeviceTypeAccelerator = "accelerator";
   static constexpr auto kDeviceTypeAll = "default";
 
+  // The maximum size of a size-specific entry in case it applies to all sizes in that dimension
+  static constexpr size_t kSizeUnbounded = std::numeric_limits<size_t>::max();
+
   // The OpenCL device vendors
   static constexpr auto kDeviceVendorAll = "default";
 
   // Alternative names for some OpenCL vendors
-  const std::unordered_map<std::string,std::string> kVendorNames {
-    {"Intel(R) Corporation", "Intel"},
-    {"GenuineIntel", "Intel"},
-    {"Advanced Micro Devices, Inc.", "AMD"},
-    {"NVIDIA Corporation", "NVIDIA"},
-  };
+  static const std::unordered_map<std::string,std::string> kVendorNames;
+
+  // The names of the parameters, indexed by their keys
+  static const std::array<std::string,kNumDatabaseParameters> kParameterNames;
 
   // The database consists of separate database entries, stored together in a vector
-  static const DatabaseEntry XaxpySingle, XaxpyDouble, XaxpyComplexSingle, XaxpyComplexDouble;
-  static const DatabaseEntry XdotSingle, XdotDouble, XdotComplexSingle, XdotComplexDouble;
-  static const DatabaseEntry XgemvSingle, XgemvDouble, XgemvComplexSingle, XgemvComplexDouble;
-  static const DatabaseEntry XgerSingle, XgerDouble, XgerComplexSingle, XgerComplexDouble;
-  static const DatabaseEntry XgemmSingle, XgemmDouble, XgemmComplexSingle, XgemmComplexDouble;
-  static const DatabaseEntry CopySingle, CopyDouble, CopyComplexSingle, CopyComplexDouble;
-  static const DatabaseEntry PadSingle, PadDouble, PadComplexSingle, PadComplexDouble;
-  static const DatabaseEntry TransposeSingle, TransposeDouble, TransposeComplexSingle, TransposeComplexDouble;
-  static const DatabaseEntry PadtransposeSingle, PadtransposeDouble, PadtransposeComplexSingle, PadtransposeComplexDouble;
+  static const DatabaseEntry XaxpyHalf, XaxpySingle, XaxpyDouble, XaxpyComplexSingle, XaxpyComplexDouble;
+  static const DatabaseEntry XdotHalf, XdotSingle, XdotDouble, XdotComplexSingle, XdotComplexDouble;
+  static const DatabaseEntry XgemvHalf, XgemvSingle, XgemvDouble, XgemvComplexSingle, XgemvComplexDouble;
+  static const DatabaseEntry XgerHalf, XgerSingle, XgerDouble, XgerComplexSingle, XgerComplexDouble;
+  static const DatabaseEntry XgemmHalf, XgemmSingle, XgemmDouble, XgemmComplexSingle, XgemmComplexDouble;
+  static const DatabaseEntry XgemmDirectHalf, XgemmDirectSingle, XgemmDirectDouble, XgemmDirectComplexSingle, XgemmDirectComplexDouble;
+  static const DatabaseEntry XgemmDirectBatchedHalf, XgemmDirectBatchedSingle, XgemmDirectBatchedDouble, XgemmDirectBatchedComplexSingle, XgemmDirectBatchedComplexDouble;
+  static const DatabaseEntry GemmRoutineHalf, GemmRoutineSingle, GemmRoutineDouble, GemmRoutineComplexSingle, GemmRoutineComplexDouble;
+  static const DatabaseEntry CopyHalf, CopySingle, CopyDouble, CopyComplexSingle, CopyComplexDouble;
+  static const DatabaseEntry PadHalf, PadSingle, PadDouble, PadComplexSingle, PadComplexDouble;
+  static const DatabaseEntry TransposeHalf, TransposeSingle, TransposeDouble, TransposeComplexSingle, TransposeComplexDouble;
+  static const DatabaseEntry PadtransposeHalf, PadtransposeSingle, PadtransposeDouble, PadtransposeComplexSingle, PadtransposeComplexDouble;
   static const std::vector<DatabaseEntry> database;
 
   // The constructor
@@ -83,18 +124,41 @@ class Database {
                     const Precision precision);
 
   // Accessor of values by key
-  size_t operator[](const std::string key) const { return parameters_.find(key)->second; }
+  size_t operator[](const DatabaseParameter key) const { return values_[key]; }
 
   // Obtain a list of OpenCL pre-processor defines based on the parameters
   std::string GetDefines() const;
 
- private:
-  Parameters Search(const std::string &this_kernel, const std::string &this_type,
-                    const std::string &this_vendor, const std::string &this_device,
-                    const Precision this_precision) const;
+  // Selects the parameters for a specific problem size: those of the first matching size-specific
+  // entry, or the regular parameters if there is none. Returns an identifier of the selection: zero
+  // for the regular parameters, or one plus the index of the size-specific entry otherwise.
+  size_t SelectProblemSize(const size_t m, const size_t n, const size_t k);
+
+  // Selects the parameters by an identifier as returned above, e.g. to restore an earlier selection
+  void SelectSizeEntry(const size_t selected);
 
-  // Found parameters suitable for this device/kernel
-  Parameters parameters_;
+  // Sets the path (a file or a directory) of the tuner output files overriding the database. This
+  // overrides the 'CLBLAST_TUNING_PATH' environmental variable. An empty path disables overriding.
+  static void SetOverridesPath(const std::string &path);
+
+ private:
+  static DatabaseDevice Find(const Device &device, const std::string &this_kernel,
+                             const Precision this_precision);
+  static const DatabaseDevice& Search(const std::string &this_kernel,
+                                      const std::string &this_type,
+                                      const std::string &this_vendor,
+                                      const std::string &this_device,
+                                      const Precision this_precision);
+
+  // Found parameters suitable for this device/kernel, indexed by their keys. The values are those of
+  // the selected problem size, the regular values are kept to be able to select another size.
+  std::array<size_t,kNumDatabaseParameters> values_;
+  std::array<size_t,kNumDatabaseParameters> regular_values_;
+  std::bitset<kNumDatabaseParameters> found_;
+
+  // The size-specific entries of all kernels, and the currently selected one (see above)
+  std::vector<DatabaseSizeEntry> size_entries_;
+  size_t selected_size_entry_;
 };
 
 // =================================================================================================
@@ -14,60 +14,72 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::CopyHalf = {
+  "Copy", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::CopySingle = {
   "Copy", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,4}, {kCOPY_WPT,1} } },
+        { "Hawaii",                                          { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,2} } },
+        { "Pitcairn",                                        { {kCOPY_DIMX,8}, {kCOPY_DIMY,16}, {kCOPY_VW,4}, {kCOPY_WPT,1} } },
+        { "Tahiti",                                          { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,2} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
+        { "Mali-T628",                                       { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,4} } },
+        { "default",                                         { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,4} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kCOPY_DIMX,32}, {kCOPY_DIMY,16}, {kCOPY_VW,8}, {kCOPY_WPT,2} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kCOPY_DIMX,32}, {kCOPY_DIMY,16}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Iris Pro",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
+        { "Iris",                                            { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
+        { "Iris Pro",                                        { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,4}, {kCOPY_WPT,4} } },
+        { "default",                                         { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,4}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 680",                                 { {kCOPY_DIMX,32}, {kCOPY_DIMY,16}, {kCOPY_VW,4}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 980",                                 { {kCOPY_DIMX,32}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,4} } },
+        { "GeForce GTX TITAN X",                             { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "Tesla K20m",                                      { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,4}, {kCOPY_WPT,4} } },
+        { "Tesla K40m",                                      { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,4}, {kCOPY_WPT,2} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
   }
@@ -79,48 +91,48 @@ const Database::DatabaseEntry Database::CopyComplexSingle = {
   "Copy", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "Hawaii",                                          { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
+        { "Pitcairn",                                        { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
+        { "Tahiti",                                          { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,2} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kCOPY_DIMX,16}, {kCOPY_DIMY,16}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,2} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Iris Pro",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
+        { "Iris",                                            { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
+        { "Iris Pro",                                        { {kCOPY_DIMX,32}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,4} } },
+        { "default",                                         { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,4}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,4}, {kCOPY_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kCOPY_DIMX,16}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kCOPY_DIMX,32}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 980",                                 { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "Tesla K20m",                                      { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,4} } },
+        { "Tesla K40m",                                      { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
   }
@@ -132,49 +144,49 @@ const Database::DatabaseEntry Database::CopyDouble = {
   "Copy", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "Hawaii",                                          { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
+        { "Pitcairn",                                        { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "Tahiti",                                          { {kCOPY_DIMX,8}, {kCOPY_DIMY,32}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",2} } },
+        { "Mali-T628",                                       { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,2} } },
+        { "default",                                         { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kCOPY_DIMX,16}, {kCOPY_DIMY,32}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kCOPY_DIMX,16}, {kCOPY_DIMY,16}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 680",                                 { {kCOPY_DIMX,16}, {kCOPY_DIMY,32}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 980",                                 { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kCOPY_DIMX,16}, {kCOPY_DIMY,32}, {kCOPY_VW,2}, {kCOPY_WPT,2} } },
+        { "GeForce GTX TITAN X",                             { {kCOPY_DIMX,32}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "Tesla K20m",                                      { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,1} } },
+        { "Tesla K40m",                                      { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,2} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
   }
@@ -186,49 +198,49 @@ const Database::DatabaseEntry Database::CopyComplexDouble = {
   "Copy", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",8} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kCOPY_DIMX,8}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "Hawaii",                                          { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,2}, {kCOPY_WPT,8} } },
+        { "Pitcairn",                                        { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "Tahiti",                                          { {kCOPY_DIMX,8}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
+        { "Mali-T628",                                       { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
+        { "default",                                         { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",32}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kCOPY_DIMX,32}, {kCOPY_DIMY,32}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,32}, {kCOPY_DIMY,8}, {kCOPY_VW,8}, {kCOPY_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 680",                                 { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kCOPY_DIMX,32}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX 980",                                 { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kCOPY_DIMX,16}, {kCOPY_DIMY,16}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kCOPY_DIMX,16}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "Tesla K20m",                                      { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,2} } },
+        { "Tesla K40m",                                      { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
+        { "default",                                         { {kCOPY_DIMX,8}, {kCOPY_DIMY,8}, {kCOPY_VW,1}, {kCOPY_WPT,1} } },
       }
     },
   }
@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file populates the database with the parameters of the GEMM routine itself (rather than of
+// its kernels). The 'XGEMM_MIN_INDIRECT_SIZE' parameter is the problem size (m, n, and k) from
+// which on the regular (indirect) Xgemm kernel is used instead of the direct kernel: a problem is
+// computed by the direct kernel if m*n*k is smaller than this size to the power of three. The
+// 'XGEMM_SPLITK_*' parameters control the split-K strategy for problems with a small C but a large
+// k: the k dimension is partitioned among work-groups if k/(m*n) is at least 1/XGEMM_SPLITK_RATIO
+// (0 disables it), with each partition holding at least 'XGEMM_SPLITK_MIN_K' values of k. For
+// complex precisions in the fast accuracy mode, the 3M algorithm is used if m*n*k is at least
+// 'XGEMM_MIN_3M_SIZE' to the power of three (0 disables it, as for the real precisions). Also in
+// the fast accuracy mode, the Strassen-Winograd recursion is used if m, n, and k are all at least
+// 'XGEMM_MIN_STRASSEN_SIZE' (0 disables it, as for half-precision).
+//
+// =================================================================================================
+
+namespace clblast {
+// =================================================================================================
+
+const Database::DatabaseEntry Database::GemmRoutineHalf = {
+  "GemmRoutine", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kXGEMM_MIN_INDIRECT_SIZE,384}, {kXGEMM_SPLITK_MIN_K,1024}, {kXGEMM_SPLITK_RATIO,4}, {kXGEMM_MIN_3M_SIZE,0}, {kXGEMM_MIN_STRASSEN_SIZE,0} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry Database::GemmRoutineSingle = {
+  "GemmRoutine", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kXGEMM_MIN_INDIRECT_SIZE,384}, {kXGEMM_SPLITK_MIN_K,1024}, {kXGEMM_SPLITK_RATIO,4}, {kXGEMM_MIN_3M_SIZE,0}, {kXGEMM_MIN_STRASSEN_SIZE,4096} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry Database::GemmRoutineDouble = {
+  "GemmRoutine", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kXGEMM_MIN_INDIRECT_SIZE,384}, {kXGEMM_SPLITK_MIN_K,1024}, {kXGEMM_SPLITK_RATIO,4}, {kXGEMM_MIN_3M_SIZE,0}, {kXGEMM_MIN_STRASSEN_SIZE,4096} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry Database::GemmRoutineComplexSingle = {
+  "GemmRoutine", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kXGEMM_MIN_INDIRECT_SIZE,384}, {kXGEMM_SPLITK_MIN_K,1024}, {kXGEMM_SPLITK_RATIO,4}, {kXGEMM_MIN_3M_SIZE,1024}, {kXGEMM_MIN_STRASSEN_SIZE,4096} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry Database::GemmRoutineComplexDouble = {
+  "GemmRoutine", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kXGEMM_MIN_INDIRECT_SIZE,384}, {kXGEMM_SPLITK_MIN_K,1024}, {kXGEMM_SPLITK_RATIO,4}, {kXGEMM_MIN_3M_SIZE,1024}, {kXGEMM_MIN_STRASSEN_SIZE,4096} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
@@ -14,60 +14,72 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::PadHalf = {
+  "Pad", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::PadSingle = {
   "Pad", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Hawaii",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "Pitcairn",                                        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tahiti",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Hawaii",                                          { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,4} } },
+        { "Pitcairn",                                        { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "Tahiti",                                          { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
+        { "Mali-T628",                                       { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,4} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,4} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PAD_DIMX",16}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kPAD_DIMX,32}, {kPAD_DIMY,16}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kPAD_DIMX,16}, {kPAD_DIMY,32}, {kPAD_WPTX,4}, {kPAD_WPTY,4} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Iris Pro",                                        { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
+        { "Iris",                                            { {kPAD_DIMX,32}, {kPAD_DIMY,16}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "Iris Pro",                                        { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kPAD_DIMX,32}, {kPAD_DIMY,16}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,16}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "GeForce GTX 680",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 980",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN",                               { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN X",                             { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tesla K20m",                                      { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Tesla K40m",                                      { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "GeForce GTX 480",                                 { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,4} } },
+        { "GeForce GTX 680",                                 { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 750 Ti",                              { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 980",                                 { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX TITAN",                               { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "GeForce GTX TITAN X",                             { {kPAD_DIMX,16}, {kPAD_DIMY,16}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Tesla K20m",                                      { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "Tesla K40m",                                      { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "default",                                         { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
   }
@@ -79,56 +91,56 @@ const Database::DatabaseEntry Database::PadComplexSingle = {
   "Pad", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Hawaii",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Pitcairn",                                        { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tahiti",                                          { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Hawaii",                                          { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "Pitcairn",                                        { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "Tahiti",                                          { {kPAD_DIMX,16}, {kPAD_DIMY,16}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
+        { "Mali-T628",                                       { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,4} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,4} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,2} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kPAD_DIMX,32}, {kPAD_DIMY,32}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kPAD_DIMX,32}, {kPAD_DIMY,16}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",4} } },
-        { "Iris Pro",                                        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
+        { "Iris",                                            { {kPAD_DIMX,32}, {kPAD_DIMY,16}, {kPAD_WPTX,2}, {kPAD_WPTY,4} } },
+        { "Iris Pro",                                        { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 680",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 980",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN",                               { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN X",                             { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tesla K20m",                                      { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tesla K40m",                                      { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "GeForce GTX 480",                                 { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 680",                                 { {kPAD_DIMX,16}, {kPAD_DIMY,32}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "GeForce GTX 750 Ti",                              { {kPAD_DIMX,16}, {kPAD_DIMY,16}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 980",                                 { {kPAD_DIMX,16}, {kPAD_DIMY,16}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX TITAN",                               { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "GeForce GTX TITAN X",                             { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Tesla K20m",                                      { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "Tesla K40m",                                      { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "default",                                         { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
   }
@@ -140,49 +152,49 @@ const Database::DatabaseEntry Database::PadDouble = {
   "Pad", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Hawaii",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Pitcairn",                                        { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tahiti",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Hawaii",                                          { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "Pitcairn",                                        { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "Tahiti",                                          { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
+        { "Mali-T628",                                       { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,2} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kPAD_DIMX,32}, {kPAD_DIMY,32}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 680",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 980",                                 { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN",                               { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN X",                             { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tesla K20m",                                      { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tesla K40m",                                      { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "GeForce GTX 480",                                 { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 680",                                 { {kPAD_DIMX,32}, {kPAD_DIMY,32}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "GeForce GTX 750 Ti",                              { {kPAD_DIMX,8}, {kPAD_DIMY,16}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 980",                                 { {kPAD_DIMX,8}, {kPAD_DIMY,16}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX TITAN",                               { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX TITAN X",                             { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Tesla K20m",                                      { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Tesla K40m",                                      { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "default",                                         { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "default",                                         { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
   }
@@ -194,49 +206,49 @@ const Database::DatabaseEntry Database::PadComplexDouble = {
   "Pad", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Hawaii",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Pitcairn",                                        { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tahiti",                                          { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Hawaii",                                          { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Pitcairn",                                        { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Tahiti",                                          { {kPAD_DIMX,8}, {kPAD_DIMY,16}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
+        { "Mali-T628",                                       { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PAD_DIMX",16}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kPAD_DIMX,16}, {kPAD_DIMY,32}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,2}, {kPAD_WPTY,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,32}, {kPAD_DIMY,8}, {kPAD_WPTX,4}, {kPAD_WPTY,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 680",                                 { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 980",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN",                               { {"PAD_DIMX",8}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX TITAN X",                             { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tesla K20m",                                      { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tesla K40m",                                      { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "GeForce GTX 480",                                 { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 680",                                 { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 750 Ti",                              { {kPAD_DIMX,32}, {kPAD_DIMY,32}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX 980",                                 { {kPAD_DIMX,16}, {kPAD_DIMY,16}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "GeForce GTX TITAN",                               { {kPAD_DIMX,8}, {kPAD_DIMY,32}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "GeForce GTX TITAN X",                             { {kPAD_DIMX,16}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "Tesla K20m",                                      { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,2} } },
+        { "Tesla K40m",                                      { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
+        { "default",                                         { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
+        { "default",                                         { {kPAD_DIMX,8}, {kPAD_DIMY,8}, {kPAD_WPTX,1}, {kPAD_WPTY,1} } },
       }
     },
   }
@@ -14,60 +14,72 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::PadtransposeHalf = {
+  "Padtranspose", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::PadtransposeSingle = {
   "Padtranspose", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,4} } },
+        { "Hawaii",                                          { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,4} } },
+        { "Pitcairn",                                        { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,4} } },
+        { "Tahiti",                                          { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,4} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,4} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
+        { "Mali-T628",                                       { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kPADTRA_PAD,0}, {kPADTRA_TILE,32}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Iris Pro",                                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Iris",                                            { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "Iris Pro",                                        { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "GeForce GTX 680",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "GeForce GTX 750 Ti",                              { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,2} } },
+        { "GeForce GTX 980",                                 { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "GeForce GTX TITAN X",                             { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,1} } },
+        { "Tesla K20m",                                      { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "Tesla K40m",                                      { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
       }
     },
   }
@@ -79,56 +91,56 @@ const Database::DatabaseEntry Database::PadtransposeComplexSingle = {
   "Padtranspose", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,4} } },
+        { "Hawaii",                                          { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "Pitcairn",                                        { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "Tahiti",                                          { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,2} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Mali-T628",                                       { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kPADTRA_PAD,1}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Iris Pro",                                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Iris",                                            { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "Iris Pro",                                        { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX 680",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX 980",                                 { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,1} } },
+        { "Tesla K20m",                                      { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "Tesla K40m",                                      { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
       }
     },
   }
@@ -140,49 +152,49 @@ const Database::DatabaseEntry Database::PadtransposeDouble = {
   "Padtranspose", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,4} } },
+        { "Hawaii",                                          { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "Pitcairn",                                        { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "Tahiti",                                          { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,2} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
+        { "Mali-T628",                                       { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kPADTRA_PAD,1}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX 680",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,2} } },
+        { "GeForce GTX 980",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,1} } },
+        { "Tesla K20m",                                      { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "Tesla K40m",                                      { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
       }
     },
   }
@@ -194,49 +206,49 @@ const Database::DatabaseEntry Database::PadtransposeComplexDouble = {
   "Padtranspose", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "Hawaii",                                          { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "Pitcairn",                                        { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "Tahiti",                                          { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,2} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,2} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "Mali-T628",                                       { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kPADTRA_PAD,1}, {kPADTRA_TILE,8}, {kPADTRA_WPT,2} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kPADTRA_PAD,1}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kPADTRA_PAD,1}, {kPADTRA_TILE,8}, {kPADTRA_WPT,4} } },
+        { "default",                                         { {kPADTRA_PAD,1}, {kPADTRA_TILE,8}, {kPADTRA_WPT,2} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX 680",                                 { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,2} } },
+        { "GeForce GTX 980",                                 { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kPADTRA_PAD,1}, {kPADTRA_TILE,32}, {kPADTRA_WPT,1} } },
+        { "Tesla K20m",                                      { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "Tesla K40m",                                      { {kPADTRA_PAD,1}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,16}, {kPADTRA_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
+        { "default",                                         { {kPADTRA_PAD,0}, {kPADTRA_TILE,8}, {kPADTRA_WPT,1} } },
       }
     },
   }
@@ -14,60 +14,72 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::TransposeHalf = {
+  "Transpose", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::TransposeSingle = {
   "Transpose", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Hawaii",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Pitcairn",                                        { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,8} } },
+        { "Hawaii",                                          { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,8} } },
+        { "Pitcairn",                                        { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "Tahiti",                                          { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,4} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
+        { "Mali-T628",                                       { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,4} } },
+        { "default",                                         { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,4} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,8} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,8} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,8} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Iris Pro",                                        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
+        { "Iris",                                            { {kTRA_DIM,8}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "Iris Pro",                                        { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "default",                                         { {kTRA_DIM,8}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "default",                                         { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "GeForce GTX 680",                                 { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,2} } },
+        { "GeForce GTX 750 Ti",                              { {kTRA_DIM,32}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "GeForce GTX 980",                                 { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kTRA_DIM,8}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "GeForce GTX TITAN X",                             { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "Tesla K20m",                                      { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "Tesla K40m",                                      { {kTRA_DIM,8}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "default",                                         { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
   }
@@ -79,50 +91,50 @@ const Database::DatabaseEntry Database::TransposeComplexSingle = {
   "Transpose", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Hawaii",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Pitcairn",                                        { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kTRA_DIM,4}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,4} } },
+        { "Hawaii",                                          { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "Pitcairn",                                        { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "Tahiti",                                          { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
+        { "Mali-T628",                                       { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "default",                                         { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kTRA_DIM,4}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Iris Pro",                                        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
+        { "Iris",                                            { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "Iris Pro",                                        { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "default",                                         { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX 680",                                 { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX 980",                                 { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kTRA_DIM,32}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "Tesla K20m",                                      { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "Tesla K40m",                                      { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "default",                                         { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
   }
@@ -134,49 +146,49 @@ const Database::DatabaseEntry Database::TransposeDouble = {
   "Transpose", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Hawaii",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Pitcairn",                                        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Tahiti",                                          { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,4} } },
+        { "Hawaii",                                          { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "Pitcairn",                                        { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,2} } },
+        { "Tahiti",                                          { {kTRA_DIM,4}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,4} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "Mali-T628",                                       { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "default",                                         { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kTRA_DIM,4}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,8} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kTRA_DIM,32}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "default",                                         { {kTRA_DIM,32}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kTRA_DIM,8}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "GeForce GTX 680",                                 { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,2} } },
+        { "GeForce GTX 750 Ti",                              { {kTRA_DIM,32}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX 980",                                 { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "GeForce GTX TITAN",                               { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "GeForce GTX TITAN X",                             { {kTRA_DIM,32}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "Tesla K20m",                                      { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "Tesla K40m",                                      { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,2} } },
+        { "default",                                         { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
   }
@@ -188,43 +200,43 @@ const Database::DatabaseEntry Database::TransposeComplexDouble = {
   "Transpose", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Hawaii",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Pitcairn",                                        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kTRA_DIM,4}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,2} } },
+        { "Hawaii",                                          { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,2} } },
+        { "Pitcairn",                                        { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "Tahiti",                                          { {kTRA_DIM,16}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "Mali-T628",                                       { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "default",                                         { {kTRA_DIM,8}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kTRA_DIM,4}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,4} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,2} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "GeForce GTX 480",                                 { {kTRA_DIM,8}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX 680",                                 { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,1}, {kTRA_WPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX 980",                                 { {kTRA_DIM,32}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX TITAN",                               { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kTRA_DIM,32}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "Tesla K20m",                                      { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "Tesla K40m",                                      { {kTRA_DIM,16}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
+        { "default",                                         { {kTRA_DIM,8}, {kTRA_PAD,1}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
+        { "default",                                         { {kTRA_DIM,4}, {kTRA_PAD,0}, {kTRA_SHUFFLE,0}, {kTRA_WPT,1} } },
       }
     },
   }
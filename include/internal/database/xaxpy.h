@@ -14,60 +14,72 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::XaxpyHalf = {
+  "Xaxpy", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::XaxpySingle = {
   "Xaxpy", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Hawaii",                                          { {"VW",2}, {"WGS",64}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "Hawaii",                                          { {kVW,2}, {kWGS,64}, {kWPT,2} } },
+        { "Pitcairn",                                        { {kVW,2}, {kWGS,128}, {kWPT,1} } },
+        { "Tahiti",                                          { {kVW,2}, {kWGS,64}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
+        { "Mali-T628",                                       { {kVW,4}, {kWGS,256}, {kWPT,1} } },
+        { "default",                                         { {kVW,4}, {kWGS,256}, {kWPT,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kVW,1}, {kWGS,512}, {kWPT,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kVW,4}, {kWGS,256}, {kWPT,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,128}, {kWPT,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Iris Pro",                                        { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "Iris",                                            { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "Iris Pro",                                        { {kVW,1}, {kWGS,128}, {kWPT,2} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",2}, {"WGS",1024}, {"WPT",2} } },
-        { "default",                                         { {"VW",2}, {"WGS",1024}, {"WPT",2} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kVW,2}, {kWGS,1024}, {kWPT,2} } },
+        { "default",                                         { {kVW,2}, {kWGS,1024}, {kWPT,2} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"VW",4}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",4}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",4}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "GeForce GTX 480",                                 { {kVW,4}, {kWGS,64}, {kWPT,1} } },
+        { "GeForce GTX 680",                                 { {kVW,2}, {kWGS,64}, {kWPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
+        { "GeForce GTX 980",                                 { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
+        { "GeForce GTX TITAN",                               { {kVW,4}, {kWGS,256}, {kWPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "Tesla K20m",                                      { {kVW,4}, {kWGS,128}, {kWPT,1} } },
+        { "Tesla K40m",                                      { {kVW,4}, {kWGS,128}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
   }
@@ -79,56 +91,56 @@ const Database::DatabaseEntry Database::XaxpyComplexSingle = {
   "Xaxpy", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",2}, {"WGS",64}, {"WPT",8} } },
-        { "Hawaii",                                          { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kVW,2}, {kWGS,64}, {kWPT,8} } },
+        { "Hawaii",                                          { {kVW,1}, {kWGS,128}, {kWPT,2} } },
+        { "Pitcairn",                                        { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "Tahiti",                                          { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",256}, {"WPT",1} } },
+        { "Mali-T628",                                       { {kVW,1}, {kWGS,256}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,256}, {kWPT,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",1}, {"WGS",1024}, {"WPT",2} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",256}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kVW,4}, {kWGS,256}, {kWPT,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kVW,1}, {kWGS,1024}, {kWPT,2} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kVW,2}, {kWGS,1024}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,256}, {kWPT,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Iris Pro",                                        { {"VW",1}, {"WGS",256}, {"WPT",8} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
+        { "Iris",                                            { {kVW,2}, {kWGS,128}, {kWPT,1} } },
+        { "Iris Pro",                                        { {kVW,1}, {kWGS,256}, {kWPT,8} } },
+        { "default",                                         { {kVW,1}, {kWGS,128}, {kWPT,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "GeForce GTX 480",                                 { {kVW,1}, {kWGS,256}, {kWPT,1} } },
+        { "GeForce GTX 680",                                 { {kVW,1}, {kWGS,256}, {kWPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kVW,1}, {kWGS,512}, {kWPT,1} } },
+        { "GeForce GTX 980",                                 { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "GeForce GTX TITAN",                               { {kVW,1}, {kWGS,256}, {kWPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kVW,1}, {kWGS,512}, {kWPT,1} } },
+        { "Tesla K20m",                                      { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "Tesla K40m",                                      { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
   }
@@ -140,49 +152,49 @@ const Database::DatabaseEntry Database::XaxpyDouble = {
   "Xaxpy", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "Hawaii",                                          { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kVW,1}, {kWGS,256}, {kWPT,1} } },
+        { "Hawaii",                                          { {kVW,1}, {kWGS,64}, {kWPT,2} } },
+        { "Pitcairn",                                        { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "Tahiti",                                          { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",2}, {"WGS",128}, {"WPT",2} } },
-        { "default",                                         { {"VW",2}, {"WGS",128}, {"WPT",2} } },
+        { "Mali-T628",                                       { {kVW,2}, {kWGS,128}, {kWPT,2} } },
+        { "default",                                         { {kVW,2}, {kWGS,128}, {kWPT,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",8}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",8}, {"WGS",2048}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kVW,8}, {kWGS,64}, {kWPT,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kVW,8}, {kWGS,2048}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",2}, {"WGS",512}, {"WPT",1} } },
-        { "default",                                         { {"VW",2}, {"WGS",512}, {"WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kVW,2}, {kWGS,512}, {kWPT,1} } },
+        { "default",                                         { {kVW,2}, {kWGS,512}, {kWPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "GeForce GTX 480",                                 { {kVW,2}, {kWGS,64}, {kWPT,1} } },
+        { "GeForce GTX 680",                                 { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "GeForce GTX 980",                                 { {kVW,1}, {kWGS,256}, {kWPT,1} } },
+        { "GeForce GTX TITAN",                               { {kVW,2}, {kWGS,1024}, {kWPT,1} } },
+        { "GeForce GTX TITAN X",                             { {kVW,1}, {kWGS,512}, {kWPT,1} } },
+        { "Tesla K20m",                                      { {kVW,2}, {kWGS,128}, {kWPT,1} } },
+        { "Tesla K40m",                                      { {kVW,2}, {kWGS,128}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
   }
@@ -194,49 +206,49 @@ const Database::DatabaseEntry Database::XaxpyComplexDouble = {
   "Xaxpy", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Hawaii",                                          { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "Hawaii",                                          { {kVW,2}, {kWGS,64}, {kWPT,1} } },
+        { "Pitcairn",                                        { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "Tahiti",                                          { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",1}, {"WGS",64}, {"WPT",8} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",8} } },
+        { "Mali-T628",                                       { {kVW,1}, {kWGS,64}, {kWPT,8} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,8} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",8}, {"WGS",128}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",8}, {"WGS",512}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kVW,8}, {kWGS,128}, {kWPT,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kVW,8}, {kWGS,512}, {kWPT,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kVW,1}, {kWGS,256}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,128}, {kWPT,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",256}, {"WPT",2} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",1}, {"WGS",64}, {"WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "GeForce GTX 480",                                 { {kVW,1}, {kWGS,128}, {kWPT,1} } },
+        { "GeForce GTX 680",                                 { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "GeForce GTX 750 Ti",                              { {kVW,1}, {kWGS,256}, {kWPT,2} } },
+        { "GeForce GTX 980",                                 { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
+        { "GeForce GTX TITAN",                               { {kVW,1}, {kWGS,64}, {kWPT,4} } },
+        { "GeForce GTX TITAN X",                             { {kVW,1}, {kWGS,1024}, {kWPT,1} } },
+        { "Tesla K20m",                                      { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "Tesla K40m",                                      { {kVW,1}, {kWGS,64}, {kWPT,1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
+        { "default",                                         { {kVW,1}, {kWGS,64}, {kWPT,1} } },
       }
     },
   }
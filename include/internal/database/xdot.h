@@ -14,42 +14,54 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::XdotHalf = {
+  "Xdot", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kWGS1,128}, {kWGS2,32} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::XdotSingle = {
   "Xdot", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",128}, {"WGS2",32} } },
-        { "Hawaii",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",128}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,128}, {kWGS2,32} } },
+        { "Hawaii",                                          { {kWGS1,256}, {kWGS2,32} } },
+        { "Pitcairn",                                        { {kWGS1,128}, {kWGS2,32} } },
+        { "Tahiti",                                          { {kWGS1,128}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,128}, {kWGS2,32} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",1024}, {"WGS2",32} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,1024}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,1024}, {kWGS2,32} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris Pro",                                        { {"WGS1",512}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",512}, {"WGS2",64} } },
+        { "Iris Pro",                                        { {kWGS1,512}, {kWGS2,64} } },
+        { "default",                                         { {kWGS1,512}, {kWGS2,64} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",128} } },
-        { "GeForce GTX 980",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",1024}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "GeForce GTX 480",                                 { {kWGS1,512}, {kWGS2,32} } },
+        { "GeForce GTX 680",                                 { {kWGS1,128}, {kWGS2,128} } },
+        { "GeForce GTX 980",                                 { {kWGS1,256}, {kWGS2,32} } },
+        { "GeForce GTX TITAN X",                             { {kWGS1,256}, {kWGS2,32} } },
+        { "Tesla K20m",                                      { {kWGS1,1024}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,128}, {kWGS2,32} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "default",                                         { {kWGS1,128}, {kWGS2,32} } },
       }
     },
   }
@@ -61,38 +73,38 @@ const Database::DatabaseEntry Database::XdotComplexSingle = {
   "Xdot", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",32} } },
-        { "Hawaii",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,64}, {kWGS2,32} } },
+        { "Hawaii",                                          { {kWGS1,256}, {kWGS2,32} } },
+        { "Pitcairn",                                        { {kWGS1,256}, {kWGS2,32} } },
+        { "Tahiti",                                          { {kWGS1,64}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,32} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",1024}, {"WGS2",32} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,1024}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,1024}, {kWGS2,32} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris Pro",                                        { {"WGS1",32}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",32} } },
+        { "Iris Pro",                                        { {kWGS1,32}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,32}, {kWGS2,32} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 980",                                 { {"WGS1",256}, {"WGS2",64} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",512}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "GeForce GTX 480",                                 { {kWGS1,512}, {kWGS2,32} } },
+        { "GeForce GTX 680",                                 { {kWGS1,128}, {kWGS2,64} } },
+        { "GeForce GTX 980",                                 { {kWGS1,256}, {kWGS2,64} } },
+        { "GeForce GTX TITAN X",                             { {kWGS1,256}, {kWGS2,32} } },
+        { "Tesla K20m",                                      { {kWGS1,512}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,128}, {kWGS2,32} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",32}, {"WGS2",32} } },
+        { "default",                                         { {kWGS1,32}, {kWGS2,32} } },
       }
     },
   }
@@ -104,32 +116,32 @@ const Database::DatabaseEntry Database::XdotDouble = {
   "Xdot", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",128} } },
-        { "Hawaii",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,64}, {kWGS2,128} } },
+        { "Hawaii",                                          { {kWGS1,256}, {kWGS2,32} } },
+        { "Pitcairn",                                        { {kWGS1,128}, {kWGS2,32} } },
+        { "Tahiti",                                          { {kWGS1,256}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,32} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",512}, {"WGS2",64} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,512}, {kWGS2,64} } },
+        { "default",                                         { {kWGS1,512}, {kWGS2,64} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 980",                                 { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",512}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
+        { "GeForce GTX 480",                                 { {kWGS1,512}, {kWGS2,32} } },
+        { "GeForce GTX 680",                                 { {kWGS1,128}, {kWGS2,64} } },
+        { "GeForce GTX 980",                                 { {kWGS1,128}, {kWGS2,32} } },
+        { "GeForce GTX TITAN X",                             { {kWGS1,256}, {kWGS2,32} } },
+        { "Tesla K20m",                                      { {kWGS1,512}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,128}, {kWGS2,32} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,32} } },
       }
     },
   }
@@ -141,32 +153,32 @@ const Database::DatabaseEntry Database::XdotComplexDouble = {
   "Xdot", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",32} } },
-        { "Hawaii",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,64}, {kWGS2,32} } },
+        { "Hawaii",                                          { {kWGS1,256}, {kWGS2,32} } },
+        { "Pitcairn",                                        { {kWGS1,256}, {kWGS2,32} } },
+        { "Tahiti",                                          { {kWGS1,256}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,32} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",1024}, {"WGS2",32} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,1024}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,1024}, {kWGS2,32} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 680",                                 { {"WGS1",256}, {"WGS2",64} } },
-        { "GeForce GTX 980",                                 { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",128}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",128}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
+        { "GeForce GTX 480",                                 { {kWGS1,512}, {kWGS2,32} } },
+        { "GeForce GTX 680",                                 { {kWGS1,256}, {kWGS2,64} } },
+        { "GeForce GTX 980",                                 { {kWGS1,64}, {kWGS2,32} } },
+        { "GeForce GTX TITAN X",                             { {kWGS1,128}, {kWGS2,32} } },
+        { "Tesla K20m",                                      { {kWGS1,128}, {kWGS2,32} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,32} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,32} } },
       }
     },
   }
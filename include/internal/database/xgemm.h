@@ -14,60 +14,72 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::XgemmHalf = {
+  "Xgemm", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::XgemmSingle = {
   "Xgemm", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",8} } },
-        { "Hawaii",                                          { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",2} } },
-        { "Pitcairn",                                        { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tahiti",                                          { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,2}, {kVWN,8} } },
+        { "Hawaii",                                          { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,32}, {kMWG,128}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,4}, {kVWN,2} } },
+        { "Pitcairn",                                        { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "Tahiti",                                          { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,32}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,4}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",8}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",8}, {"VWN",1} } },
+        { "Mali-T628",                                       { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,16}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,8}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,16}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,8}, {kVWN,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"KWG",32}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,2}, {kVWN,2} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,8}, {kMWG,128}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,128}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,32}, {kNWG,64}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",1} } },
-        { "Iris Pro",                                        { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",4}, {"VWN",4} } },
-        { "default",                                         { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",4}, {"VWN",1} } },
+        { "Iris",                                            { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,128}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,4}, {kVWN,1} } },
+        { "Iris Pro",                                        { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,1}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,4}, {kVWN,4} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,1}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,4}, {kVWN,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX 680",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",4}, {"VWN",2} } },
-        { "GeForce GTX 750 Ti",                              { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",4} } },
-        { "GeForce GTX 980",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",4}, {"VWN",8} } },
-        { "GeForce GTX TITAN",                               { {"KWG",16}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX TITAN X",                             { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",8} } },
-        { "Tesla K20m",                                      { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "Tesla K40m",                                      { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
+        { "GeForce GTX 480",                                 { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,2} } },
+        { "GeForce GTX 680",                                 { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,128}, {kSA,1}, {kSB,1}, {kSTRM,0}, {kSTRN,0}, {kVWM,4}, {kVWN,2} } },
+        { "GeForce GTX 750 Ti",                              { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,16}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,128}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,4}, {kVWN,4} } },
+        { "GeForce GTX 980",                                 { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,128}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,4}, {kVWN,8} } },
+        { "GeForce GTX TITAN",                               { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,32}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,2}, {kVWN,2} } },
+        { "GeForce GTX TITAN X",                             { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,128}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,128}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,4}, {kVWN,8} } },
+        { "Tesla K20m",                                      { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,2}, {kVWN,4} } },
+        { "Tesla K40m",                                      { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,128}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,2}, {kVWN,4} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,0}, {kSTRN,0}, {kVWM,2}, {kVWN,2} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
   }
@@ -79,56 +91,56 @@ const Database::DatabaseEntry Database::XgemmComplexSingle = {
   "Xgemm", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "Hawaii",                                          { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Pitcairn",                                        { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",4}, {"VWN",2} } },
-        { "Tahiti",                                          { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,8} } },
+        { "Hawaii",                                          { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,32}, {kSA,1}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "Pitcairn",                                        { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,4}, {kVWN,2} } },
+        { "Tahiti",                                          { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,32}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,1}, {kVWM,2}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",8}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",8}, {"VWN",1} } },
+        { "Mali-T628",                                       { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,1}, {kVWM,8}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,1}, {kVWM,8}, {kVWN,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,16}, {kMWG,32}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,64}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,32}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,1}, {kVWN,4} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"KWG",32}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Iris Pro",                                        { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "Iris",                                            { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,32}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,64}, {kSA,1}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "Iris Pro",                                        { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,32}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,1}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,1}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,128}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,128}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX 680",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX 750 Ti",                              { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "GeForce GTX 980",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",1} } },
-        { "GeForce GTX TITAN",                               { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX TITAN X",                             { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",4} } },
-        { "Tesla K20m",                                      { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Tesla K40m",                                      { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "GeForce GTX 480",                                 { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,128}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,2} } },
+        { "GeForce GTX 680",                                 { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,32}, {kNWG,128}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,2}, {kVWN,2} } },
+        { "GeForce GTX 750 Ti",                              { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,8}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,32}, {kNWG,128}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
+        { "GeForce GTX 980",                                 { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,64}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,2}, {kVWN,1} } },
+        { "GeForce GTX TITAN",                               { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "GeForce GTX TITAN X",                             { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,1}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,1}, {kVWN,4} } },
+        { "Tesla K20m",                                      { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,64}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
+        { "Tesla K40m",                                      { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,1}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
   }
@@ -140,49 +152,49 @@ const Database::DatabaseEntry Database::XgemmDouble = {
   "Xgemm", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "Hawaii",                                          { {"KWG",16}, {"KWI",8}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "Pitcairn",                                        { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Tahiti",                                          { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,8} } },
+        { "Hawaii",                                          { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,32}, {kMDIMC,8}, {kMWG,128}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,1}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
+        { "Pitcairn",                                        { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,16}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
+        { "Tahiti",                                          { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,1}, {kVWM,1}, {kVWN,4} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",8}, {"VWN",2} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",8}, {"VWN",2} } },
+        { "Mali-T628",                                       { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,16}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,8}, {kVWN,2} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,16}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,8}, {kVWN,2} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",1}, {"VWN",8} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,16}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,64}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,128}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,1}, {kVWM,2}, {kVWN,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,1}, {kVWN,8} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,128}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "default",                                         { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "GeForce GTX 680",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",2}, {"VWN",4} } },
-        { "GeForce GTX 750 Ti",                              { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",1} } },
-        { "GeForce GTX 980",                                 { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",32}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "GeForce GTX TITAN",                               { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",1}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX TITAN X",                             { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tesla K20m",                                      { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tesla K40m",                                      { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",128}, {"SA",1}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",4} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "GeForce GTX 480",                                 { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,64}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
+        { "GeForce GTX 680",                                 { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,16}, {kNDIMC,32}, {kNWG,128}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,1}, {kVWM,2}, {kVWN,4} } },
+        { "GeForce GTX 750 Ti",                              { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,16}, {kNDIMC,32}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,1} } },
+        { "GeForce GTX 980",                                 { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,32}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,2}, {kVWN,4} } },
+        { "GeForce GTX TITAN",                               { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,16}, {kNDIMC,32}, {kNWG,128}, {kSA,1}, {kSB,1}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,2} } },
+        { "GeForce GTX TITAN X",                             { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,16}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "Tesla K20m",                                      { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,64}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "Tesla K40m",                                      { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,16}, {kNDIMC,32}, {kNWG,128}, {kSA,1}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,4} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,16}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,16}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
   }
@@ -194,48 +206,48 @@ const Database::DatabaseEntry Database::XgemmComplexDouble = {
   "Xgemm", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",16}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "Hawaii",                                          { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",1}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "Pitcairn",                                        { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",32}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tahiti",                                          { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,8}, {kMDIMC,16}, {kMWG,32}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,2} } },
+        { "Hawaii",                                          { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,32}, {kSA,1}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
+        { "Pitcairn",                                        { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,32}, {kNWG,32}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "Tahiti",                                          { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,16}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,16}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",8}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",8}, {"VWN",1} } },
+        { "Mali-T628",                                       { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,8}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,8}, {kVWN,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",32}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",2}, {"VWN",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",128}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",1}, {"VWM",1}, {"VWN",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"KWG",32}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,32}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,64}, {kSA,0}, {kSB,1}, {kSTRM,0}, {kSTRN,0}, {kVWM,2}, {kVWN,4} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,128}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,1}, {kVWM,1}, {kVWN,8} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,8}, {kMDIMC,32}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,1}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,2} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",32}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",16}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,16}, {kNDIMB,16}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",32}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX 680",                                 { {"KWG",16}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",64}, {"NDIMB",16}, {"NDIMC",32}, {"NWG",32}, {"SA",0}, {"SB",1}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "GeForce GTX 750 Ti",                              { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",4} } },
-        { "GeForce GTX 980",                                 { {"KWG",16}, {"KWI",2}, {"MDIMA",16}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",8}, {"NDIMC",16}, {"NWG",128}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",1}, {"VWM",2}, {"VWN",2} } },
-        { "GeForce GTX TITAN X",                             { {"KWG",32}, {"KWI",8}, {"MDIMA",16}, {"MDIMC",16}, {"MWG",128}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tesla K20m",                                      { {"KWG",32}, {"KWI",2}, {"MDIMA",32}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",16}, {"NDIMC",16}, {"NWG",64}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "Tesla K40m",                                      { {"KWG",16}, {"KWI",8}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",32}, {"NDIMB",32}, {"NDIMC",16}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",1}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",32}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "GeForce GTX 480",                                 { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,32}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "GeForce GTX 680",                                 { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,64}, {kNDIMB,16}, {kNDIMC,32}, {kNWG,32}, {kSA,0}, {kSB,1}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "GeForce GTX 750 Ti",                              { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,4} } },
+        { "GeForce GTX 980",                                 { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,16}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,8}, {kNDIMC,16}, {kNWG,128}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,1}, {kVWM,2}, {kVWN,2} } },
+        { "GeForce GTX TITAN X",                             { {kDBUF,0}, {kKWG,32}, {kKWI,8}, {kMDIMA,16}, {kMDIMC,16}, {kMWG,128}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "Tesla K20m",                                      { {kDBUF,0}, {kKWG,32}, {kKWI,2}, {kMDIMA,32}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,16}, {kNDIMC,16}, {kNWG,64}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "Tesla K40m",                                      { {kDBUF,0}, {kKWG,16}, {kKWI,8}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,32}, {kNDIMB,32}, {kNDIMC,16}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,1}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,32}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWG",16}, {"KWI",2}, {"MDIMA",8}, {"MDIMC",8}, {"MWG",16}, {"NDIMB",8}, {"NDIMC",8}, {"NWG",16}, {"SA",0}, {"SB",0}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } },
+        { "default",                                         { {kDBUF,0}, {kKWG,16}, {kKWI,2}, {kMDIMA,8}, {kMDIMC,8}, {kMWG,16}, {kNDIMB,8}, {kNDIMC,8}, {kNWG,16}, {kSA,0}, {kSB,0}, {kSTRM,0}, {kSTRN,0}, {kVWM,1}, {kVWN,1} } },
       }
     },
   }
@@ -0,0 +1,76 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Database generator <database.py>
+//
+// This file populates the database with best-found tuning parameters for the 'XgemmDirectBatched' kernels.
+//
+// =================================================================================================
+
+namespace clblast {
+// =================================================================================================
+
+const Database::DatabaseEntry Database::XgemmDirectBatchedHalf = {
+  "XgemmDirectBatched", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kKWID,2}, {kMDIMAD,8}, {kMDIMCD,8}, {kNDIMBD,8}, {kNDIMCD,8}, {kPADA,1}, {kPADB,1}, {kWGD,16} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry Database::XgemmDirectBatchedSingle = {
+  "XgemmDirectBatched", Precision::kSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kKWID,2}, {kMDIMAD,8}, {kMDIMCD,8}, {kNDIMBD,8}, {kNDIMCD,8}, {kPADA,1}, {kPADB,1}, {kWGD,16} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry Database::XgemmDirectBatchedDouble = {
+  "XgemmDirectBatched", Precision::kDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kKWID,2}, {kMDIMAD,8}, {kMDIMCD,8}, {kNDIMBD,8}, {kNDIMCD,8}, {kPADA,1}, {kPADB,1}, {kWGD,16} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry Database::XgemmDirectBatchedComplexSingle = {
+  "XgemmDirectBatched", Precision::kComplexSingle, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kKWID,2}, {kMDIMAD,8}, {kMDIMCD,8}, {kNDIMBD,8}, {kNDIMCD,8}, {kPADA,1}, {kPADB,1}, {kWGD,16} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
+const Database::DatabaseEntry Database::XgemmDirectBatchedComplexDouble = {
+  "XgemmDirectBatched", Precision::kComplexDouble, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kKWID,2}, {kMDIMAD,8}, {kMDIMCD,8}, {kNDIMBD,8}, {kNDIMCD,8}, {kPADA,1}, {kPADB,1}, {kWGD,16} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
@@ -14,53 +14,65 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::XgemvHalf = {
+  "Xgemv", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::XgemvSingle = {
   "Xgemv", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",128}, {"WPT1",1}, {"VW2",1}, {"WGS2",128}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,128}, {kWPT1,1}, {kVW2,1}, {kWGS2,128}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Hawaii",                                          { {kWGS1,128}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Pitcairn",                                        { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Tahiti",                                          { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,128}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",1}, {"VW2",4}, {"WGS2",128}, {"WPT2",4}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4}, {"VW2",1}, {"WGS2",64}, {"WPT2",4}, {"VW3",2}, {"WGS3",64}, {"WPT3",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",4}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,64}, {kWPT1,1}, {kVW2,4}, {kWGS2,128}, {kWPT2,4}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kWGS1,64}, {kWPT1,4}, {kVW2,1}, {kWGS2,64}, {kWPT2,4}, {kVW3,2}, {kWGS3,64}, {kWPT3,4} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,4}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"WGS1",64}, {"WPT1",2}, {"VW2",1}, {"WGS2",128}, {"WPT2",2}, {"VW3",4}, {"WGS3",64}, {"WPT3",8} } },
-        { "Iris Pro",                                        { {"WGS1",256}, {"WPT1",2}, {"VW2",1}, {"WGS2",128}, {"WPT2",2}, {"VW3",4}, {"WGS3",64}, {"WPT3",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",2}, {"VW2",1}, {"WGS2",128}, {"WPT2",2}, {"VW3",4}, {"WGS3",64}, {"WPT3",4} } },
+        { "Iris",                                            { {kWGS1,64}, {kWPT1,2}, {kVW2,1}, {kWGS2,128}, {kWPT2,2}, {kVW3,4}, {kWGS3,64}, {kWPT3,8} } },
+        { "Iris Pro",                                        { {kWGS1,256}, {kWPT1,2}, {kVW2,1}, {kWGS2,128}, {kWPT2,2}, {kVW3,4}, {kWGS3,64}, {kWPT3,4} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,2}, {kVW2,1}, {kWGS2,128}, {kWPT2,2}, {kVW3,4}, {kWGS3,64}, {kWPT3,4} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",128}, {"WPT2",1}, {"VW3",2}, {"WGS3",64}, {"WPT3",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",128}, {"WPT2",1}, {"VW3",2}, {"WGS3",128}, {"WPT3",2} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",4}, {"WGS3",128}, {"WPT3",4} } },
-        { "GeForce GTX 980",                                 { {"WGS1",128}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",1}, {"WGS3",128}, {"WPT3",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",1}, {"WGS3",256}, {"WPT3",1} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",128}, {"WPT3",1} } },
-        { "Tesla K20m",                                      { {"WGS1",128}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",1}, {"WGS3",256}, {"WPT3",1} } },
-        { "Tesla K40m",                                      { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",1}, {"WGS3",128}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "GeForce GTX 480",                                 { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,128}, {kWPT2,1}, {kVW3,2}, {kWGS3,64}, {kWPT3,2} } },
+        { "GeForce GTX 680",                                 { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,128}, {kWPT2,1}, {kVW3,2}, {kWGS3,128}, {kWPT3,2} } },
+        { "GeForce GTX 750 Ti",                              { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,4}, {kWGS3,128}, {kWPT3,4} } },
+        { "GeForce GTX 980",                                 { {kWGS1,128}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,1}, {kWGS3,128}, {kWPT3,1} } },
+        { "GeForce GTX TITAN",                               { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,1}, {kWGS3,256}, {kWPT3,1} } },
+        { "GeForce GTX TITAN X",                             { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,128}, {kWPT3,1} } },
+        { "Tesla K20m",                                      { {kWGS1,128}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,1}, {kWGS3,256}, {kWPT3,1} } },
+        { "Tesla K40m",                                      { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,1}, {kWGS3,128}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
   }
@@ -72,45 +84,45 @@ const Database::DatabaseEntry Database::XgemvComplexSingle = {
   "Xgemv", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1}, {"VW2",2}, {"WGS2",256}, {"WPT2",2}, {"VW3",1}, {"WGS3",128}, {"WPT3",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",2}, {"WGS3",64}, {"WPT3",2} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",128}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,64}, {kWPT1,1}, {kVW2,2}, {kWGS2,256}, {kWPT2,2}, {kVW3,1}, {kWGS3,128}, {kWPT3,1} } },
+        { "Hawaii",                                          { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Pitcairn",                                        { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,2}, {kWGS3,64}, {kWPT3,2} } },
+        { "Tahiti",                                          { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,128}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",128}, {"WPT1",1}, {"VW2",1}, {"WGS2",128}, {"WPT2",2}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4}, {"VW2",4}, {"WGS2",64}, {"WPT2",4}, {"VW3",2}, {"WGS3",64}, {"WPT3",2} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",2}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,128}, {kWPT1,1}, {kVW2,1}, {kWGS2,128}, {kWPT2,2}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kWGS1,64}, {kWPT1,4}, {kVW2,4}, {kWGS2,64}, {kWPT2,4}, {kVW3,2}, {kWGS3,64}, {kWPT3,2} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,2}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris",                                            { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Iris Pro",                                        { {"WGS1",64}, {"WPT1",1}, {"VW2",4}, {"WGS2",128}, {"WPT2",4}, {"VW3",2}, {"WGS3",64}, {"WPT3",2} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "Iris",                                            { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Iris Pro",                                        { {kWGS1,64}, {kWPT1,1}, {kVW2,4}, {kWGS2,128}, {kWPT2,4}, {kVW3,2}, {kWGS3,64}, {kWPT3,2} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "GeForce GTX 680",                                 { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "GeForce GTX 480",                                 { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "GeForce GTX 680",                                 { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "GeForce GTX 750 Ti",                              { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1} } },
+        { "GeForce GTX TITAN",                               { {kWGS1,256}, {kWPT1,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
   }
@@ -122,42 +134,42 @@ const Database::DatabaseEntry Database::XgemvDouble = {
   "Xgemv", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",1}, {"WGS3",128}, {"WPT3",1} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",2}, {"WGS3",64}, {"WPT3",2} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",2}, {"WGS3",64}, {"WPT3",2} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,1}, {kWGS3,128}, {kWPT3,1} } },
+        { "Hawaii",                                          { {kWGS1,128}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Pitcairn",                                        { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,2}, {kWGS3,64}, {kWPT3,2} } },
+        { "Tahiti",                                          { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,2}, {kWGS3,64}, {kWPT3,2} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",2}, {"VW2",4}, {"WGS2",128}, {"WPT2",4}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4}, {"VW2",1}, {"WGS2",64}, {"WPT2",4}, {"VW3",1}, {"WGS3",64}, {"WPT3",2} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",2}, {"VW2",1}, {"WGS2",64}, {"WPT2",4}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,64}, {kWPT1,2}, {kVW2,4}, {kWGS2,128}, {kWPT2,4}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kWGS1,64}, {kWPT1,4}, {kVW2,1}, {kWGS2,64}, {kWPT2,4}, {kVW3,1}, {kWGS3,64}, {kWPT3,2} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,2}, {kVW2,1}, {kWGS2,64}, {kWPT2,4}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WPT1",1}, {"VW2",1}, {"WGS2",128}, {"WPT2",1}, {"VW3",2}, {"WGS3",128}, {"WPT3",2} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",2}, {"WGS3",256}, {"WPT3",2} } },
-        { "GeForce GTX 980",                                 { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",1}, {"WGS3",256}, {"WPT3",1} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",128}, {"WPT2",1}, {"VW3",1}, {"WGS3",128}, {"WPT3",1} } },
-        { "Tesla K20m",                                      { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",128}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Tesla K40m",                                      { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",1}, {"WGS3",256}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "GeForce GTX 480",                                 { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "GeForce GTX 680",                                 { {kWGS1,128}, {kWPT1,1}, {kVW2,1}, {kWGS2,128}, {kWPT2,1}, {kVW3,2}, {kWGS3,128}, {kWPT3,2} } },
+        { "GeForce GTX 750 Ti",                              { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,2}, {kWGS3,256}, {kWPT3,2} } },
+        { "GeForce GTX 980",                                 { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "GeForce GTX TITAN",                               { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,1}, {kWGS3,256}, {kWPT3,1} } },
+        { "GeForce GTX TITAN X",                             { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,128}, {kWPT2,1}, {kVW3,1}, {kWGS3,128}, {kWPT3,1} } },
+        { "Tesla K20m",                                      { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,128}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Tesla K40m",                                      { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,1}, {kWGS3,256}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
   }
@@ -169,35 +181,35 @@ const Database::DatabaseEntry Database::XgemvComplexDouble = {
   "Xgemv", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",256}, {"WPT2",1}, {"VW3",1}, {"WGS3",128}, {"WPT3",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,256}, {kWPT2,1}, {kVW3,1}, {kWGS3,128}, {kWPT3,1} } },
+        { "Hawaii",                                          { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Pitcairn",                                        { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "Tahiti",                                          { {kWGS1,256}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",1}, {"VW2",2}, {"WGS2",64}, {"WPT2",4}, {"VW3",1}, {"WGS3",256}, {"WPT3",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4}, {"VW2",4}, {"WGS2",64}, {"WPT2",4}, {"VW3",2}, {"WGS3",256}, {"WPT3",2} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",2}, {"WGS2",64}, {"WPT2",4}, {"VW3",1}, {"WGS3",256}, {"WPT3",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,64}, {kWPT1,1}, {kVW2,2}, {kWGS2,64}, {kWPT2,4}, {kVW3,1}, {kWGS3,256}, {kWPT3,1} } },
+        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {kWGS1,64}, {kWPT1,4}, {kVW2,4}, {kWGS2,64}, {kWPT2,4}, {kVW3,2}, {kWGS3,256}, {kWPT3,2} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,2}, {kWGS2,64}, {kWPT2,4}, {kVW3,1}, {kWGS3,256}, {kWPT3,1} } },
       }
     },
     { // Intel accelerators
       kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "Intel(R) Many Integrated Core Acceleration Card", { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "GeForce GTX 480",                                 { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1}, {"VW2",1}, {"WGS2",64}, {"WPT2",1}, {"VW3",1}, {"WGS3",64}, {"WPT3",1} } },
+        { "default",                                         { {kWGS1,64}, {kWPT1,1}, {kVW2,1}, {kWGS2,64}, {kWPT2,1}, {kVW3,1}, {kWGS3,64}, {kWPT3,1} } },
       }
     },
   }
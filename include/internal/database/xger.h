@@ -14,47 +14,59 @@
 namespace clblast {
 // =================================================================================================
 
+const Database::DatabaseEntry Database::XgerHalf = {
+  "Xger", Precision::kHalf, {
+    { // Default
+      kDeviceTypeAll, "default", {
+        { "default",                                         { {kWGS1,32}, {kWGS2,1}, {kWPT,1} } },
+      }
+    },
+  }
+};
+
+// =================================================================================================
+
 const Database::DatabaseEntry Database::XgerSingle = {
   "Xger", Precision::kSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",256}, {"WGS2",1}, {"WPT",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",1}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,256}, {kWGS2,1}, {kWPT,1} } },
+        { "Hawaii",                                          { {kWGS1,64}, {kWGS2,2}, {kWPT,1} } },
+        { "Pitcairn",                                        { {kWGS1,64}, {kWGS2,1}, {kWPT,1} } },
+        { "Tahiti",                                          { {kWGS1,256}, {kWGS2,1}, {kWPT,1} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,1}, {kWPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",4}, {"WPT",4} } },
+        { "Mali-T628",                                       { {kWGS1,64}, {kWGS2,4}, {kWPT,4} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,4}, {kWPT,4} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",128}, {"WGS2",2}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",128}, {"WGS2",1}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",4} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,128}, {kWGS2,2}, {kWPT,4} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kWGS1,128}, {kWGS2,1}, {kWPT,4} } },
+        { "default",                                         { {kWGS1,128}, {kWGS2,1}, {kWPT,4} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris Pro",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
+        { "Iris Pro",                                        { {kWGS1,64}, {kWGS2,1}, {kWPT,4} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,1}, {kWPT,4} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",1}, {"WPT",4} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",1}, {"WPT",2} } },
+        { "GeForce GTX 480",                                 { {kWGS1,256}, {kWGS2,1}, {kWPT,4} } },
+        { "GeForce GTX 680",                                 { {kWGS1,128}, {kWGS2,1}, {kWPT,4} } },
+        { "GeForce GTX TITAN",                               { {kWGS1,32}, {kWGS2,4}, {kWPT,2} } },
+        { "default",                                         { {kWGS1,32}, {kWGS2,1}, {kWPT,2} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",32}, {"WGS2",1}, {"WPT",1} } },
+        { "default",                                         { {kWGS1,32}, {kWGS2,1}, {kWPT,1} } },
       }
     },
   }
@@ -66,43 +78,43 @@ const Database::DatabaseEntry Database::XgerComplexSingle = {
   "Xger", Precision::kComplexSingle, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,64}, {kWGS2,4}, {kWPT,1} } },
+        { "Hawaii",                                          { {kWGS1,64}, {kWGS2,1}, {kWPT,2} } },
+        { "Pitcairn",                                        { {kWGS1,128}, {kWGS2,2}, {kWPT,1} } },
+        { "Tahiti",                                          { {kWGS1,64}, {kWGS2,2}, {kWPT,1} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,1}, {kWPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
+        { "Mali-T628",                                       { {kWGS1,128}, {kWGS2,1}, {kWPT,1} } },
+        { "default",                                         { {kWGS1,128}, {kWGS2,1}, {kWPT,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",512}, {"WGS2",4}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,256}, {kWGS2,1}, {kWPT,4} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kWGS1,512}, {kWGS2,4}, {kWPT,2} } },
+        { "default",                                         { {kWGS1,256}, {kWGS2,1}, {kWPT,2} } },
       }
     },
     { // Intel GPUs
       kDeviceTypeGPU, "Intel", {
-        { "Iris Pro",                                        { {"WGS1",16}, {"WGS2",2}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",16}, {"WGS2",2}, {"WPT",4} } },
+        { "Iris Pro",                                        { {kWGS1,16}, {kWGS2,2}, {kWPT,4} } },
+        { "default",                                         { {kWGS1,16}, {kWGS2,2}, {kWPT,4} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",128}, {"WGS2",2}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",16}, {"WGS2",2}, {"WPT",2} } },
+        { "GeForce GTX 480",                                 { {kWGS1,128}, {kWGS2,2}, {kWPT,2} } },
+        { "GeForce GTX 680",                                 { {kWGS1,32}, {kWGS2,4}, {kWPT,2} } },
+        { "GeForce GTX TITAN",                               { {kWGS1,16}, {kWGS2,16}, {kWPT,2} } },
+        { "default",                                         { {kWGS1,16}, {kWGS2,2}, {kWPT,2} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",16}, {"WGS2",1}, {"WPT",1} } },
+        { "default",                                         { {kWGS1,16}, {kWGS2,1}, {kWPT,1} } },
       }
     },
   }
@@ -114,37 +126,37 @@ const Database::DatabaseEntry Database::XgerDouble = {
   "Xger", Precision::kDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",32}, {"WGS2",4}, {"WPT",1} } },
-        { "Hawaii",                                          { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",1}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,32}, {kWGS2,4}, {kWPT,1} } },
+        { "Hawaii",                                          { {kWGS1,32}, {kWGS2,4}, {kWPT,2} } },
+        { "Pitcairn",                                        { {kWGS1,64}, {kWGS2,1}, {kWPT,1} } },
+        { "Tahiti",                                          { {kWGS1,64}, {kWGS2,2}, {kWPT,1} } },
+        { "default",                                         { {kWGS1,32}, {kWGS2,1}, {kWPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
+        { "Mali-T628",                                       { {kWGS1,64}, {kWGS2,4}, {kWPT,1} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,4}, {kWPT,1} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",16}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",512}, {"WGS2",8}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",512}, {"WGS2",8}, {"WPT",1} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,512}, {kWGS2,16}, {kWPT,1} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kWGS1,512}, {kWGS2,8}, {kWPT,2} } },
+        { "default",                                         { {kWGS1,512}, {kWGS2,8}, {kWPT,1} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",16}, {"WGS2",4}, {"WPT",2} } },
+        { "GeForce GTX 480",                                 { {kWGS1,32}, {kWGS2,4}, {kWPT,2} } },
+        { "GeForce GTX 680",                                 { {kWGS1,128}, {kWGS2,4}, {kWPT,2} } },
+        { "GeForce GTX TITAN",                               { {kWGS1,16}, {kWGS2,8}, {kWPT,2} } },
+        { "default",                                         { {kWGS1,16}, {kWGS2,4}, {kWPT,2} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",16}, {"WGS2",1}, {"WPT",1} } },
+        { "default",                                         { {kWGS1,16}, {kWGS2,1}, {kWPT,1} } },
       }
     },
   }
@@ -156,37 +168,37 @@ const Database::DatabaseEntry Database::XgerComplexDouble = {
   "Xger", Precision::kComplexDouble, {
     { // AMD GPUs
       kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",32}, {"WGS2",4}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",1}, {"WPT",1} } },
+        { "AMD Radeon R9 M370X Compute Engine",              { {kWGS1,64}, {kWGS2,1}, {kWPT,1} } },
+        { "Hawaii",                                          { {kWGS1,128}, {kWGS2,1}, {kWPT,1} } },
+        { "Pitcairn",                                        { {kWGS1,64}, {kWGS2,4}, {kWPT,1} } },
+        { "Tahiti",                                          { {kWGS1,32}, {kWGS2,4}, {kWPT,1} } },
+        { "default",                                         { {kWGS1,32}, {kWGS2,1}, {kWPT,1} } },
       }
     },
     { // ARM GPUs
       kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",2}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",2}, {"WPT",4} } },
+        { "Mali-T628",                                       { {kWGS1,64}, {kWGS2,2}, {kWPT,4} } },
+        { "default",                                         { {kWGS1,64}, {kWGS2,2}, {kWPT,4} } },
       }
     },
     { // Intel CPUs
       kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",4}, {"WPT",2} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
+        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {kWGS1,512}, {kWGS2,4}, {kWPT,2} } },
+        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {kWGS1,256}, {kWGS2,1}, {kWPT,2} } },
+        { "default",                                         { {kWGS1,256}, {kWGS2,1}, {kWPT,2} } },
       }
     },
     { // NVIDIA GPUs
       kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WGS2",2}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",8}, {"WGS2",16}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",8}, {"WGS2",2}, {"WPT",1} } },
+        { "GeForce GTX 480",                                 { {kWGS1,64}, {kWGS2,2}, {kWPT,2} } },
+        { "GeForce GTX 680",                                 { {kWGS1,8}, {kWGS2,16}, {kWPT,1} } },
+        { "GeForce GTX TITAN",                               { {kWGS1,32}, {kWGS2,4}, {kWPT,2} } },
+        { "default",                                         { {kWGS1,8}, {kWGS2,2}, {kWPT,1} } },
       }
     },
     { // Default
       kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",8}, {"WGS2",1}, {"WPT",1} } },
+        { "default",                                         { {kWGS1,8}, {kWGS2,1}, {kWPT,1} } },
       }
     },
   }
@@ -0,0 +1,69 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the handle, which binds CLBlast to an OpenCL command queue. It holds the
+// routine objects (e.g. Xgemm<float>) created by the handle-based API calls, such that these can be
+// re-used across calls instead of being constructed and set-up each time.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_HANDLE_H_
+#define CLBLAST_HANDLE_H_
+
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+#include "clblast.h"
+#include "internal/cache.h"
+#include "internal/utilities.h"
+
+namespace clblast {
+// =================================================================================================
+
+// The actual handle (see 'Handle' in the public header). The routine objects are stored by type,
+// since each routine and precision combination corresponds to a single class. The generation is
+// that of the cache at the time the routines were created (see 'cache::GetClearGeneration').
+struct HandleImpl {
+  explicit HandleImpl(const cl_command_queue queue):
+      queue_(queue), generation_(cache::GetClearGeneration()) { }
+  Queue queue_;
+  size_t generation_;
+  std::unordered_map<std::type_index, std::shared_ptr<void>> routines_;
+};
+
+// Retrieves a routine object from the handle. On first use, the routine is constructed and set-up.
+// Afterwards, only the event to be used by the upcoming call is changed. All routines are discarded
+// once the cache was cleared (e.g. by 'SetTuningParametersPath'), such that they are set-up again
+// with the current tuning parameters and programs.
+template <typename R>
+StatusCode GetRoutine(Handle handle, EventPointer event, R* &routine) {
+  if (handle == nullptr) { return StatusCode::kInvalidHandle; }
+  const auto generation = cache::GetClearGeneration();
+  if (handle->generation_ != generation) {
+    handle->routines_.clear();
+    handle->generation_ = generation;
+  }
+  auto &stored_routine = handle->routines_[std::type_index(typeid(R))];
+  if (!stored_routine) {
+    auto new_routine = std::make_shared<R>(handle->queue_, event);
+    auto status = new_routine->SetUp();
+    if (status != StatusCode::kSuccess) { return status; }
+    stored_routine = new_routine;
+  }
+  routine = static_cast<R*>(stored_routine.get());
+  routine->SetEvent(event);
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_HANDLE_H_
+#endif
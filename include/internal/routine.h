@@ -18,8 +18,11 @@
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <unordered_map>
 
 #include "internal/cache.h"
+#include "internal/buffer_pool.h"
 #include "internal/utilities.h"
 #include "internal/database.h"
 
@@ -41,6 +44,17 @@ class Routine {
   // Set-up phase of the kernel
   StatusCode SetUp();
 
+  // Compiles (or retrieves from the cache) all the separately compiled programs up-front. Normally
+  // these are only set-up when they are actually needed.
+  StatusCode SetUpSubPrograms();
+
+  // Sets the event of the next call, used when a routine object is re-used (e.g. by a handle)
+  void SetEvent(EventPointer event) { event_ = event; }
+
+  // Sets a caller-provided device buffer from which the temporary buffers of the next call are
+  // carved as sub-buffers, instead of taking them from the pool (see 'GetTempBuffer')
+  void SetWorkspace(const cl_mem workspace, const size_t workspace_size);
+
  protected:
   
   // Runs a kernel given the global and local thread sizes
@@ -74,6 +88,27 @@ class Routine {
   StatusCode TestVectorIndex(const size_t n, const Buffer<unsigned int> &buffer,
                              const size_t offset, const size_t data_size);
 
+  // Retrieves a program from the cache, or compiles it and stores it in the cache otherwise. The
+  // program's name is used as cache key: this is the routine's name for the main program.
+  StatusCode SetUpProgram(const std::string &program_name, const std::string &source,
+                          std::shared_ptr<Program> &program);
+
+  // Retrieves one of the separately compiled programs by name (see 'sub_program_sources_'). It is
+  // compiled on first use only.
+  StatusCode SetUpSubProgram(const std::string &name, std::shared_ptr<Program> &program);
+
+  // Selects the tuning parameters for a specific problem size (see 'Database::SelectProblemSize').
+  // If these differ from the current ones, the main program is set-up again accordingly.
+  StatusCode SetUpForProblemSize(const size_t m, const size_t n, const size_t k);
+
+  // Retrieves a temporary buffer of 'size' elements: a sub-buffer of the caller-provided workspace
+  // if there is one, or a buffer from the pool otherwise
+  Buffer<T> GetTempBuffer(const size_t size);
+
+  // Computes the number of bytes a temporary buffer of 'size' elements occupies in the workspace.
+  // This includes padding, since the start of each sub-buffer has to be aligned.
+  size_t WorkspaceBytes(const size_t size) const;
+
   // Copies/transposes a matrix and padds/unpads it with zeroes. This method is also able to write
   // to symmetric and triangular matrices through optional arguments.
   StatusCode PadCopyTransposeMatrix(EventPointer event, std::vector<Event>& waitForEvents,
@@ -82,36 +117,28 @@ class Routine {
                                     const Buffer<T> &src,
                                     const size_t dest_one, const size_t dest_two,
                                     const size_t dest_ld, const size_t dest_offset,
-                                    const Buffer<T> &dest,
-                                    const Program &program, const bool do_pad,
+                                    const Buffer<T> &dest, const bool do_pad,
                                     const bool do_transpose, const bool do_conjugate,
                                     const bool upper = false, const bool lower = false,
                                     const bool diagonal_imag_zero = false);
 
-  // Stores a newly compiled binary/program into the cache
-  void StoreBinaryToCache(const std::string& binary) const {
-    cache::StoreBinaryToCache(binary, device_name_, precision_, routine_name_);
-  }
-  void StoreProgramToCache(const Program& program) const {
-    cache::StoreProgramToCache(program, context_, precision_, routine_name_);
-  }
-
-  // Queries the cache and retrieve either a matching binary/program or a boolean whether a match
-  // exists. The first assumes that the binary/program is available in the cache and will throw an
-  // exception otherwise.
-  std::string GetBinaryFromCache() const {
-    return cache::GetBinaryFromCache(device_name_, precision_, routine_name_);
-  }
+  // Queries the cache and retrieve either a matching program or a boolean whether a match exists.
+  // The first assumes that the program is available in the cache and will throw an exception
+  // otherwise. The program is normally already found by 'SetUp', saving a look-up. Note that
+  // binaries are not looked-up by routine, since they are keyed on their source code.
   Program GetProgramFromCache() const {
+    if (program_) { return *program_; }
     return cache::GetProgramFromCache(context_, precision_, routine_name_);
   }
-  bool BinaryIsInCache() const {
-    return cache::BinaryIsInCache(device_name_, precision_, routine_name_);
-  }
   bool ProgramIsInCache() const {
     return cache::ProgramIsInCache(context_, precision_, routine_name_);
   }
 
+  // Retrieves a kernel from the per-thread kernel cache, which creates it on first use
+  Kernel GetKernelFromCache(const Program &program, const std::string &kernel_name) const {
+    return cache::GetKernelFromCache(program, kernel_name);
+  }
+
   // Non-static variable for the precision. Note that the same variable (but static) might exist in
   // a derived class.
   const Precision precision_;
@@ -132,8 +159,24 @@ class Routine {
   const std::vector<size_t> max_work_item_sizes_;
   const size_t max_work_group_size_;
 
-  // Connection to the database for all the device-specific parameters
-  const Database db_;
+  // Connection to the database for all the device-specific parameters, and the identifier of the
+  // selected size-specific parameters (zero for the regular parameters)
+  Database db_;
+  size_t problem_size_id_;
+
+  // The compiled program of this routine, set once it is found in (or stored to) the cache
+  std::shared_ptr<Program> program_;
+
+  // Kernels which are only needed in some cases (e.g. the pre/post-processing kernels of the
+  // level-3 routines) are compiled into separate programs. Their sources are given by the derived
+  // class, keyed on the program's name. They are compiled and cached individually upon first use.
+  std::unordered_map<std::string, std::string> sub_program_sources_;
+  std::unordered_map<std::string, std::shared_ptr<Program>> sub_programs_;
+
+  // The caller-provided workspace (if any), its size in bytes, and the offset of its unused part
+  cl_mem workspace_;
+  size_t workspace_size_;
+  size_t workspace_offset_;
 };
 
 // =================================================================================================
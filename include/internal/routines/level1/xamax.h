@@ -31,6 +31,7 @@ class Xamax: public Routine<T> {
   using Routine<T>::event_;
   using Routine<T>::context_;
   using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::TestVectorX;
   using Routine<T>::TestVectorIndex;
   using Routine<T>::RunKernel;
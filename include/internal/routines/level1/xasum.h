@@ -31,6 +31,7 @@ class Xasum: public Routine<T> {
   using Routine<T>::event_;
   using Routine<T>::context_;
   using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::TestVectorX;
   using Routine<T>::TestVectorDot;
   using Routine<T>::RunKernel;
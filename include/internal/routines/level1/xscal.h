@@ -30,6 +30,7 @@ class Xscal: public Routine<T> {
   using Routine<T>::queue_;
   using Routine<T>::event_;
   using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::TestVectorX;
   using Routine<T>::RunKernel;
   using Routine<T>::ErrorIn;
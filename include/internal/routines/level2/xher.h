@@ -30,6 +30,7 @@ class Xher: public Routine<T> {
   using Routine<T>::queue_;
   using Routine<T>::event_;
   using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::TestVectorX;
   using Routine<T>::TestMatrixA;
   using Routine<T>::TestMatrixAP;
@@ -14,11 +14,48 @@
 #ifndef CLBLAST_ROUTINES_XGEMM_H_
 #define CLBLAST_ROUTINES_XGEMM_H_
 
+#include <memory>
+
 #include "internal/routine.h"
 
 namespace clblast {
 // =================================================================================================
 
+// Sets and retrieves the accuracy mode of the GEMM routines (see 'SetGemmAccuracy' in the API)
+void SetGemmAccuracyMode(const GemmAccuracy accuracy);
+GemmAccuracy GetGemmAccuracyMode();
+
+// Sets and retrieves the maximum depth of the Strassen-Winograd recursion (see the API's
+// 'SetGemmStrassenDepth')
+void SetGemmStrassenDepthLimit(const size_t max_depth);
+size_t GetGemmStrassenDepthLimit();
+
+// The data-type of the real and imaginary parts of a data-type, used by the 3M algorithm
+template <typename T> struct ComplexPart { using Type = T; };
+template <> struct ComplexPart<float2> { using Type = float; };
+template <> struct ComplexPart<double2> { using Type = double; };
+
+// A matrix (or a quadrant of a matrix) stored in a buffer, used by the Strassen-Winograd recursion
+template <typename T>
+struct MatrixView {
+  Buffer<T> buffer;
+  size_t offset;
+  size_t ld;
+};
+
+// The arguments of the epilogue which the kernel applies when storing the results (see the
+// XgemmEpilogue routine). Scale vectors which are not used are null-pointers.
+struct GemmEpilogueArguments {
+  Bias bias;
+  cl_mem bias_buffer;
+  size_t bias_offset;
+  Activation activation;
+  cl_mem row_scale_buffer;
+  size_t row_scale_offset;
+  cl_mem col_scale_buffer;
+  size_t col_scale_offset;
+};
+
 // See comment at top of file for a description of the class
 template <typename T>
 class Xgemm: public Routine<T> {
@@ -27,11 +64,19 @@ class Xgemm: public Routine<T> {
   // Members and methods from the base class
   using Routine<T>::db_;
   using Routine<T>::source_string_;
+  using Routine<T>::sub_program_sources_;
   using Routine<T>::queue_;
   using Routine<T>::event_;
   using Routine<T>::context_;
+  using Routine<T>::device_;
+  using Routine<T>::workspace_;
+  using Routine<T>::GetTempBuffer;
+  using Routine<T>::WorkspaceBytes;
   using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::PadCopyTransposeMatrix;
+  using Routine<T>::SetUpForProblemSize;
+  using Routine<T>::SetUpSubProgram;
   using Routine<T>::TestMatrixA;
   using Routine<T>::TestMatrixB;
   using Routine<T>::TestMatrixC;
@@ -50,9 +95,100 @@ class Xgemm: public Routine<T> {
                     const T beta,
                     const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
 
+  // Computes the size in bytes of the workspace 'DoGemm' needs at most for a given problem
+  size_t GemmWorkspaceSize(const Layout layout,
+                           const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k);
+
+ protected:
+  // The epilogue applied by the kernel when storing the results, or a null-pointer for a regular
+  // GEMM. This is set by routines derived from this one.
+  const GemmEpilogueArguments *epilogue_;
+
  private:
+  // Finds out whether a problem is computed by the direct kernel rather than by the regular kernel
+  bool UseDirectKernel(const size_t m, const size_t n, const size_t k) const;
+
+  // Computes the routine with the direct kernel, which needs no temporary matrices
+  StatusCode DoGemmDirect(const size_t m, const size_t n, const size_t k,
+                          const T alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                          const T beta,
+                          const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                          const bool a_rotated, const bool b_rotated, const bool c_rotated,
+                          const bool a_conjugate, const bool b_conjugate);
+
+  // Finds the number of parts in which k is split among the work-groups (see 'DoGemmSplitK'), which
+  // is 1 if the split-K kernels are not used
+  size_t SplitKCount(const size_t m, const size_t n, const size_t k) const;
+
+  // Computes the routine with the split-K kernels on the pre-processed (padded) matrices
+  StatusCode DoGemmSplitK(const Program &program,
+                          const size_t m_ceiled, const size_t n_ceiled, const size_t k_ceiled,
+                          const size_t num_splits, const T alpha, const T beta,
+                          const Buffer<T> &a_temp, const Buffer<T> &b_temp,
+                          const Buffer<T> &c_partial, const Buffer<T> &c_temp,
+                          EventPointer event, std::vector<Event> &eventWaitList);
+
+  // Finds out whether a complex problem is computed with the 3M algorithm (see 'DoGemm3M')
+  bool Use3M(const size_t m, const size_t n, const size_t k) const;
+
+  // Computes a complex routine with three real matrix-multiplications instead of four
+  StatusCode DoGemm3M(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                      const size_t a_one, const size_t a_two, const size_t b_one,
+                      const size_t b_two, const size_t c_one, const size_t c_two);
+
+  // Finds the number of levels of the Strassen-Winograd recursion (see 'DoGemmStrassen'), which is
+  // 0 if it is not used
+  size_t StrassenDepth(const Layout layout, const Transpose a_transpose,
+                       const Transpose b_transpose, const size_t m, const size_t n, const size_t k);
+
+  // Computes the routine with a number of levels of the Strassen-Winograd recursion
+  StatusCode DoGemmStrassen(const Layout layout,
+                            const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha, const MatrixView<T> &a, const MatrixView<T> &b,
+                            const T beta, const MatrixView<T> &c, const size_t depth);
+
+  // Sets the kernel arguments of the epilogue, starting at argument 'index'
+  void SetEpilogueArguments(Kernel &kernel, const size_t index, const size_t m, const size_t n,
+                            const Buffer<T> &c_buffer) const;
+
+  // Computes the routine in blocks, such that the temporary matrices fit within a memory budget
+  StatusCode DoGemmInBlocks(const Layout layout,
+                            const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                            const T beta,
+                            const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                            const size_t budget);
+
   // Static variable to get the precision
   const static Precision precision_;
+
+  // The number of compute units of the device, used to decide on the split-K strategy
+  const size_t compute_units_;
+
+  // Whether or not the blocks of 'DoGemmInBlocks' are being computed, i.e. whether the memory
+  // budget has already been taken into account
+  bool computing_blocks_;
+
+  // Whether or not the products of 'DoGemmStrassen' are being computed, i.e. whether the recursion
+  // has already been taken into account
+  bool computing_strassen_;
+
+  // The routine of the corresponding real precision computing the products of 'DoGemm3M'. It is
+  // created and set-up on first use, such that it is re-used by subsequent calls on this object.
+  std::unique_ptr<Xgemm<typename ComplexPart<T>::Type>> real_gemm_;
 };
 
 // =================================================================================================
@@ -29,10 +29,14 @@ class Xher2k: public Routine<T> {
   // Members and methods from the base class
   using Routine<T>::db_;
   using Routine<T>::source_string_;
+  using Routine<T>::sub_program_sources_;
   using Routine<T>::queue_;
   using Routine<T>::event_;
   using Routine<T>::context_;
+  using Routine<T>::GetTempBuffer;
+  using Routine<T>::WorkspaceBytes;
   using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::PadCopyTransposeMatrix;
   using Routine<T>::TestMatrixA;
   using Routine<T>::TestMatrixB;
@@ -52,6 +56,10 @@ class Xher2k: public Routine<T> {
                      const U beta,
                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
 
+  // Computes the size in bytes of the workspace 'DoHer2k' needs at most for a given problem
+  size_t Her2kWorkspaceSize(const Layout layout, const Triangle triangle,
+                            const Transpose ab_transpose, const size_t n, const size_t k);
+
  private:
   // Static variable to get the precision
   const static Precision precision_;
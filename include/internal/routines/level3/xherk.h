@@ -29,10 +29,14 @@ class Xherk: public Routine<T> {
   // Members and methods from the base class
   using Routine<T>::db_;
   using Routine<T>::source_string_;
+  using Routine<T>::sub_program_sources_;
   using Routine<T>::queue_;
   using Routine<T>::event_;
   using Routine<T>::context_;
+  using Routine<T>::GetTempBuffer;
+  using Routine<T>::WorkspaceBytes;
   using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::PadCopyTransposeMatrix;
   using Routine<T>::TestMatrixA;
   using Routine<T>::TestMatrixC;
@@ -50,6 +54,10 @@ class Xherk: public Routine<T> {
                     const U beta,
                     const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
 
+  // Computes the size in bytes of the workspace 'DoHerk' needs at most for a given problem
+  size_t HerkWorkspaceSize(const Layout layout, const Triangle triangle,
+                           const Transpose a_transpose, const size_t n, const size_t k);
+
  private:
   // Static variable to get the precision
   const static Precision precision_;
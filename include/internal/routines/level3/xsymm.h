@@ -29,14 +29,19 @@ class Xsymm: public Xgemm<T> {
 
   // Members and methods from the base class
   using Routine<T>::db_;
+  using Routine<T>::queue_;
   using Routine<T>::context_;
-  using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetTempBuffer;
+  using Routine<T>::WorkspaceBytes;
+  using Routine<T>::SetUpSubProgram;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::TestMatrixA;
   using Routine<T>::RunKernel;
   using Routine<T>::ErrorIn;
 
   // Uses the regular Xgemm routine
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::GemmWorkspaceSize;
 
   // Constructor
   Xsymm(Queue &queue, EventPointer event, const std::string &name = "SYMM");
@@ -49,6 +54,10 @@ class Xsymm: public Xgemm<T> {
                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
                     const T beta,
                     const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+  // Computes the size in bytes of the workspace 'DoSymm' needs at most for a given problem
+  size_t SymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                           const size_t m, const size_t n);
 };
 
 // =================================================================================================
@@ -28,14 +28,19 @@ class Xtrmm: public Xgemm<T> {
 
   // Members and methods from the base class
   using Routine<T>::db_;
+  using Routine<T>::queue_;
   using Routine<T>::context_;
-  using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetTempBuffer;
+  using Routine<T>::WorkspaceBytes;
+  using Routine<T>::SetUpSubProgram;
+  using Routine<T>::GetKernelFromCache;
   using Routine<T>::TestMatrixA;
   using Routine<T>::RunKernel;
   using Routine<T>::ErrorIn;
 
   // Uses the regular Xgemm routine
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::GemmWorkspaceSize;
 
   // Constructor
   Xtrmm(Queue &queue, EventPointer event, const std::string &name = "TRMM");
@@ -47,6 +52,11 @@ class Xtrmm: public Xgemm<T> {
                     const T alpha,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+  // Computes the size in bytes of the workspace 'DoTrmm' needs at most for a given problem
+  size_t TrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                           const Transpose a_transpose, const Diagonal diagonal,
+                           const size_t m, const size_t n);
 };
 
 // =================================================================================================
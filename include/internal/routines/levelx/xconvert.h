@@ -0,0 +1,65 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xconvert routine: converts vectors from single-precision to half-
+// precision and vice-versa on the device. The routine is not templated: it is based on the single-
+// precision routine.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XCONVERT_H_
+#define CLBLAST_ROUTINES_XCONVERT_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+class Xconvert: public Routine<float> {
+ public:
+
+  // Members and methods from the base class
+  using Routine<float>::db_;
+  using Routine<float>::source_string_;
+  using Routine<float>::event_;
+  using Routine<float>::GetProgramFromCache;
+  using Routine<float>::GetKernelFromCache;
+  using Routine<float>::TestVectorX;
+  using Routine<float>::TestVectorY;
+  using Routine<float>::RunKernel;
+  using Routine<float>::ErrorIn;
+
+  // Constructor
+  Xconvert(Queue &queue, EventPointer event, const std::string &name = "CONVERT");
+
+  // Implementations of the routine, one for each direction of the conversion
+  StatusCode DoConvertFloatToHalf(const size_t n,
+                                  const Buffer<float> &x_buffer, const size_t x_offset,
+                                  const size_t x_inc,
+                                  const Buffer<half> &y_buffer, const size_t y_offset,
+                                  const size_t y_inc);
+  StatusCode DoConvertHalfToFloat(const size_t n,
+                                  const Buffer<half> &x_buffer, const size_t x_offset,
+                                  const size_t x_inc,
+                                  const Buffer<float> &y_buffer, const size_t y_offset,
+                                  const size_t y_inc);
+
+ private:
+  // Launches one of the two conversion kernels
+  StatusCode RunConvertKernel(const std::string &kernel_name, const size_t n,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              const cl_mem y_buffer, const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XCONVERT_H_
+#endif
@@ -0,0 +1,64 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmEpilogue routine: a GEMM of which the kernel adds a bias, applies
+// an activation function, and scales the rows and columns of the result when storing it. The
+// precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMEPILOGUE_H_
+#define CLBLAST_ROUTINES_XGEMMEPILOGUE_H_
+
+#include "internal/routines/level3/xgemm.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmEpilogue: public Xgemm<T> {
+ public:
+
+  // Members and methods from the base class
+  using Routine<T>::ErrorIn;
+  using Xgemm<T>::epilogue_;
+
+  // Uses the regular Xgemm routine
+  using Xgemm<T>::DoGemm;
+
+  // Constructor
+  XgemmEpilogue(Queue &queue, EventPointer event, const std::string &name = "GEMMEPILOGUE");
+
+  // Templated-precision implementation of the routine
+  StatusCode DoGemmEpilogue(const Layout layout,
+                            const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                            const T beta,
+                            const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                            const Bias bias, const Buffer<T> &bias_buffer,
+                            const size_t bias_offset,
+                            const Activation activation,
+                            const Buffer<T> &row_scale_buffer, const size_t row_scale_offset,
+                            const Buffer<T> &col_scale_buffer, const size_t col_scale_offset);
+
+ private:
+  // Tests a vector of the epilogue for validity: it has to hold 'n' values after its offset
+  StatusCode TestEpilogueVector(const size_t n, const Buffer<T> &buffer,
+                                const size_t offset) const;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMEPILOGUE_H_
+#endif
@@ -0,0 +1,62 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmGroupedBatched routine: a group of GEMM problems of different
+// sizes, of which the sizes, offsets, leading dimensions, and scalars are stored in device memory.
+// The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMGROUPEDBATCHED_H_
+#define CLBLAST_ROUTINES_XGEMMGROUPEDBATCHED_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmGroupedBatched: public Routine<T> {
+ public:
+
+  // Members and methods from the base class
+  using Routine<T>::db_;
+  using Routine<T>::source_string_;
+  using Routine<T>::queue_;
+  using Routine<T>::event_;
+  using Routine<T>::context_;
+  using Routine<T>::device_;
+  using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
+  using Routine<T>::RunKernel;
+  using Routine<T>::ErrorIn;
+
+  // Constructor
+  XgemmGroupedBatched(Queue &queue, EventPointer event,
+                      const std::string &name = "GEMMGROUPEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  StatusCode DoGemmGroupedBatched(const Layout layout, const Transpose a_transpose,
+                                  const Transpose b_transpose, const size_t group_count,
+                                  const Buffer<int> &problems_buffer,
+                                  const Buffer<T> &alphas_buffer, const Buffer<T> &betas_buffer,
+                                  const Buffer<T> &a_buffer, const Buffer<T> &b_buffer,
+                                  const Buffer<T> &c_buffer);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMGROUPEDBATCHED_H_
+#endif
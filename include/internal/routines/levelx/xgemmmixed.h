@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmMixed routine: a mixed-precision GEMM of which matrices A and B
+// are stored in half-precision, whereas matrix C, the scalars, and the computations are in single-
+// precision. The routine is therefore not templated: it is based on the single-precision routine.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMMIXED_H_
+#define CLBLAST_ROUTINES_XGEMMMIXED_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+class XgemmMixed: public Routine<float> {
+ public:
+
+  // Members and methods from the base class
+  using Routine<float>::db_;
+  using Routine<float>::source_string_;
+  using Routine<float>::event_;
+  using Routine<float>::GetProgramFromCache;
+  using Routine<float>::GetKernelFromCache;
+  using Routine<float>::TestMatrixA;
+  using Routine<float>::TestMatrixB;
+  using Routine<float>::TestMatrixC;
+  using Routine<float>::RunKernel;
+  using Routine<float>::ErrorIn;
+
+  // Constructor
+  XgemmMixed(Queue &queue, EventPointer event, const std::string &name = "GEMMMIXED");
+
+  // Implementation of the routine
+  StatusCode DoGemmMixed(const Layout layout, const Transpose a_transpose,
+                         const Transpose b_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const float alpha,
+                         const Buffer<half> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<half> &b_buffer, const size_t b_offset, const size_t b_ld,
+                         const float beta,
+                         const Buffer<float> &c_buffer, const size_t c_offset, const size_t c_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMMIXED_H_
+#endif
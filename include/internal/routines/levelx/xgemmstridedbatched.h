@@ -0,0 +1,69 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmStridedBatched routine: a batch of GEMM problems of the same sizes,
+// of which the matrices are a constant stride apart. The precision is implemented using a template
+// argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMSTRIDEDBATCHED_H_
+#define CLBLAST_ROUTINES_XGEMMSTRIDEDBATCHED_H_
+
+#include "internal/routine.h"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmStridedBatched: public Routine<T> {
+ public:
+
+  // Members and methods from the base class
+  using Routine<T>::db_;
+  using Routine<T>::source_string_;
+  using Routine<T>::queue_;
+  using Routine<T>::event_;
+  using Routine<T>::GetProgramFromCache;
+  using Routine<T>::GetKernelFromCache;
+  using Routine<T>::TestMatrixA;
+  using Routine<T>::TestMatrixB;
+  using Routine<T>::TestMatrixC;
+  using Routine<T>::RunKernel;
+  using Routine<T>::ErrorIn;
+
+  // Constructor
+  XgemmStridedBatched(Queue &queue, EventPointer event,
+                      const std::string &name = "GEMMSTRIDEDBATCHED");
+
+  // Templated-precision implementation of the routine
+  StatusCode DoGemmStridedBatched(const Layout layout, const Transpose a_transpose,
+                                  const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const T alpha,
+                                  const Buffer<T> &a_buffer, const size_t a_offset,
+                                  const size_t a_ld, const size_t a_stride,
+                                  const Buffer<T> &b_buffer, const size_t b_offset,
+                                  const size_t b_ld, const size_t b_stride,
+                                  const T beta,
+                                  const Buffer<T> &c_buffer, const size_t c_offset,
+                                  const size_t c_ld, const size_t c_stride,
+                                  const size_t batch_count);
+
+ private:
+  // Static variable to get the precision
+  const static Precision precision_;
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMSTRIDEDBATCHED_H_
+#endif
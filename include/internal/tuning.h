@@ -42,6 +42,7 @@ void Tuner(int argc, char* argv[]) {
     if (o == kArgAlpha)    { args.alpha    = GetArgument(argc, argv, help, kArgAlpha, GetScalar<T>()); }
     if (o == kArgBeta)     { args.beta     = GetArgument(argc, argv, help, kArgBeta, GetScalar<T>()); }
     if (o == kArgFraction) { args.fraction = GetArgument(argc, argv, help, kArgFraction, C::DefaultFraction()); }
+    if (o == kArgBatchCount) { args.batch_count = GetArgument(argc, argv, help, kArgBatchCount, C::DefaultBatchCount()); }
   }
   fprintf(stdout, "%s\n", help.c_str());
 
@@ -131,8 +132,23 @@ void Tuner(int argc, char* argv[]) {
     printf(" or %.1lf %s\n", C::GetMetric(args)/(time_ms*1.0e6), C::PerformanceUnit().c_str());
   }
 
-  // Outputs the results as JSON to disk, including some meta-data
+  // Outputs the results as JSON to disk, including some meta-data. Results for a non-default problem
+  // size (e.g. as part of a size sweep) have the sizes in their file name, such that they are kept
+  // separate from the results for the default size. The database turns them into size-specific
+  // entries.
   auto precision_string = std::to_string(static_cast<size_t>(args.precision));
+  auto file_name = "clblast_"+C::KernelFamily()+"_"+precision_string;
+  auto size_string = std::string{""};
+  auto is_default_size = true;
+  for (auto &o: C::GetOptions()) {
+    if (o == kArgM) { size_string += "_m"+std::to_string(args.m); }
+    if (o == kArgN) { size_string += "_n"+std::to_string(args.n); }
+    if (o == kArgK) { size_string += "_k"+std::to_string(args.k); }
+    if (o == kArgM && args.m != C::DefaultM()) { is_default_size = false; }
+    if (o == kArgN && args.n != C::DefaultN()) { is_default_size = false; }
+    if (o == kArgK && args.k != C::DefaultK()) { is_default_size = false; }
+  }
+  if (!is_default_size) { file_name += size_string; }
   auto metadata = std::vector<std::pair<std::string,std::string>>{
     {"kernel_family", C::KernelFamily()},
     {"precision", precision_string}
@@ -143,8 +159,9 @@ void Tuner(int argc, char* argv[]) {
     if (o == kArgK)     { metadata.push_back({"arg_k", std::to_string(args.k)}); }
     if (o == kArgAlpha) { metadata.push_back({"arg_alpha", ToString(args.alpha)}); }
     if (o == kArgBeta)  { metadata.push_back({"arg_beta", ToString(args.beta)}); }
+    if (o == kArgBatchCount) { metadata.push_back({"arg_batch_num", std::to_string(args.batch_count)}); }
   }
-  tuner.PrintJSON("clblast_"+C::KernelFamily()+"_"+precision_string+".json", metadata);
+  tuner.PrintJSON(file_name+".json", metadata);
 }
 
 // =================================================================================================
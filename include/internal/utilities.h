@@ -20,8 +20,10 @@
 #include <string>
 #include <functional>
 #include <complex>
+#include <algorithm>
 
 #include "clblast.h"
+#include "clblast_half.h"
 #include "internal/clpp11.h"
 
 namespace clblast {
@@ -38,6 +40,11 @@ const std::string kKhronosDoublePrecision = "cl_khr_fp64";
 // Catched an unknown error
 constexpr auto kUnknownError = -999;
 
+// Returns the scalars zero and one. These are specialised for half-precision, of which the host
+// data-type is an integer holding the raw bits (see 'clblast_half.h').
+template <typename T> T ConstantZero();
+template <typename T> T ConstantOne();
+
 // =================================================================================================
 
 // The routine-specific arguments in string form
@@ -69,6 +76,10 @@ constexpr auto kArgAsumOffset = "offasum";
 constexpr auto kArgImaxOffset = "offimax";
 constexpr auto kArgAlpha = "alpha";
 constexpr auto kArgBeta = "beta";
+constexpr auto kArgBatchCount = "batch_num";
+constexpr auto kArgBias = "bias";
+constexpr auto kArgActivation = "activation";
+constexpr auto kArgWorkspace = "workspace";
 
 // The tuner-specific arguments in string form
 constexpr auto kArgFraction = "fraction";
@@ -83,6 +94,7 @@ constexpr auto kArgNumRuns = "runs";
 // The client-specific arguments in string form
 constexpr auto kArgFullTest = "full_test";
 constexpr auto kArgVerbose = "verbose";
+constexpr auto kArgMemoryBudget = "membudget";
 
 // The common arguments in string form
 constexpr auto kArgPlatform = "platform";
@@ -124,8 +136,12 @@ struct Arguments {
   size_t nrm2_offset = 0;
   size_t asum_offset = 0;
   size_t imax_offset = 0;
-  T alpha = T{1.0};
-  T beta = T{1.0};
+  T alpha = ConstantOne<T>();
+  T beta = ConstantOne<T>();
+  size_t batch_count = 1;
+  Bias bias = Bias::kNoBias;
+  Activation activation = Activation::kIdentity;
+  size_t workspace = 0; // Non-zero to run the variant with a workspace given by the caller
   size_t x_size = 1;
   size_t y_size = 1;
   size_t a_size = 1;
@@ -162,6 +178,23 @@ struct Buffers {
   Buffer<T> scalar;
 };
 
+// Runs the variant of a routine with a workspace given by the caller (for test clients): 'query'
+// retrieves the workspace size and 'run' runs the routine with a workspace of a given size. The
+// routine is run with exactly the queried size. Afterwards, one byte less has to be rejected: if it
+// is not, the returned status or the result updated a second time reveals this to the tester.
+template <typename Query, typename Run>
+StatusCode RunWithWorkspace(const Queue &queue, Query query, Run run) {
+  auto workspace_size = size_t{0};
+  auto status = query(&workspace_size);
+  if (status != StatusCode::kSuccess) { return status; }
+  auto workspace = Buffer<char>(queue.GetContext(), std::max(workspace_size, size_t{1}));
+  status = run(workspace(), workspace_size);
+  if (status != StatusCode::kSuccess || workspace_size == 0) { return status; }
+  const auto undersized_status = run(workspace(), workspace_size - 1);
+  if (undersized_status == StatusCode::kInsufficientMemoryTemp) { return StatusCode::kSuccess; }
+  return undersized_status;
+}
+
 // =================================================================================================
 
 // Converts a value (e.g. an integer) to a string. This also covers special cases for CLBlast
@@ -38,6 +38,11 @@ KERNEL_ATTRIBUTES = ["precision", "kernel_family"]
 ARGUMENT_ATTRIBUTES = ["arg_m", "arg_n", "arg_k", "arg_alpha", "arg_beta"]
 ATTRIBUTES = DEVICE_ATTRIBUTES + DEVICETYPE_ATTRIBUTES + KERNEL_ATTRIBUTES + ARGUMENT_ATTRIBUTES
 
+# The problem sizes (m, n, k) at which the kernel families are tuned by default. Results for other
+# sizes (e.g. from a size sweep of the tuner) become size-specific entries of the device.
+SIZE_ATTRIBUTES = ["arg_m", "arg_n", "arg_k"]
+SIZE_SPECIFIC_FAMILIES = {"xgemm": [1024, 1024, 1024]}
+
 # OpenCL vendor names and their short name
 VENDOR_NAMES = { "device_vendor": {
   "GenuineIntel": "Intel",
@@ -123,6 +128,15 @@ def GetBestResults(df):
 		dfbest = dfbest.append(bestcase, ignore_index=True)
 	return dfbest
 
+# Splits the results into those for the default problem sizes and the size-specific ones
+def SplitSizeSpecificResults(df):
+	is_size_specific = pd.Series(False, index=df.index)
+	for family, default_sizes in SIZE_SPECIFIC_FAMILIES.items():
+		is_family = df["kernel_family"] == family
+		for attribute, default_size in zip(SIZE_ATTRIBUTES, default_sizes):
+			is_size_specific = is_size_specific | (is_family & (df[attribute].astype(float) != default_size))
+	return df[~is_size_specific], df[is_size_specific]
+
 # Sets defaults for devices of the same type/vendor based on the smallest values of all know
 # entries. The average might be better for performance but some parameters might not be supported
 # on other devices.
@@ -164,6 +178,10 @@ def CalculateDefaults(df):
 # C++ header generation
 # ==================================================================================================
 
+# The name of the kernels of a family in the C++ database, e.g. 'XgemmDirect' for 'xgemm_direct'
+def GetKernelName(family):
+	return family.title().replace("_", "")
+
 # The C++ header
 def GetHeader(family):
 	return("""
@@ -181,7 +199,7 @@ def GetHeader(family):
 
 namespace clblast {
 // ================================================================================================="""
-	% family.title())
+	% GetKernelName(family))
 
 # The C++ footer
 def GetFooter():
@@ -190,14 +208,16 @@ def GetFooter():
 # The start of a new C++ precision entry
 def GetPrecision(family, precision):
 	precisionstring = "Single"
-	if precision == "64":
+	if precision == "16":
+		precisionstring = "Half"
+	elif precision == "64":
 		precisionstring = "Double"
 	elif precision == "3232":
 		precisionstring = "ComplexSingle"
 	elif precision == "6464":
 		precisionstring = "ComplexDouble"
 	return("\n\nconst Database::DatabaseEntry Database::%s%s = {\n  \"%s\", Precision::k%s, {\n"
-	       % (family.title(), precisionstring, family.title(), precisionstring))
+	       % (GetKernelName(family), precisionstring, GetKernelName(family), precisionstring))
 
 # The C++ device type and vendor
 def GetDeviceVendor(vendor, devtype):
@@ -205,8 +225,36 @@ def GetDeviceVendor(vendor, devtype):
 		return("    { // Default\n      kDeviceType%s, \"%s\", {\n" % (devtype, vendor))
 	return("    { // %s %ss\n      kDeviceType%s, \"%s\", {\n" % (vendor, devtype, devtype[0].upper() + devtype[1:], vendor))
 
+# The parameters of a device (or of a size-specific entry) in C++ form
+def GetParameters(df):
+	parameters = []
+	for kernel, dfkernel in df.groupby(["kernel"]):
+		dfkernel = dfkernel.dropna(axis=1)
+		col_names = [col for col in list(dfkernel) if col.startswith('parameters.') and col != "parameters.PRECISION"]
+		parameters += ["{k%s,%d}" % (p.replace("parameters.",""), dfkernel[p].iloc[0]) for p in col_names]
+	return parameters
+
+# The maximum size of a size-specific entry: unbounded if tuned at (or above) the default size
+def GetMaximumSize(size, default_size):
+	if size >= default_size:
+		return "kSizeUnbounded"
+	return "%d" % size
+
+# The size-specific entries of a device in C++ form, ordered from most to least specific
+def GetSizeEntries(dfsizes, family, precision, vendor, devtype, device):
+	dfdevice = dfsizes[(dfsizes["kernel_family"] == family) & (dfsizes["precision"] == precision) &
+	                   (dfsizes["device_vendor"] == vendor) & (dfsizes["device_type"] == devtype) &
+	                   (dfsizes["device"] == device)]
+	entries = []
+	for sizes, dfsize in dfdevice.groupby(SIZE_ATTRIBUTES):
+		sizes = [int(float(size)) for size in sizes]
+		maximums = [GetMaximumSize(s, d) for s, d in zip(sizes, SIZE_SPECIFIC_FAMILIES[family])]
+		entry = "          { %s, { %s } },\n" % (", ".join(maximums), ", ".join(GetParameters(dfsize)))
+		entries.append((sizes[0]*sizes[1]*sizes[2], entry))
+	return "".join([entry for volume, entry in sorted(entries)])
+
 # Prints the data to a C++ database
-def PrintData(df, outputdir):
+def PrintData(df, dfsizes, outputdir):
 
 	# Iterates over the kernel families: creates a new file per family
 	for family, dffamily in df.groupby(["kernel_family"]):
@@ -225,13 +273,16 @@ def PrintData(df, outputdir):
 						f.write("        { %-50s { " % devicename)
 
 						# Collects the paramaters for this case and prints them
-						parameters = []
-						for kernel, dfkernel in dfdevice.groupby(["kernel"]):
-							dfkernel = dfkernel.dropna(axis=1)
-							col_names = [col for col in list(dfkernel) if col.startswith('parameters.') and col != "parameters.PRECISION"]
-							parameters += ["{\"%s\",%d}" % (p.replace("parameters.",""), dfkernel[p].iloc[0]) for p in col_names]
-						f.write(", ".join(parameters))
-						f.write(" } },\n")
+						f.write(", ".join(GetParameters(dfdevice)))
+						f.write(" }")
+
+						# Prints the size-specific entries for this case (if any)
+						size_entries = ""
+						if family in SIZE_SPECIFIC_FAMILIES:
+							size_entries = GetSizeEntries(dfsizes, family, precision, vendor, devtype, device)
+						if size_entries:
+							f.write(", {\n" + size_entries + "        }")
+						f.write(" },\n")
 
 					# Prints the footers
 					f.write("      }\n    },\n")
@@ -298,6 +349,9 @@ if len(glob.glob(glob_json)) >= 1:
 print("## Calculating the best results per device/kernel...")
 bests = GetBestResults(database)
 
+# Separates the size-specific results: these are not used for the defaults
+bests, size_bests = SplitSizeSpecificResults(bests)
+
 # Determines the defaults for other vendors and per vendor
 defaults = CalculateDefaults(bests)
 bests = ConcatenateData(bests, defaults)
@@ -305,7 +359,7 @@ bests = ConcatenateData(bests, defaults)
 # Outputs the data as a C++ database
 path_cpp_database = os.path.join(path_clblast, "include", "internal", "database")
 print("## Producing a C++ database in '"+path_cpp_database+"'...")
-PrintData(bests, path_cpp_database)
+PrintData(bests, size_bests, path_cpp_database)
 
 print("## All done")
 
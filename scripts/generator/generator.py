@@ -28,11 +28,12 @@ import os.path
 
 # Local files
 from routine import Routine
-from datatype import DataType, FLT, DBL, FLT2, DBL2, F2CL, D2CL
+from datatype import DataType, HLF, FLT, DBL, FLT2, DBL2, HCL, F2CL, D2CL
 
 # ==================================================================================================
 
 # Regular data-types
+H = DataType("H", "H", HLF, [HLF, HLF, HCL, HCL], HLF ) # half (16)
 S = DataType("S", "S", FLT,  [FLT,  FLT,  FLT,  FLT],  FLT ) # single (32)
 D = DataType("D", "D", DBL,  [DBL,  DBL,  DBL,  DBL],  DBL ) # double (64)
 C = DataType("C", "C", FLT2, [FLT2, FLT2, F2CL, F2CL], FLT2) # single-complex (3232)
@@ -64,11 +65,11 @@ routines = [
   Routine(False, True,  "1", "rotmg", T,  [S,D],     [], [], ["sy1"], ["sd1","sd2","sx1","sparam"], [], "", "Generate modified givens plane rotation", "", []),
   Routine(False, True,  "1", "rot",   T,  [S,D],     ["n"], [], [], ["x","y"], ["cos","sin"], "", "Apply givens plane rotation", "", []),
   Routine(False, True,  "1", "rotm",  T,  [S,D],     ["n"], [], [], ["x","y","sparam"], [], "", "Apply modified givens plane rotation", "", []),
-  Routine(True,  True,  "1", "swap",  T,  [S,D,C,Z], ["n"], [], [], ["x","y"], [], "", "Swap two vectors", "Interchanges the contents of vectors x and y.", []),
-  Routine(True,  True,  "1", "scal",  T,  [S,D,C,Z], ["n"], [], [], ["x"], ["alpha"], "", "Vector scaling", "Multiplies all elements of vector x by a scalar constant alpha.", []),
-  Routine(True,  True,  "1", "copy",  T,  [S,D,C,Z], ["n"], [], ["x"], ["y"], [], "", "Vector copy", "Copies the contents of vector x into vector y.", []),
-  Routine(True,  True,  "1", "axpy",  T,  [S,D,C,Z], ["n"], [], ["x"], ["y"], ["alpha"], "", "Vector-times-constant plus vector", "Performs the operation y = alpha * x + y, in which x and y are vectors and alpha is a scalar constant.", []),
-  Routine(True,  True,  "1", "dot",   T,  [S,D],     ["n"], [], ["x","y"], ["dot"], [], "n", "Dot product of two vectors", "Multiplies the vectors x and y element-wise and accumulates the results. The sum is stored in the dot buffer.", []),
+  Routine(True,  True,  "1", "swap",  T,  [S,D,C,Z,H], ["n"], [], [], ["x","y"], [], "", "Swap two vectors", "Interchanges the contents of vectors x and y.", []),
+  Routine(True,  True,  "1", "scal",  T,  [S,D,C,Z,H], ["n"], [], [], ["x"], ["alpha"], "", "Vector scaling", "Multiplies all elements of vector x by a scalar constant alpha.", []),
+  Routine(True,  True,  "1", "copy",  T,  [S,D,C,Z,H], ["n"], [], ["x"], ["y"], [], "", "Vector copy", "Copies the contents of vector x into vector y.", []),
+  Routine(True,  True,  "1", "axpy",  T,  [S,D,C,Z,H], ["n"], [], ["x"], ["y"], ["alpha"], "", "Vector-times-constant plus vector", "Performs the operation y = alpha * x + y, in which x and y are vectors and alpha is a scalar constant.", []),
+  Routine(True,  True,  "1", "dot",   T,  [S,D,H],   ["n"], [], ["x","y"], ["dot"], [], "n", "Dot product of two vectors", "Multiplies the vectors x and y element-wise and accumulates the results. The sum is stored in the dot buffer.", []),
   Routine(True,  True,  "1", "dotu",  T,  [C,Z],     ["n"], [], ["x","y"], ["dot"], [], "n", "Dot product of two complex vectors", "See the regular xDOT routine.", []),
   Routine(True,  True,  "1", "dotc",  T,  [C,Z],     ["n"], [], ["x","y"], ["dot"], [], "n", "Dot product of two complex vectors, one conjugated", "See the regular xDOT routine.", []),
   Routine(True,  True,  "1", "nrm2",  T, [S,D,Sc,Dz],["n"], [], ["x"], ["nrm2"], [], "2*n", "Euclidian norm of a vector", "Accumulates the square of each element in the x vector and takes the square root. The resulting L2 norm is stored in the nrm2 buffer.", []),
@@ -79,7 +80,7 @@ routines = [
   Routine(True,  False, "1", "min",   T, [iS,iD,iC,iZ],["n"], [], ["x"], ["imin"], [], "2*n", "Index of minimum value in a vector (non-BLAS function)", "Finds the index of the minimum of the values in the x vector. The resulting integer index is stored in the imin buffer. This routine is the non-absolute minimum version of the IxAMAX BLAS routine.", []),
 ],
 [ # Level 2: matrix-vector
-  Routine(True,  True,  "2a", "gemv",  T,  [S,D,C,Z], ["m","n"], ["layout","a_transpose"], ["a","x"], ["y"], ["alpha","beta"], "", "General matrix-vector multiplication", "Performs the operation y = alpha * A * x + beta * y, in which x is an input vector, y is an input and output vector, A is an input matrix, and alpha and beta are scalars. The matrix A can optionally be transposed before performing the operation.", []),
+  Routine(True,  True,  "2a", "gemv",  T,  [S,D,C,Z,H], ["m","n"], ["layout","a_transpose"], ["a","x"], ["y"], ["alpha","beta"], "", "General matrix-vector multiplication", "Performs the operation y = alpha * A * x + beta * y, in which x is an input vector, y is an input and output vector, A is an input matrix, and alpha and beta are scalars. The matrix A can optionally be transposed before performing the operation.", []),
   Routine(True,  True,  "2a", "gbmv",  T,  [S,D,C,Z], ["m","n","kl","ku"], ["layout","a_transpose"], ["a","x"], ["y"], ["alpha","beta"], "", "General banded matrix-vector multiplication", "Same operation as xGEMV, but matrix A is banded instead.", []),
   Routine(True,  True,  "2a", "hemv",  T,  [C,Z],     ["n"], ["layout","triangle"], ["a","x"], ["y"], ["alpha","beta"], "", "Hermitian matrix-vector multiplication", "Same operation as xGEMV, but matrix A is an Hermitian matrix instead.", []),
   Routine(True,  True,  "2a", "hbmv",  T,  [C,Z],     ["n","k"], ["layout","triangle"], ["a","x"], ["y"], ["alpha","beta"], "", "Hermitian banded matrix-vector multiplication", "Same operation as xGEMV, but matrix A is an Hermitian banded matrix instead.", []),
@@ -94,7 +95,7 @@ routines = [
   Routine(False, True,  "2a", "tbsv",  T,  [S,D,C,Z], ["n","k"], ["layout","triangle","a_transpose","diagonal"], ["a"], ["x"], [], "", "Solves a banded triangular system of equations", "", []),
   Routine(False, True,  "2a", "tpsv",  T,  [S,D,C,Z], ["n"], ["layout","triangle","a_transpose","diagonal"], ["ap"], ["x"], [], "", "Solves a packed triangular system of equations", "", []),
   # Level 2: matrix update
-  Routine(True,  True,  "2b", "ger",   T,  [S,D],     ["m","n"], ["layout"], ["x","y"], ["a"], ["alpha"], "", "General rank-1 matrix update", "", []),
+  Routine(True,  True,  "2b", "ger",   T,  [S,D,H],   ["m","n"], ["layout"], ["x","y"], ["a"], ["alpha"], "", "General rank-1 matrix update", "", []),
   Routine(True,  True,  "2b", "geru",  T,  [C,Z],     ["m","n"], ["layout"], ["x","y"], ["a"], ["alpha"], "", "General rank-1 complex matrix update", "", []),
   Routine(True,  True,  "2b", "gerc",  T,  [C,Z],     ["m","n"], ["layout"], ["x","y"], ["a"], ["alpha"], "", "General rank-1 complex conjugated matrix update", "", []),
   Routine(True,  True,  "2b", "her",   Tc, [Css,Zdd], ["n"], ["layout","triangle"], ["x"], ["a"], ["alpha"], "", "Hermitian rank-1 matrix update", "", []),
@@ -107,7 +108,7 @@ routines = [
   Routine(True,  True,  "2b", "spr2",  T,  [S,D],     ["n"], ["layout","triangle"], ["x","y"], ["ap"], ["alpha"], "", "Symmetric packed rank-2 matrix update", "", []),
 ],
 [ # Level 3: matrix-matrix
-  Routine(True,  True,  "3", "gemm",  T,  [S,D,C,Z], ["m","n","k"], ["layout","a_transpose","b_transpose"], ["a","b"], ["c"], ["alpha","beta"], "", "General matrix-matrix multiplication", "", []),
+  Routine(True,  True,  "3", "gemm",  T,  [S,D,C,Z,H], ["m","n","k"], ["layout","a_transpose","b_transpose"], ["a","b"], ["c"], ["alpha","beta"], "", "General matrix-matrix multiplication", "", [], custom_tests=True),
   Routine(True,  True,  "3", "symm",  T,  [S,D,C,Z], ["m","n"], ["layout","side","triangle"], ["a","b"], ["c"], ["alpha","beta"], "", "Symmetric matrix-matrix multiplication", "", []),
   Routine(True,  True,  "3", "hemm",  T,  [C,Z],     ["m","n"], ["layout","side","triangle"], ["a","b"], ["c"], ["alpha","beta"], "", "Hermitian matrix-matrix multiplication", "", []),
   Routine(True,  True,  "3", "syrk",  T,  [S,D,C,Z], ["n","k"], ["layout","triangle","a_transpose"], ["a"], ["c"], ["alpha","beta"], "", "Rank-K update of a symmetric matrix", "", []),
@@ -116,8 +117,20 @@ routines = [
   Routine(True,  True,  "3", "her2k", TU, [Ccs,Zzd], ["n","k"], ["layout","triangle","ab_transpose"], ["a","b"], ["c"], ["alpha","beta"], "", "Rank-2K update of a hermitian matrix", "", []),
   Routine(True,  True,  "3", "trmm",  T,  [S,D,C,Z], ["m","n"], ["layout","side","triangle","a_transpose","diagonal"], ["a"], ["b"], ["alpha"], "", "Triangular matrix-matrix multiplication", "", []),
   Routine(False, True,  "3", "trsm",  T,  [S,D,C,Z], ["m","n"], ["layout","side","triangle","a_transpose","diagonal"], ["a"], ["b"], ["alpha"], "", "Solves a triangular system of equations", "", []),
+],
+[ # Level X: extra routines (not part of BLAS)
+  Routine(True,  True,  "x", "gemmstridedbatched", T, [S,D,C,Z], ["m","n","k"], ["layout","a_transpose","b_transpose"], ["a","b"], ["c"], ["alpha","beta"], "", "Strided-batched version of GEMM", "Performs the matrix product C = alpha * A * B + beta * C for a batch of matrices: the i-th matrix of each batch starts at the given offset plus i times the stride of that matrix. All multiplications are computed by a single kernel launch.", [], batched=True),
 ]]
 
+# The names of the levels as used in the paths of the tests
+level_names = ["1", "2", "3", "x"]
+
+# Routines which also have a handle-based variant (see 'CreateHandle'), i.e. all level-3 routines
+handle_routines = [r for r in routines[2] if r.implemented]
+
+# Routines which also have a workspace-size query and a workspace-based variant: as above
+workspace_routines = handle_routines
+
 # ==================================================================================================
 # Translates an option name to a CLBlast data-type
 def PrecisionToFullName(x):
@@ -142,6 +155,18 @@ separators = ["""
 """
 // =================================================================================================
 // BLAS level-3 (matrix-matrix) routines
+// =================================================================================================""",
+"""
+// =================================================================================================
+// Extra non-BLAS routines (level-X)
+// =================================================================================================""",
+"""
+// =================================================================================================
+// Handle-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================""",
+"""
+// =================================================================================================
+// Workspace-size queries and workspace-based variants of the BLAS level-3 (matrix-matrix) routines
 // ================================================================================================="""]
 
 # Main header/footer for source files
@@ -179,10 +204,10 @@ def clblast_cc(routines):
 		if routine.implemented:
 			result += routine.RoutineHeaderCPP(12, "")+" {\n"
 			result += "  auto queue_cpp = Queue(*queue);\n"
-			result += "  auto routine = X"+routine.name+"<"+routine.template.template+">(queue_cpp, event);\n"
+			result += "  auto routine = X"+routine.PlainName()+"<"+routine.template.template+">(queue_cpp, event);\n"
 			result += "  auto status = routine.SetUp();\n"
 			result += "  if (status != StatusCode::kSuccess) { return status; }\n"
-			result += "  return routine.Do"+routine.name.capitalize()+"("
+			result += "  return routine.Do"+routine.CapitalizedName()+"("
 			result += (",\n"+indent1).join([a for a in routine.ArgumentsCladuc(routine.template, indent1)])
 			result += ");\n"
 		else:
@@ -191,11 +216,83 @@ def clblast_cc(routines):
 		result += "}\n"
 		for flavour in routine.flavours:
 			indent2 = " "*(34 + routine.Length() + len(flavour.template))
-			result += "template StatusCode PUBLIC_API "+routine.name.capitalize()+"<"+flavour.template+">("
+			result += "template StatusCode PUBLIC_API "+routine.CapitalizedName()+"<"+flavour.template+">("
 			result += (",\n"+indent2).join([a for a in routine.ArgumentsType(flavour)])
 			result += ",\n"+indent2+"cl_command_queue*, cl_event*);\n"
 	return result
 
+# The C++ API header (.h): handle-based variants
+def clblast_h_handle(routines):
+	result = ""
+	for routine in routines:
+		result += "\n// "+routine.description+": "+routine.ShortNames()+"\n"
+		result += routine.RoutineHeaderHandleCPP(12, " = nullptr")+";\n"
+	return result
+
+# The C++ API implementation (.cc): handle-based variants
+def clblast_cc_handle(routines):
+	result = ""
+	for routine in routines:
+		indent1 = " "*(21 + routine.Length())
+		result += "\n// "+routine.description+": "+routine.ShortNames()+"\n"
+		result += routine.RoutineHeaderHandleCPP(12, "")+" {\n"
+		result += "  auto routine = static_cast<X"+routine.PlainName()+"<"+routine.template.template+">*>(nullptr);\n"
+		result += "  auto status = GetRoutine(handle, event, routine);\n"
+		result += "  if (status != StatusCode::kSuccess) { return status; }\n"
+		result += "  return routine->Do"+routine.CapitalizedName()+"("
+		result += (",\n"+indent1).join([a for a in routine.ArgumentsCladuc(routine.template, indent1)])
+		result += ");\n"
+		result += "}\n"
+		for flavour in routine.flavours:
+			result += routine.RoutineHeaderHandleTypeCPP(flavour, 34)+";\n"
+	return result
+
+# The C++ API header (.h): workspace-size queries and workspace-based variants
+def clblast_h_workspace(routines):
+	result = ""
+	for routine in routines:
+		result += "\n// "+routine.description+": "+routine.ShortNames()+"\n"
+		result += routine.RoutineHeaderWorkspaceSizeCPP(12)+";\n"
+		result += routine.RoutineHeaderWorkspaceCPP(12, " = nullptr")+";\n"
+	return result
+
+# The C++ API implementation (.cc): workspace-size queries and workspace-based variants
+def clblast_cc_workspace(routines):
+	result = ""
+	for routine in routines:
+		routine_class = "X"+routine.PlainName()+"<"+routine.template.template+">"
+		indent1 = " "*(20 + routine.Length())
+		indent2 = " "*(42 + routine.Length())
+		indent3 = " "*(45 + routine.Length())
+		result += "\n// "+routine.description+": "+routine.ShortNames()+"\n"
+		result += routine.RoutineHeaderWorkspaceSizeCPP(12)+" {\n"
+		result += "  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }\n"
+		result += "  auto queue_cpp = Queue(*queue);\n"
+		result += "  auto routine = "+routine_class+"(queue_cpp, nullptr);\n"
+		result += "  *workspace_size = routine."+routine.CapitalizedName()+"WorkspaceSize("
+		result += (",\n"+indent2).join(routine.Options() + routine.Sizes())+");\n"
+		result += "  return StatusCode::kSuccess;\n"
+		result += "}\n"
+		for flavour in routine.flavours:
+			result += routine.RoutineHeaderWorkspaceSizeTypeCPP(flavour, 34)+";\n"
+		result += "\n"+routine.RoutineHeaderWorkspaceCPP(12, "")+" {\n"
+		result += "  auto queue_cpp = Queue(*queue);\n"
+		result += "  auto routine = "+routine_class+"(queue_cpp, event);\n"
+		result += "  auto status = routine.SetUp();\n"
+		result += "  if (status != StatusCode::kSuccess) { return status; }\n"
+		result += "  if (workspace_size < routine."+routine.CapitalizedName()+"WorkspaceSize("
+		result += (",\n"+indent3).join(routine.Options() + routine.Sizes())+")) {\n"
+		result += "    return StatusCode::kInsufficientMemoryTemp;\n"
+		result += "  }\n"
+		result += "  routine.SetWorkspace(workspace, workspace_size);\n"
+		result += "  return routine.Do"+routine.CapitalizedName()+"("
+		result += (",\n"+indent1).join([a for a in routine.ArgumentsCladuc(routine.template, indent1)])
+		result += ");\n"
+		result += "}\n"
+		for flavour in routine.flavours:
+			result += routine.RoutineHeaderWorkspaceTypeCPP(flavour, 34)+";\n"
+	return result
+
 # ==================================================================================================
 
 # The C API header (.h)
@@ -216,12 +313,72 @@ def clblast_c_cc(routines):
 			template = "<"+flavour.template+">" if routine.NoScalars() else ""
 			indent = " "*(26 + routine.Length() + len(template))
 			result += routine.RoutineHeaderC(flavour, 20, "")+" {\n"
-			result += "  auto status = clblast::"+routine.name.capitalize()+template+"("
+			result += "  auto status = clblast::"+routine.CapitalizedName()+template+"("
 			result += (",\n"+indent).join([a for a in routine.ArgumentsCast(flavour, indent)])
 			result += ",\n"+indent+"queue, event);"
 			result += "\n  return static_cast<StatusCode>(status);\n}\n"
 	return result
 
+# The C API header (.h): handle-based variants
+def clblast_c_h_handle(routines):
+	result = ""
+	for routine in routines:
+		result += "\n// "+routine.description+": "+routine.ShortNames()+"\n"
+		for flavour in routine.flavours:
+			result += routine.RoutineHeaderHandleC(flavour, 31, " PUBLIC_API")+";\n"
+	return result
+
+# The C API implementation (.cc): handle-based variants
+def clblast_c_cc_handle(routines):
+	result = ""
+	for routine in routines:
+		result += "\n// "+routine.name.upper()+"\n"
+		for flavour in routine.flavours:
+			template = "<"+flavour.template+">" if routine.NoScalars() else ""
+			indent = " "*(26 + routine.Length() + len(template))
+			result += routine.RoutineHeaderHandleC(flavour, 20, "")+" {\n"
+			result += "  auto status = clblast::"+routine.CapitalizedName()+template+"("
+			result += "reinterpret_cast<clblast::Handle>(handle),\n"+indent
+			result += (",\n"+indent).join([a for a in routine.ArgumentsCast(flavour, indent)])
+			result += ",\n"+indent+"event);"
+			result += "\n  return static_cast<StatusCode>(status);\n}\n"
+	return result
+
+# The C API header (.h): workspace-size queries and workspace-based variants
+def clblast_c_h_workspace(routines):
+	result = ""
+	for routine in routines:
+		result += "\n// "+routine.description+": "+routine.ShortNames()+"\n"
+		for flavour in routine.flavours:
+			result += routine.RoutineHeaderWorkspaceSizeC(flavour, 31, " PUBLIC_API")+";\n"
+		for flavour in routine.flavours:
+			result += routine.RoutineHeaderWorkspaceC(flavour, 31, " PUBLIC_API")+";\n"
+	return result
+
+# The C API implementation (.cc): workspace-size queries and workspace-based variants
+def clblast_c_cc_workspace(routines):
+	result = ""
+	for routine in routines:
+		result += "\n// "+routine.name.upper()+"\n"
+		for flavour in routine.flavours:
+			template = "<"+flavour.template+">"
+			indent = " "*(39 + routine.Length() + len(template))
+			result += routine.RoutineHeaderWorkspaceSizeC(flavour, 20, "")+" {\n"
+			result += "  auto status = clblast::"+routine.CapitalizedName()+"WorkspaceSize"+template+"("
+			result += (",\n"+indent).join(routine.OptionsCast(indent) + routine.Sizes())
+			result += ",\n"+indent+"queue, workspace_size);"
+			result += "\n  return static_cast<StatusCode>(status);\n}\n"
+		for flavour in routine.flavours:
+			template = "<"+flavour.template+">" if routine.NoScalars() else ""
+			indent = " "*(26 + routine.Length() + len(template))
+			result += routine.RoutineHeaderWorkspaceC(flavour, 20, "")+" {\n"
+			result += "  auto status = clblast::"+routine.CapitalizedName()+template+"("
+			result += (",\n"+indent).join([a for a in routine.ArgumentsCast(flavour, indent)])
+			result += ",\n"+indent+"workspace, workspace_size,"
+			result += "\n"+indent+"queue, event);"
+			result += "\n  return static_cast<StatusCode>(status);\n}\n"
+	return result
+
 # ==================================================================================================
 
 # The wrapper to the reference clBLAS routines (for performance/correctness testing)
@@ -235,6 +392,22 @@ def wrapper_clblas(routines):
 			for flavour in routine.flavours:
 				indent = " "*(17 + routine.Length())
 				result += routine.RoutineHeaderWrapperCL(flavour, False, 21)+" {\n"
+
+				# There is no half-precision clBLAS: converts to single-precision and back
+				if flavour == H:
+					template = "<float>" if routine.NoScalars() else ""
+					indent = " "*(24 + routine.Length() + len(template))
+					buffers = routine.inputs + [o for o in routine.outputs if o not in routine.inputs]
+					for buffer in buffers:
+						result += "  auto "+buffer+"_buffer_bis = HalfToFloatBuffer("+buffer+"_buffer, queues[0]);\n"
+					result += "  auto status = clblasX"+routine.name+template+"("
+					result += (",\n"+indent).join([a for a in routine.ArgumentsWrapperHalf("()")])
+					result += ",\n"+indent+"num_queues, queues, num_wait_events, wait_events, events);\n"
+					for buffer in routine.outputs:
+						result += "  FloatToHalfBuffer("+buffer+"_buffer, "+buffer+"_buffer_bis, queues[0]);\n"
+					result += "  return status;\n}\n"
+					continue
+
 				arguments = routine.ArgumentsWrapperCL(flavour)
 				if routine.scratch:
 					result += "  auto queue = Queue(queues[0]);\n"
@@ -256,6 +429,21 @@ def wrapper_cblas(routines):
 			for flavour in routine.flavours:
 				indent = " "*(10 + routine.Length())
 				result += routine.RoutineHeaderWrapperC(flavour, False, 12)+" {\n"
+
+				# There is no half-precision CBLAS: converts to single-precision and back
+				if flavour == H:
+					indent = " "*(9 + routine.Length())
+					buffers = routine.inputs + [o for o in routine.outputs if o not in routine.inputs]
+					for buffer in buffers:
+						result += "  auto "+buffer+"_buffer_bis = HalfToFloatBuffer("+buffer+"_buffer);\n"
+					result += "  cblasX"+routine.name+"("
+					result += (",\n"+indent).join([a for a in routine.ArgumentsWrapperHalf("")])
+					result += ");\n"
+					for buffer in routine.outputs:
+						result += "  FloatToHalfBuffer("+buffer+"_buffer, "+buffer+"_buffer_bis);\n"
+					result += "}\n"
+					continue
+
 				arguments = routine.ArgumentsWrapperC(flavour)
 
 				# Double-precision scalars
@@ -309,8 +497,8 @@ files = [
   path_clblast+"/test/wrapper_clblas.h",
   path_clblast+"/test/wrapper_cblas.h",
 ]
-header_lines = [84, 71, 93, 22, 29, 41]
-footer_lines = [17, 71, 19, 14, 6, 6]
+header_lines = [96, 89, 104, 22, 52, 51]
+footer_lines = [186, 525, 216, 321, 6, 6]
 
 # Checks whether the command-line arguments are valid; exists otherwise
 for f in files:
@@ -332,7 +520,9 @@ for i in xrange(0,len(files)):
 	# Re-writes the body of the file
 	with open(files[i], "w") as f:
 		body = ""
-		for level in [1,2,3]:
+		for level in [1,2,3,4]:
+			if level == 4 and i in [4,5]:
+				continue # the batched routines have no reference BLAS equivalent
 			body += separators[level-1]+"\n"
 			if i == 0:
 				body += clblast_h(routines[level-1])
@@ -346,21 +536,40 @@ for i in xrange(0,len(files)):
 				body += wrapper_clblas(routines[level-1])
 			if i == 5:
 				body += wrapper_cblas(routines[level-1])
+		if i in [0,1,2,3]:
+			body += separators[4]+"\n"
+			if i == 0:
+				body += clblast_h_handle(handle_routines)
+			if i == 1:
+				body += clblast_cc_handle(handle_routines)
+			if i == 2:
+				body += clblast_c_h_handle(handle_routines)
+			if i == 3:
+				body += clblast_c_cc_handle(handle_routines)
+			body += separators[5]+"\n"
+			if i == 0:
+				body += clblast_h_workspace(workspace_routines)
+			if i == 1:
+				body += clblast_cc_workspace(workspace_routines)
+			if i == 2:
+				body += clblast_c_h_workspace(workspace_routines)
+			if i == 3:
+				body += clblast_c_cc_workspace(workspace_routines)
 		f.write("".join(file_header))
 		f.write(body)
 		f.write("".join(file_footer))
 
 # ==================================================================================================
 
-# Outputs all the correctness-test implementations
-for level in [1,2,3]:
+# Outputs all the correctness-test implementations, except for those extended by hand
+for level in [1,2,3,4]:
 	for routine in routines[level-1]:
-		if routine.has_tests:
-			filename = path_clblast+"/test/correctness/routines/level"+str(level)+"/x"+routine.name+".cc"
+		if routine.has_tests and not routine.custom_tests:
+			filename = path_clblast+"/test/correctness/routines/level"+level_names[level-1]+"/x"+routine.name+".cc"
 			with open(filename, "w") as f:
 				body = ""
 				body += "#include \"correctness/testblas.h\"\n"
-				body += "#include \"routines/level"+str(level)+"/x"+routine.name+".h\"\n\n"
+				body += "#include \"routines/level"+level_names[level-1]+"/x"+routine.name+".h\"\n\n"
 				body += "// Shortcuts to the clblast namespace\n"
 				body += "using float2 = clblast::float2;\n"
 				body += "using double2 = clblast::double2;\n\n"
@@ -368,7 +577,7 @@ for level in [1,2,3]:
 				body += "int main(int argc, char *argv[]) {\n"
 				not_first = "false"
 				for flavour in routine.flavours:
-					body += "  clblast::RunTests<clblast::TestX"+routine.name+flavour.TestTemplate()
+					body += "  clblast::RunTests<clblast::TestX"+routine.PlainName()+flavour.TestTemplate()
 					body += ">(argc, argv, "+not_first+", \""+flavour.name+routine.name.upper()+"\");\n"
 					not_first = "true"
 				body += "  return 0;\n"
@@ -378,14 +587,14 @@ for level in [1,2,3]:
 				f.write(footer)
 
 # Outputs all the performance-test implementations
-for level in [1,2,3]:
+for level in [1,2,3,4]:
 	for routine in routines[level-1]:
 		if routine.has_tests:
-			filename = path_clblast+"/test/performance/routines/level"+str(level)+"/x"+routine.name+".cc"
+			filename = path_clblast+"/test/performance/routines/level"+level_names[level-1]+"/x"+routine.name+".cc"
 			with open(filename, "w") as f:
 				body = ""
 				body += "#include \"performance/client.h\"\n"
-				body += "#include \"routines/level"+str(level)+"/x"+routine.name+".h\"\n\n"
+				body += "#include \"routines/level"+level_names[level-1]+"/x"+routine.name+".h\"\n\n"
 				body += "// Shortcuts to the clblast namespace\n"
 				body += "using float2 = clblast::float2;\n"
 				body += "using double2 = clblast::double2;\n\n"
@@ -398,7 +607,7 @@ for level in [1,2,3]:
 					found = False
 					for flavour in routine.flavours:
 						if flavour.precision_name == precision:
-							body += "\n      clblast::RunClient<clblast::TestX"+routine.name+flavour.TestTemplate()
+							body += "\n      clblast::RunClient<clblast::TestX"+routine.PlainName()+flavour.TestTemplate()
 							body += ">(argc, argv); break;\n"
 							found = True
 					if not found:
@@ -422,7 +631,7 @@ with open(filename, "w") as f:
 	f.write("\n\n")
 
 	# Loops over the routines
-	for level in [1,2,3]:
+	for level in [1,2,3,4]:
 		for routine in routines[level-1]:
 			if routine.implemented:
 
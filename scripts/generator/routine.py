@@ -68,7 +68,8 @@ def OptionToDoc(x):
 # Class holding routine-specific information (e.g. name, which arguments, which precisions)
 class Routine():
 	def __init__(self, implemented, has_tests, level, name, template, flavours, sizes, options,
-	             inputs, outputs, scalars, scratch, description, details, requirements):
+	             inputs, outputs, scalars, scratch, description, details, requirements, batched=False,
+	             custom_tests=False):
 		self.implemented = implemented
 		self.has_tests = has_tests
 		self.level = level
@@ -84,6 +85,8 @@ class Routine():
 		self.description = description
 		self.details = details
 		self.requirements = requirements
+		self.batched = batched # Strided-batched routine (e.g. GemmStridedBatched)
+		self.custom_tests = custom_tests # Correctness-test main function extended by hand
 
 	# List of scalar buffers
 	def ScalarBuffersFirst(self):
@@ -107,6 +110,16 @@ class Routine():
 	def Length(self):
 		return len(self.name)
 
+	# Retrieves the name of the routine as used in the C++ API (e.g. 'Gemm' or 'GemmStridedBatched')
+	def CapitalizedName(self):
+		if self.batched:
+			return self.name.capitalize().replace("stridedbatched", "StridedBatched")
+		return self.name.capitalize()
+
+	# As above, but as used in the names of the classes and of the C API (e.g. 'gemmStridedBatched')
+	def PlainName(self):
+		return self.name[0]+self.CapitalizedName()[1:]
+
 	# Retrieves the postfix for a buffer
 	def Postfix(self, name):
 		return "inc" if (name in ["x","y"]) else "ld"
@@ -137,13 +150,18 @@ class Routine():
 
 	# ==============================================================================================
 
+	# Determines whether a buffer holds a batch of matrices, and thus has a stride between them
+	def IsStridedBuffer(self, name):
+		return self.batched and (name in ["a","b","c"])
+
 	# Retrieves a variable name for a specific input/output vector/matrix (e.g. 'x')
 	def Buffer(self, name):
 		if (name in self.inputs) or (name in self.outputs):
 			a = [name+"_buffer"]
 			b = [name+"_offset"]
 			c = [name+"_"+self.Postfix(name)] if (name not in self.BuffersWithoutLdInc()) else []
-			return [", ".join(a+b+c)]
+			d = [name+"_stride"] if self.IsStridedBuffer(name) else []
+			return [", ".join(a+b+c+d)]
 		return []
 
 	# As above but with data-types
@@ -153,7 +171,8 @@ class Routine():
 			a = [prefix+"cl_mem "+name+"_buffer"]
 			b = ["const size_t "+name+"_offset"]
 			c = ["const size_t "+name+"_"+self.Postfix(name)] if (name not in self.BuffersWithoutLdInc()) else []
-			return [", ".join(a+b+c)]
+			d = ["const size_t "+name+"_stride"] if self.IsStridedBuffer(name) else []
+			return [", ".join(a+b+c+d)]
 		return []
 
 	# As above but as vectors
@@ -173,7 +192,8 @@ class Routine():
 			a = ["Buffer<"+buffertype+">("+name+"_buffer)"]
 			b = [name+"_offset"]
 			c = [name+"_"+self.Postfix(name)] if (name not in self.BuffersWithoutLdInc()) else []
-			return [", ".join(a+b+c)]
+			d = [name+"_stride"] if self.IsStridedBuffer(name) else []
+			return [", ".join(a+b+c+d)]
 		return []
 
 	# As above but with a static cast for clBLAS wrapper
@@ -207,6 +227,15 @@ class Routine():
 			return [", ".join(a+c)]
 		return []
 
+	# As above, but for the half-precision wrappers: the single-precision copy of the buffer
+	def BufferWrapperHalf(self, name, use):
+		if (name in self.inputs) or (name in self.outputs):
+			a = [name+"_buffer_bis"+use]
+			b = [name+"_offset"]
+			c = [name+"_"+self.Postfix(name)] if (name not in self.BuffersWithoutLdInc()) else []
+			return [", ".join(a+b+c)]
+		return []
+
 	# As above, but only data-types
 	def BufferType(self, name):
 		prefix = "const " if (name in self.inputs) else ""
@@ -214,7 +243,8 @@ class Routine():
 			a = [prefix+"cl_mem"]
 			b = ["const size_t"]
 			c = ["const size_t"] if (name not in self.BuffersWithoutLdInc()) else []
-			return [", ".join(a+b+c)]
+			d = ["const size_t"] if self.IsStridedBuffer(name) else []
+			return [", ".join(a+b+c+d)]
 		return []
 
 	# Retrieves the documentation of the buffers
@@ -227,7 +257,8 @@ class Routine():
 			a = ["`"+prefix+"cl_mem "+name+"_buffer`: OpenCL buffer to store the "+inout+" "+math_name+"."]
 			b = ["`const size_t "+name+"_offset`: The offset in elements from the start of the "+inout+" "+math_name+"."]
 			c = ["`const size_t "+name+"_"+self.Postfix(name)+"`: "+incld_description+"of the "+inout+" "+math_name+"."] if (name not in self.BuffersWithoutLdInc()) else []
-			return a+b+c
+			d = ["`const size_t "+name+"_stride`: Stride in elements between two consecutive "+name.upper()+" matrices of the batch."] if self.IsStridedBuffer(name) else []
+			return a+b+c+d
 		return []
 
 	# ==============================================================================================
@@ -266,6 +297,12 @@ class Routine():
 			return [name]
 		return []
 
+	# Retrieves the use of a scalar for the half-precision wrappers (alpha/beta)
+	def ScalarUseWrapperHalf(self, name):
+		if name in self.scalars:
+			return ["HalfToFloat("+name+")"]
+		return []
+
 	# Retrieves the definition of a scalar (alpha/beta)
 	def ScalarDef(self, name, flavour):
 		if name in self.scalars:
@@ -377,6 +414,24 @@ class Routine():
 
 	# ==============================================================================================
 
+	# Retrieves the batch count of a batched routine
+	def BatchCount(self):
+		return ["batch_count"] if self.batched else []
+
+	# Retrieves the definition of the batch count
+	def BatchCountDef(self):
+		return ["const size_t batch_count"] if self.batched else []
+
+	# Retrieves the type of the batch count
+	def BatchCountType(self):
+		return ["const size_t"] if self.batched else []
+
+	# Retrieves the documentation of the batch count
+	def BatchCountDoc(self):
+		return ["`const size_t batch_count`: Number of matrix multiplications in the batch."] if self.batched else []
+
+	# ==============================================================================================
+
 	# Retrieves a combination of all the argument names, with Claduc casts
 	def ArgumentsCladuc(self, flavour, indent):
 		return (self.Options() + self.Sizes() +
@@ -386,7 +441,8 @@ class Routine():
 		        self.Scalar("beta") +
 		        list(chain(*[self.BufferCladuc(b) for b in self.BuffersSecond()])) +
 		        list(chain(*[self.BufferCladuc(b) for b in self.ScalarBuffersSecond()])) +
-		        list(chain(*[self.Scalar(s) for s in self.OtherScalars()])))
+		        list(chain(*[self.Scalar(s) for s in self.OtherScalars()])) +
+		        self.BatchCount())
 
 	# Retrieves a combination of all the argument names, with CLBlast casts
 	def ArgumentsCast(self, flavour, indent):
@@ -397,7 +453,8 @@ class Routine():
 		        self.ScalarUse("beta", flavour) +
 		        list(chain(*[self.Buffer(b) for b in self.BuffersSecond()])) +
 		        list(chain(*[self.Buffer(b) for b in self.ScalarBuffersSecond()])) +
-		        list(chain(*[self.ScalarUse(s, flavour) for s in self.OtherScalars()])))
+		        list(chain(*[self.ScalarUse(s, flavour) for s in self.OtherScalars()])) +
+		        self.BatchCount())
 
 	# As above, but for the clBLAS wrapper
 	def ArgumentsWrapperCL(self, flavour):
@@ -420,6 +477,17 @@ class Routine():
 		        list(chain(*[self.BufferWrapperC(b, flavour) for b in self.ScalarBuffersSecond()])) +
 		        list(chain(*[self.ScalarUseWrapperC(s, flavour) for s in self.OtherScalars()])))
 
+	# As above, but for the half-precision wrappers, which forward to the single-precision wrappers
+	def ArgumentsWrapperHalf(self, use):
+		return (self.Options() + self.Sizes() +
+		        list(chain(*[self.BufferWrapperHalf(b, use) for b in self.ScalarBuffersFirst()])) +
+		        self.ScalarUseWrapperHalf("alpha") +
+		        list(chain(*[self.BufferWrapperHalf(b, use) for b in self.BuffersFirst()])) +
+		        self.ScalarUseWrapperHalf("beta") +
+		        list(chain(*[self.BufferWrapperHalf(b, use) for b in self.BuffersSecond()])) +
+		        list(chain(*[self.BufferWrapperHalf(b, use) for b in self.ScalarBuffersSecond()])) +
+		        list(chain(*[self.ScalarUseWrapperHalf(s) for s in self.OtherScalars()])))
+
 	# Retrieves a combination of all the argument definitions
 	def ArgumentsDef(self, flavour):
 		return (self.OptionsDef() + self.SizesDef() +
@@ -429,7 +497,8 @@ class Routine():
 		        self.ScalarDef("beta", flavour) +
 		        list(chain(*[self.BufferDef(b) for b in self.BuffersSecond()])) +
 		        list(chain(*[self.BufferDef(b) for b in self.ScalarBuffersSecond()])) +
-		        list(chain(*[self.ScalarDef(s, flavour) for s in self.OtherScalars()])))
+		        list(chain(*[self.ScalarDef(s, flavour) for s in self.OtherScalars()])) +
+		        self.BatchCountDef())
 
 	# As above, but clBLAS wrapper plain datatypes
 	def ArgumentsDefWrapperCL(self, flavour):
@@ -462,7 +531,8 @@ class Routine():
 		        self.ScalarType("beta", flavour) +
 		        list(chain(*[self.BufferType(b) for b in self.BuffersSecond()])) +
 		        list(chain(*[self.BufferType(b) for b in self.ScalarBuffersSecond()])) +
-		        list(chain(*[self.ScalarType(s, flavour) for s in self.OtherScalars()])))
+		        list(chain(*[self.ScalarType(s, flavour) for s in self.OtherScalars()])) +
+		        self.BatchCountType())
 	
 	# Retrieves a combination of all the argument types
 	def ArgumentsDoc(self):
@@ -474,7 +544,8 @@ class Routine():
 		        self.ScalarDoc("beta") +
 		        list(chain(*[self.BufferDoc(b) for b in self.BuffersSecond()])) +
 		        list(chain(*[self.BufferDoc(b) for b in self.ScalarBuffersSecond()])) +
-		        list(chain(*[self.ScalarDoc(s) for s in self.OtherScalars()])))
+		        list(chain(*[self.ScalarDoc(s) for s in self.OtherScalars()])) +
+		        self.BatchCountDoc())
 
 	# ==============================================================================================
 
@@ -488,7 +559,7 @@ class Routine():
 	def RoutineHeaderCPP(self, spaces, default_event):
 		indent = " "*(spaces + self.Length())
 		result = "template <"+self.template.name+">\n"
-		result += "StatusCode "+self.name.capitalize()+"("
+		result += "StatusCode "+self.CapitalizedName()+"("
 		result += (",\n"+indent).join([a for a in self.ArgumentsDef(self.template)])
 		result += ",\n"+indent+"cl_command_queue* queue, cl_event* event"+default_event+")"
 		return result
@@ -497,16 +568,94 @@ class Routine():
 	def RoutineHeaderTypeCPP(self, spaces):
 		indent = " "*(spaces + self.Length())
 		result = "template <"+self.template.name+">\n"
-		result += "StatusCode "+self.name.capitalize()+"("
+		result += "StatusCode "+self.CapitalizedName()+"("
 		result += (",\n"+indent).join([a for a in self.ArgumentsType(self.template)])
 		result += ",\n"+indent+"cl_command_queue*, cl_event*)"
 		return result
 
+	# As above, but now for the handle-based variant of the routine
+	def RoutineHeaderHandleCPP(self, spaces, default_event):
+		indent = " "*(spaces + self.Length())
+		result = "template <"+self.template.name+">\n"
+		result += "StatusCode "+self.CapitalizedName()+"(Handle handle,\n"+indent
+		result += (",\n"+indent).join([a for a in self.ArgumentsDef(self.template)])
+		result += ",\n"+indent+"cl_event* event"+default_event+")"
+		return result
+
+	# As above, but now without variable names
+	def RoutineHeaderHandleTypeCPP(self, flavour, spaces):
+		indent = " "*(spaces + self.Length() + len(flavour.template))
+		result = "template StatusCode PUBLIC_API "+self.CapitalizedName()+"<"+flavour.template+">(Handle,\n"+indent
+		result += (",\n"+indent).join([a for a in self.ArgumentsType(flavour)])
+		result += ",\n"+indent+"cl_event*)"
+		return result
+
+	# As above, but now for the workspace-size query of the routine
+	def RoutineHeaderWorkspaceSizeCPP(self, spaces):
+		indent = " "*(spaces + self.Length() + len("WorkspaceSize"))
+		result = "template <"+self.template.name+">\n"
+		result += "StatusCode "+self.CapitalizedName()+"WorkspaceSize("
+		result += (",\n"+indent).join([a for a in self.OptionsDef() + self.SizesDef()])
+		result += ",\n"+indent+"cl_command_queue* queue, size_t* workspace_size)"
+		return result
+
+	# As above, but now without variable names
+	def RoutineHeaderWorkspaceSizeTypeCPP(self, flavour, spaces):
+		indent = " "*(spaces + self.Length() + len("WorkspaceSize") + len(flavour.template))
+		result = "template StatusCode PUBLIC_API "+self.CapitalizedName()+"WorkspaceSize<"+flavour.template+">("
+		result += (",\n"+indent).join([a for a in self.OptionsType() + self.SizesType()])
+		result += ",\n"+indent+"cl_command_queue*, size_t*)"
+		return result
+
+	# As above, but now for the workspace-based variant of the routine
+	def RoutineHeaderWorkspaceCPP(self, spaces, default_event):
+		indent = " "*(spaces + self.Length())
+		result = "template <"+self.template.name+">\n"
+		result += "StatusCode "+self.CapitalizedName()+"("
+		result += (",\n"+indent).join([a for a in self.ArgumentsDef(self.template)])
+		result += ",\n"+indent+"cl_mem workspace, const size_t workspace_size"
+		result += ",\n"+indent+"cl_command_queue* queue, cl_event* event"+default_event+")"
+		return result
+
+	# As above, but now without variable names
+	def RoutineHeaderWorkspaceTypeCPP(self, flavour, spaces):
+		indent = " "*(spaces + self.Length() + len(flavour.template))
+		result = "template StatusCode PUBLIC_API "+self.CapitalizedName()+"<"+flavour.template+">("
+		result += (",\n"+indent).join([a for a in self.ArgumentsType(flavour)])
+		result += ",\n"+indent+"cl_mem, const size_t"
+		result += ",\n"+indent+"cl_command_queue*, cl_event*)"
+		return result
+
 	# As above, but now for C
 	def RoutineHeaderC(self, flavour, spaces, extra_qualifier):
 		indent = " "*(spaces + self.Length())
-		result = "StatusCode"+extra_qualifier+" CLBlast"+flavour.name+self.name+"("
+		result = "StatusCode"+extra_qualifier+" CLBlast"+flavour.name+self.PlainName()+"("
+		result += (",\n"+indent).join([a for a in self.ArgumentsDef(flavour)])
+		result += ",\n"+indent+"cl_command_queue* queue, cl_event* event)"
+		return result
+
+	# As above, but now for the handle-based variant of the routine
+	def RoutineHeaderHandleC(self, flavour, spaces, extra_qualifier):
+		indent = " "*(spaces + self.Length() + len("WithHandle"))
+		result = "StatusCode"+extra_qualifier+" CLBlast"+flavour.name+self.PlainName()+"WithHandle(CLBlastHandle handle,\n"+indent
+		result += (",\n"+indent).join([a for a in self.ArgumentsDef(flavour)])
+		result += ",\n"+indent+"cl_event* event)"
+		return result
+
+	# As above, but now for the workspace-size query of the routine
+	def RoutineHeaderWorkspaceSizeC(self, flavour, spaces, extra_qualifier):
+		indent = " "*(spaces + self.Length() + len("WorkspaceSize"))
+		result = "StatusCode"+extra_qualifier+" CLBlast"+flavour.name+self.PlainName()+"WorkspaceSize("
+		result += (",\n"+indent).join([a for a in self.OptionsDef() + self.SizesDef()])
+		result += ",\n"+indent+"cl_command_queue* queue, size_t* workspace_size)"
+		return result
+
+	# As above, but now for the workspace-based variant of the routine
+	def RoutineHeaderWorkspaceC(self, flavour, spaces, extra_qualifier):
+		indent = " "*(spaces + self.Length() + len("WithWorkspace"))
+		result = "StatusCode"+extra_qualifier+" CLBlast"+flavour.name+self.PlainName()+"WithWorkspace("
 		result += (",\n"+indent).join([a for a in self.ArgumentsDef(flavour)])
+		result += ",\n"+indent+"cl_mem workspace, const size_t workspace_size"
 		result += ",\n"+indent+"cl_command_queue* queue, cl_event* event)"
 		return result
 
@@ -0,0 +1,235 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the pool of temporary device buffers (see the header for details).
+//
+// =================================================================================================
+
+#include <map>
+#include <tuple>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+
+#include "internal/buffer_pool.h"
+
+namespace clblast {
+namespace pool {
+// =================================================================================================
+
+// The smallest size class of a buffer in bytes
+constexpr auto kMinimumSizeClass = size_t{4096};
+
+// An idle buffer in the pool. While idle, it holds a reference to the queue it was last used on,
+// such that the queue (which is part of the key, see below) cannot be replaced by another one.
+struct IdleBuffer {
+  cl_mem buffer;
+  size_t last_used; // Value of the pool's clock when the buffer became idle
+};
+
+// The idle buffers, keyed on their context, the queue they were last used on, and their size class
+using PoolKey = std::tuple<cl_context, cl_command_queue, size_t>;
+static std::map<PoolKey, std::vector<IdleBuffer>> pool_;
+static std::mutex pool_mutex_;
+
+// The number and the total size of the idle buffers, and the pool's clock to find the least-
+// recently-used idle buffer (all protected by the mutex)
+static size_t num_idle_ = 0;
+static size_t idle_bytes_ = 0;
+static size_t pool_clock_ = 0;
+
+// The limit of the pool (zero meaning no pooling at all)
+static std::atomic<size_t> max_idle_bytes_{kDefaultMaxIdleBytes};
+
+// The memory budgets per context (see 'SetMemoryBudget'). The flag allows skipping the look-up
+// (and the locking) in the common case without any budget.
+static std::map<cl_context, size_t> memory_budgets_;
+static std::mutex memory_budgets_mutex_;
+static std::atomic<bool> has_memory_budgets_{false};
+
+// The statistics of the pool (see the header for details)
+static std::atomic<size_t> allocations_{0};
+static std::atomic<size_t> reuses_{0};
+static std::atomic<size_t> releases_{0};
+static std::atomic<size_t> bytes_in_use_{0};
+
+// =================================================================================================
+
+// Rounds a size up to its size class: a multiple of a quarter of the largest power of two below it.
+// Buffers of similar sizes thus share a size class, while at most 25% of the memory is unused.
+static size_t SizeClass(const size_t bytes) {
+  if (bytes <= kMinimumSizeClass) { return kMinimumSizeClass; }
+  auto power = kMinimumSizeClass;
+  while (power <= bytes / 2) { power *= 2; }
+  const auto step = power / 4;
+  return ((bytes + step - 1) / step) * step;
+}
+
+// Finds out whether a queue executes its commands in-order
+bool IsInOrderQueue(const cl_command_queue queue) {
+  auto properties = cl_command_queue_properties{0};
+  if (clGetCommandQueueInfo(queue, CL_QUEUE_PROPERTIES, sizeof(properties), &properties,
+                            nullptr) != CL_SUCCESS) {
+    return false;
+  }
+  return (properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) == 0;
+}
+
+// Releases an idle buffer, including its reference to the queue. Should be called with the mutex
+// held and after removing the buffer from the pool.
+static void ReleaseIdleBuffer(const PoolKey &key, const IdleBuffer &idle_buffer) {
+  clReleaseMemObject(idle_buffer.buffer);
+  clReleaseCommandQueue(std::get<1>(key));
+  num_idle_--;
+  idle_bytes_ -= std::get<2>(key);
+  releases_++;
+}
+
+// Releases the least-recently-used idle buffers until the pool is within its limit. Should be
+// called with the mutex held.
+static void EvictIdleBuffers() {
+  const auto max_idle_bytes = max_idle_bytes_.load();
+  while (idle_bytes_ > max_idle_bytes && !pool_.empty()) {
+    auto oldest = pool_.begin();
+    for (auto it = pool_.begin(); it != pool_.end(); ++it) {
+      if (it->second.front().last_used < oldest->second.front().last_used) { oldest = it; }
+    }
+    ReleaseIdleBuffer(oldest->first, oldest->second.front());
+    oldest->second.erase(oldest->second.begin());
+    if (oldest->second.empty()) { pool_.erase(oldest); }
+  }
+}
+
+// Makes a buffer idle, i.e. returns it to the pool (or releases it if it doesn't fit)
+static void ReturnBuffer(const PoolKey &key, const cl_mem buffer) {
+  bytes_in_use_ -= std::get<2>(key);
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  if (std::get<2>(key) > max_idle_bytes_) {
+    clReleaseMemObject(buffer);
+    releases_++;
+    return;
+  }
+  clRetainCommandQueue(std::get<1>(key));
+  pool_[key].push_back(IdleBuffer{buffer, pool_clock_++});
+  num_idle_++;
+  idle_bytes_ += std::get<2>(key);
+  EvictIdleBuffers();
+}
+
+// Allocates a new buffer. In case this fails, the idle buffers of the context are released first
+// before trying again: these might be occupying the memory.
+static cl_mem AllocateBuffer(const cl_context context, const size_t bytes) {
+  auto status = CL_SUCCESS;
+  auto buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, bytes, nullptr, &status);
+  if (status != CL_SUCCESS) {
+    ClearPool(context);
+    buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, bytes, nullptr, &status);
+  }
+  CheckError(status);
+  allocations_++;
+  return buffer;
+}
+
+// =================================================================================================
+
+// Retrieves an idle buffer of the right size class for this queue, or allocates a new one
+std::shared_ptr<cl_mem> AcquireBuffer(const Context &context, const Queue &queue,
+                                      const size_t bytes) {
+
+  // Without pooling: a regular buffer, which is released once it is no longer used
+  if (max_idle_bytes_ == 0 || !IsInOrderQueue(queue())) {
+    const auto buffer_bytes = std::max(bytes, size_t{1});
+    const auto buffer = AllocateBuffer(context(), buffer_bytes);
+    bytes_in_use_ += buffer_bytes;
+    return std::shared_ptr<cl_mem>(new cl_mem(buffer), [buffer_bytes](cl_mem* m) {
+      bytes_in_use_ -= buffer_bytes;
+      CheckError(clReleaseMemObject(*m));
+      delete m;
+    });
+  }
+
+  // Takes an idle buffer out of the pool, if any
+  const auto key = PoolKey{context(), queue(), SizeClass(bytes)};
+  auto buffer = cl_mem{nullptr};
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    const auto idle_buffers = pool_.find(key);
+    if (idle_buffers != pool_.end()) {
+      buffer = idle_buffers->second.back().buffer;
+      idle_buffers->second.pop_back();
+      if (idle_buffers->second.empty()) { pool_.erase(idle_buffers); }
+      clReleaseCommandQueue(std::get<1>(key)); // the caller holds a reference as well
+      num_idle_--;
+      idle_bytes_ -= std::get<2>(key);
+      reuses_++;
+    }
+  }
+
+  // Otherwise, allocates a new one
+  if (buffer == nullptr) { buffer = AllocateBuffer(context(), std::get<2>(key)); }
+  bytes_in_use_ += std::get<2>(key);
+  return std::shared_ptr<cl_mem>(new cl_mem(buffer), [key](cl_mem* m) {
+    ReturnBuffer(key, *m);
+    delete m;
+  });
+}
+
+// Releases the idle buffers of a context (or all idle buffers)
+void ClearPool(const cl_context context) {
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  for (auto it = pool_.begin(); it != pool_.end(); ) {
+    if (context != nullptr && std::get<0>(it->first) != context) { ++it; continue; }
+    for (const auto &idle_buffer: it->second) { ReleaseIdleBuffer(it->first, idle_buffer); }
+    it = pool_.erase(it);
+  }
+}
+
+// Sets the limit of the pool and immediately releases idle buffers if needed
+void SetPoolLimit(const size_t max_idle_bytes) {
+  max_idle_bytes_ = max_idle_bytes;
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  EvictIdleBuffers();
+}
+
+// Sets or removes the memory budget of a context
+void SetMemoryBudget(const cl_context context, const size_t max_bytes) {
+  std::lock_guard<std::mutex> lock(memory_budgets_mutex_);
+  if (max_bytes == 0) {
+    memory_budgets_.erase(context);
+  } else {
+    memory_budgets_[context] = max_bytes;
+  }
+  has_memory_budgets_ = !memory_budgets_.empty();
+}
+
+// Retrieves the memory budget of a context
+size_t GetMemoryBudget(const cl_context context) {
+  if (!has_memory_budgets_) { return 0; }
+  std::lock_guard<std::mutex> lock(memory_budgets_mutex_);
+  const auto budget = memory_budgets_.find(context);
+  return (budget == memory_budgets_.end()) ? 0 : budget->second;
+}
+
+// Retrieves the current statistics
+Statistics GetStatistics() {
+  auto statistics = Statistics();
+  statistics.allocations = allocations_;
+  statistics.reuses = reuses_;
+  statistics.releases = releases_;
+  statistics.bytes_in_use = bytes_in_use_;
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  statistics.num_idle = num_idle_;
+  statistics.idle_bytes = idle_bytes_;
+  return statistics;
+}
+
+// =================================================================================================
+} // namespace pool
+} // namespace clblast
@@ -14,6 +14,19 @@
 #include <string>
 #include <vector>
 #include <mutex>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <functional>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <algorithm>
+#include <unordered_map>
+#include <set>
 
 #include "internal/cache.h"
 
@@ -21,31 +34,143 @@ namespace clblast {
 namespace cache {
 // =================================================================================================
 
+// The actual program cache (see the header for details) and the mutex to serialize the writers
+static std::shared_ptr<const ProgramCache> program_cache_ = std::make_shared<const ProgramCache>();
+static std::mutex program_cache_mutex_;
+
+// The total size of the binaries in the binary cache (protected by the binary cache's mutex)
+static size_t binary_cache_bytes_ = 0;
+
+// The limits of the caches (zero meaning no limit)
+static std::atomic<size_t> max_binary_bytes_{kDefaultMaxBinaryBytes};
+static std::atomic<size_t> max_programs_{kDefaultMaxPrograms};
+
+// The clock of the cache, used to find the least-recently-used entries. It advances upon each new
+// entry, such that readers only need to read it, which is cheap even with many threads.
+static std::atomic<size_t> cache_clock_{0};
+
+// The statistics of the cache (see the header for details). The compilation time is in microseconds.
+static std::atomic<size_t> program_hits_{0};
+static std::atomic<size_t> program_misses_{0};
+static std::atomic<size_t> compilations_{0};
+static std::atomic<size_t> compilation_time_us_{0};
+static std::atomic<size_t> evictions_{0};
+
+// The per-thread kernel caches. Clearing the cache increments the generation counter, after which
+// each thread clears its own kernel cache upon its next access.
+static std::atomic<size_t> kernel_cache_generation_{0};
+static thread_local KernelCache kernel_cache_ = KernelCache{0, {}, {}};
+
+// The number of times the programs were cleared, i.e. not counting evictions (see the header)
+static std::atomic<size_t> clear_generation_{0};
+
+// Retrieves the kernel cache of the calling thread, clearing it first if it is outdated
+static KernelCache& GetKernelCache() {
+  const auto generation = kernel_cache_generation_.load();
+  if (kernel_cache_.generation != generation) {
+    kernel_cache_.kernels.clear();
+    kernel_cache_.local_mem_usages.clear();
+    kernel_cache_.generation = generation;
+  }
+  return kernel_cache_;
+}
+
+// =================================================================================================
+
+// Computes a 64-bit FNV-1a hash of a string and returns it in hexadecimal form
+static std::string HashString(const std::string &data) {
+  auto hash = uint64_t{14695981039346656037ULL};
+  for (const auto character: data) {
+    hash ^= static_cast<uint64_t>(static_cast<unsigned char>(character));
+    hash *= uint64_t{1099511628211ULL};
+  }
+  char result[17];
+  snprintf(result, sizeof(result), "%016llx", static_cast<unsigned long long>(hash));
+  return std::string{result};
+}
+
+// Computes the hash of a program's source: the above hash, extended with the source's length to make
+// accidental collisions even less likely
+std::string SourceHash(const std::string &source) {
+  return HashString(source) + "-" + ToString(source.size());
+}
+
+// =================================================================================================
+
+// Evicts the least-recently-used binaries until the cache is within its limit. The most recently
+// used binary is always kept. Assumes that the binary cache's mutex is held by the caller.
+static void EvictBinaries() {
+  const auto max_bytes = max_binary_bytes_.load();
+  if (max_bytes == 0) { return; }
+  while (binary_cache_bytes_ > max_bytes && binary_cache_.size() > 1) {
+    auto oldest = binary_cache_.begin();
+    for (auto it = binary_cache_.begin(); it != binary_cache_.end(); ++it) {
+      if (it->last_used < oldest->last_used) { oldest = it; }
+    }
+    binary_cache_bytes_ -= oldest->binary.size();
+    binary_cache_.erase(oldest);
+    evictions_++;
+  }
+}
+
+// Evicts the least-recently-used programs from a new version of the program cache until it is
+// within its limit. The entry with the given key (normally the newest one) is always kept. The
+// kernels of the per-thread kernel caches keep their programs alive, so these are cleared as well.
+static void EvictPrograms(ProgramCache &cache, const ProgramKey &keep) {
+  const auto max_programs = max_programs_.load();
+  if (max_programs == 0 || cache.size() <= max_programs) { return; }
+  auto entries = std::vector<std::pair<size_t, ProgramKey>>();
+  for (const auto &entry: cache) {
+    if (entry.first == keep) { continue; }
+    entries.push_back({entry.second.last_used->load(), entry.first});
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const std::pair<size_t, ProgramKey> &a, const std::pair<size_t, ProgramKey> &b) {
+              return a.first < b.first;
+            });
+  const auto num_evictions = cache.size() - max_programs;
+  for (auto i = size_t{0}; i < num_evictions && i < entries.size(); ++i) {
+    cache.erase(entries[i].second);
+  }
+  if (num_evictions > 0 && !entries.empty()) { kernel_cache_generation_++; }
+  evictions_ += std::min(num_evictions, entries.size());
+}
+
 // Stores the compiled binary or IR in the cache
 void StoreBinaryToCache(const std::string &binary, const std::string &device_name,
-                        const Precision &precision, const std::string &routine_name) {
+                        const Precision &precision, const std::string &name) {
   binary_cache_mutex_.lock();
-  binary_cache_.push_back(BinaryCache{binary, device_name, precision, routine_name});
+  binary_cache_.push_back(BinaryCache{binary, device_name, precision, name, ++cache_clock_});
+  binary_cache_bytes_ += binary.size();
+  EvictBinaries();
   binary_cache_mutex_.unlock();
 }
 
-// Stores the compiled program in the cache
+// Stores the compiled program in the cache. This copies the current version of the cache, adds the
+// new program to it, and then publishes the new version. Readers of the old version can continue.
 void StoreProgramToCache(const Program &program, const Context &context,
-                         const Precision &precision, const std::string &routine_name) {
+                         const Precision &precision, const std::string &name) {
   program_cache_mutex_.lock();
-  program_cache_.push_back(ProgramCache{program, context.pointer(), precision, routine_name});
+  auto new_cache = std::make_shared<ProgramCache>(*std::atomic_load(&program_cache_));
+  const auto key = ProgramKey{context(), precision, name};
+  const auto last_used = std::make_shared<std::atomic<size_t>>(++cache_clock_);
+  new_cache->emplace(key, CachedProgram{program, last_used});
+  EvictPrograms(*new_cache, key);
+  std::atomic_store(&program_cache_, std::shared_ptr<const ProgramCache>(std::move(new_cache)));
   program_cache_mutex_.unlock();
 }
 
 // Queries the cache and retrieves a matching binary. Assumes that the match is available, throws
 // otherwise.
-const std::string& GetBinaryFromCache(const std::string &device_name, const Precision &precision,
-                                      const std::string &routine_name) {
+std::string GetBinaryFromCache(const std::string &device_name, const Precision &precision,
+                               const std::string &name) {
   binary_cache_mutex_.lock();
   for (auto &cached_binary: binary_cache_) {
-    if (cached_binary.MatchInCache(device_name, precision, routine_name)) {
+    if (cached_binary.MatchInCache(device_name, precision, name)) {
+      cached_binary.last_used = cache_clock_.load();
+      const auto binary = cached_binary.binary;
       binary_cache_mutex_.unlock();
-      return cached_binary.binary;
+      return binary;
     }
   }
   binary_cache_mutex_.unlock();
@@ -54,25 +179,55 @@ const std::string& GetBinaryFromCache(const std::string &device_name, const Prec
 
 // Queries the cache and retrieves a matching program. Assumes that the match is available, throws
 // otherwise.
-const Program& GetProgramFromCache(const Context &context, const Precision &precision,
-                                   const std::string &routine_name) {
-  program_cache_mutex_.lock();
-  for (auto &cached_program: program_cache_) {
-    if (cached_program.MatchInCache(context.pointer(), precision, routine_name)) {
-      program_cache_mutex_.unlock();
-      return cached_program.program;
-    }
-  }
-  program_cache_mutex_.unlock();
+Program GetProgramFromCache(const Context &context, const Precision &precision,
+                            const std::string &name) {
+  const auto cache = std::atomic_load(&program_cache_);
+  const auto cached_program = cache->find(ProgramKey{context(), precision, name});
+  if (cached_program != cache->end()) { return cached_program->second.program; }
   throw std::runtime_error("Internal CLBlast error: Expected program in cache, but found none.");
 }
 
+// Queries the cache and retrieves a matching program if available. Returns whether it was found.
+bool FindProgramInCache(const Context &context, const Precision &precision,
+                        const std::string &name, std::shared_ptr<Program> &program) {
+  const auto cache = std::atomic_load(&program_cache_);
+  const auto cached_program = cache->find(ProgramKey{context(), precision, name});
+  if (cached_program == cache->end()) { return false; }
+  cached_program->second.last_used->store(cache_clock_.load(std::memory_order_relaxed),
+                                          std::memory_order_relaxed);
+  program_hits_.fetch_add(1, std::memory_order_relaxed);
+  program = std::make_shared<Program>(cached_program->second.program);
+  return true;
+}
+
+// Retrieves a kernel from the cache of the calling thread, creating it if it is not yet there
+Kernel GetKernelFromCache(const Program &program, const std::string &kernel_name) {
+  auto &cache = GetKernelCache();
+  auto key = KernelKey{program(), kernel_name};
+  const auto cached_kernel = cache.kernels.find(key);
+  if (cached_kernel != cache.kernels.end()) { return cached_kernel->second; }
+  auto kernel = Kernel(program, kernel_name);
+  cache.kernels.emplace(std::move(key), kernel);
+  return kernel;
+}
+
+// Retrieves the local memory usage of a kernel from the cache of the calling thread, querying the
+// OpenCL run-time only if it is not yet there
+size_t GetLocalMemUsageFromCache(const Kernel &kernel, const Device &device) {
+  auto &cache = GetKernelCache();
+  const auto cached_usage = cache.local_mem_usages.find(kernel());
+  if (cached_usage != cache.local_mem_usages.end()) { return cached_usage->second; }
+  const auto local_mem_usage = kernel.LocalMemUsage(device);
+  cache.local_mem_usages.emplace(kernel(), local_mem_usage);
+  return local_mem_usage;
+}
+
 // Queries the cache to see whether or not the compiled kernel is already there
 bool BinaryIsInCache(const std::string &device_name, const Precision &precision,
-                     const std::string &routine_name) {
+                     const std::string &name) {
   binary_cache_mutex_.lock();
   for (auto &cached_binary: binary_cache_) {
-    if (cached_binary.MatchInCache(device_name, precision, routine_name)) {
+    if (cached_binary.MatchInCache(device_name, precision, name)) {
       binary_cache_mutex_.unlock();
       return true;
     }
@@ -83,31 +238,377 @@ bool BinaryIsInCache(const std::string &device_name, const Precision &precision,
 
 // Queries the cache to see whether or not the compiled kernel is already there
 bool ProgramIsInCache(const Context &context, const Precision &precision,
-                      const std::string &routine_name) {
-  program_cache_mutex_.lock();
-  for (auto &cached_program: program_cache_) {
-    if (cached_program.MatchInCache(context.pointer(), precision, routine_name)) {
-      program_cache_mutex_.unlock();
-      return true;
-    }
-  }
-  program_cache_mutex_.unlock();
-  return false;
+                      const std::string &name) {
+  const auto cache = std::atomic_load(&program_cache_);
+  return (cache->find(ProgramKey{context(), precision, name}) != cache->end());
 }
 
 // =================================================================================================
 
-// Clears the cache of stored binaries and programs
+// Clears the cache of stored binaries, programs, and kernels
 StatusCode ClearCache() {
   binary_cache_mutex_.lock();
   binary_cache_.clear();
+  binary_cache_bytes_ = 0;
   binary_cache_mutex_.unlock();
   program_cache_mutex_.lock();
-  program_cache_.clear();
+  std::atomic_store(&program_cache_, std::make_shared<const ProgramCache>());
   program_cache_mutex_.unlock();
+  kernel_cache_generation_++;
+  clear_generation_++;
   return StatusCode::kSuccess;
 }
 
+// Removes all programs of a specific context by publishing a version of the cache without them
+void ClearCacheForContext(const cl_context context) {
+  program_cache_mutex_.lock();
+  auto new_cache = std::make_shared<ProgramCache>();
+  for (const auto &entry: *std::atomic_load(&program_cache_)) {
+    if (entry.first.context != context) { new_cache->insert(entry); }
+  }
+  std::atomic_store(&program_cache_, std::shared_ptr<const ProgramCache>(std::move(new_cache)));
+  program_cache_mutex_.unlock();
+  kernel_cache_generation_++;
+  clear_generation_++;
+}
+
+// Removes all programs by publishing an empty version of the cache
+void ClearProgramCache() {
+  program_cache_mutex_.lock();
+  std::atomic_store(&program_cache_, std::make_shared<const ProgramCache>());
+  program_cache_mutex_.unlock();
+  kernel_cache_generation_++;
+  clear_generation_++;
+}
+
+// Retrieves the number of times the programs were cleared
+size_t GetClearGeneration() {
+  return clear_generation_.load();
+}
+
+// Sets the limits of the cache and immediately evicts entries if needed
+void SetCacheLimits(const size_t max_binary_bytes, const size_t max_programs) {
+  max_binary_bytes_ = max_binary_bytes;
+  max_programs_ = max_programs;
+  binary_cache_mutex_.lock();
+  EvictBinaries();
+  binary_cache_mutex_.unlock();
+  program_cache_mutex_.lock();
+  auto new_cache = std::make_shared<ProgramCache>(*std::atomic_load(&program_cache_));
+  EvictPrograms(*new_cache, ProgramKey{nullptr, Precision::kSingle, std::string{}});
+  std::atomic_store(&program_cache_, std::shared_ptr<const ProgramCache>(std::move(new_cache)));
+  program_cache_mutex_.unlock();
+}
+
+// Retrieves the current statistics
+Statistics GetStatistics() {
+  auto statistics = Statistics();
+  statistics.program_hits = program_hits_.load();
+  statistics.program_misses = program_misses_.load();
+  statistics.compilations = compilations_.load();
+  statistics.compilation_time_ms = static_cast<double>(compilation_time_us_.load()) / 1000.0;
+  binary_cache_mutex_.lock();
+  statistics.num_binaries = binary_cache_.size();
+  statistics.binary_bytes = binary_cache_bytes_;
+  binary_cache_mutex_.unlock();
+  statistics.num_programs = std::atomic_load(&program_cache_)->size();
+  statistics.evictions = evictions_.load();
+  return statistics;
+}
+
+// Records statistics
+void RecordProgramMiss() {
+  program_misses_++;
+}
+void RecordCompilation(const double time_ms) {
+  compilations_++;
+  compilation_time_us_ += static_cast<size_t>(time_ms * 1000.0);
+}
+
+// =================================================================================================
+
+// The on-disk cache directory. It is initialised from the environment on first use, unless it was
+// explicitly set through the API before that.
+static std::string disk_cache_directory_;
+static bool disk_cache_initialized_ = false;
+static std::mutex disk_cache_mutex_;
+
+// Magic string at the start of each on-disk cache file, includes a version of the file format
+static const std::string kDiskCacheMagic = "CLBlast binary cache v1\n";
+
+// Retrieves the full path of the on-disk cache file for a given key, or an empty string if the
+// on-disk cache is disabled
+static std::string DiskCacheFileName(const std::string &key) {
+  auto directory = GetCacheDirectory();
+  if (directory.empty()) { return std::string{}; }
+  if (directory.back() != '/' && directory.back() != '\\') { directory += "/"; }
+  return directory + "clblast_" + HashString(key) + ".bin";
+}
+
+// Sets the directory of the on-disk cache, overriding the environmental variable
+void SetCacheDirectory(const std::string &directory) {
+  disk_cache_mutex_.lock();
+  disk_cache_directory_ = directory;
+  disk_cache_initialized_ = true;
+  disk_cache_mutex_.unlock();
+}
+
+// Retrieves the directory of the on-disk cache
+std::string GetCacheDirectory() {
+  disk_cache_mutex_.lock();
+  if (!disk_cache_initialized_) {
+    const auto environment = std::getenv("CLBLAST_CACHE_DIR");
+    if (environment != nullptr) { disk_cache_directory_ = std::string{environment}; }
+    disk_cache_initialized_ = true;
+  }
+  const auto directory = disk_cache_directory_;
+  disk_cache_mutex_.unlock();
+  return directory;
+}
+
+// Creates the key of an on-disk cache entry. The key is stored in full in the cache file, such that
+// hash collisions of the file name are detected when loading.
+std::string DiskCacheKey(const Device &device, const Precision &precision,
+                         const std::string &source) {
+  auto key = std::string{};
+  key += "device: " + device.Name() + "\n";
+  key += "device version: " + device.Version() + "\n";
+  key += "driver version: " + device.DriverVersion() + "\n";
+  key += "platform version: " + device.GetPlatform().Version() + "\n";
+  key += "precision: " + ToString(static_cast<int>(precision)) + "\n";
+  key += "source: " + SourceHash(source) + "\n";
+  return key;
+}
+
+// Loads a binary from the on-disk cache. The file consists of the magic string, the full key, a
+// line with the binary's size and hash, and finally the binary itself.
+bool LoadBinaryFromDisk(const std::string &key, std::string &binary) {
+  const auto file_name = DiskCacheFileName(key);
+  if (file_name.empty()) { return false; }
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.is_open()) { return false; }
+  std::stringstream contents;
+  contents << file.rdbuf();
+  const auto data = contents.str();
+
+  // Verifies that this entry was created for exactly this key (stale entries are rejected)
+  const auto header = kDiskCacheMagic + key;
+  if (data.compare(0, header.size(), header) != 0) { return false; }
+
+  // Retrieves the size and the checksum of the binary
+  const auto info_end = data.find('\n', header.size());
+  if (info_end == std::string::npos) { return false; }
+  std::istringstream info(data.substr(header.size(), info_end - header.size()));
+  auto size = size_t{0};
+  auto checksum = std::string{};
+  if (!(info >> size >> checksum)) { return false; }
+
+  // Verifies the binary's integrity (corrupt or truncated entries are rejected)
+  if (data.size() - (info_end + 1) != size) { return false; }
+  auto result = data.substr(info_end + 1);
+  if (result.empty() || HashString(result) != checksum) { return false; }
+  binary = std::move(result);
+  return true;
+}
+
+// Stores a binary in the on-disk cache. To prevent other processes from reading partially written
+// entries, the data is first written to a temporary file which is then renamed.
+void StoreBinaryToDisk(const std::string &key, const std::string &binary) {
+  const auto file_name = DiskCacheFileName(key);
+  if (file_name.empty() || binary.empty()) { return; }
+  const auto unique_id = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+                         static_cast<size_t>(std::chrono::high_resolution_clock::now()
+                                             .time_since_epoch().count());
+  const auto temp_file_name = file_name + "." + ToString(unique_id) + ".tmp";
+  {
+    std::ofstream file(temp_file_name, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) { return; }
+    file << kDiskCacheMagic << key << binary.size() << " " << HashString(binary) << "\n";
+    file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    if (!file.good()) { file.close(); std::remove(temp_file_name.c_str()); return; }
+  }
+  if (std::rename(temp_file_name.c_str(), file_name.c_str()) != 0) {
+    std::remove(file_name.c_str()); // Some platforms do not allow renaming onto an existing file
+    if (std::rename(temp_file_name.c_str(), file_name.c_str()) != 0) {
+      std::remove(temp_file_name.c_str());
+    }
+  }
+}
+
+// =================================================================================================
+
+// Magic string at the start of each exported blob, includes a version of the blob format
+static const std::string kBlobMagic = "CLBlast cache blob v1\n";
+
+// Serializes the binaries of a device. The blob consists of the magic string and the number of
+// entries, followed by the entries themselves. Each entry consists of a line with the device name,
+// the driver version, the precision, the name, and the binary's size and hash, followed by the
+// binary itself.
+std::string ExportBinaries(const std::string &device_name, const std::string &driver_version) {
+  auto entries = std::string{};
+  auto num_entries = size_t{0};
+  binary_cache_mutex_.lock();
+  for (const auto &cached_binary: binary_cache_) {
+    if (cached_binary.device_name != device_name) { continue; }
+    entries += cached_binary.device_name + "\n" + driver_version + "\n";
+    entries += ToString(static_cast<int>(cached_binary.precision)) + "\n";
+    entries += cached_binary.name + "\n";
+    entries += ToString(cached_binary.binary.size()) + " " + HashString(cached_binary.binary) + "\n";
+    entries += cached_binary.binary;
+    num_entries++;
+  }
+  binary_cache_mutex_.unlock();
+  return kBlobMagic + ToString(num_entries) + "\n" + entries;
+}
+
+// Reads a line from a blob, advancing the position past the newline. Returns false at the end.
+static bool ReadBlobLine(const std::string &blob, size_t &position, std::string &line) {
+  const auto end = blob.find('\n', position);
+  if (end == std::string::npos) { return false; }
+  line = blob.substr(position, end - position);
+  position = end + 1;
+  return true;
+}
+
+// De-serializes a blob. All entries are validated first, such that a corrupt blob is rejected as a
+// whole. Only then are the matching entries added to the cache.
+bool ImportBinaries(const std::string &blob, const std::string &device_name,
+                    const std::string &driver_version) {
+  if (blob.compare(0, kBlobMagic.size(), kBlobMagic) != 0) { return false; }
+  auto position = kBlobMagic.size();
+  auto line = std::string{};
+  if (!ReadBlobLine(blob, position, line)) { return false; }
+  auto num_entries = size_t{0};
+  if (!(std::istringstream(line) >> num_entries)) { return false; }
+
+  // Parses and validates all entries
+  auto imports = std::vector<BinaryCache>();
+  for (auto i = size_t{0}; i < num_entries; ++i) {
+    auto entry_device = std::string{};
+    auto entry_driver = std::string{};
+    auto precision_line = std::string{};
+    auto name = std::string{};
+    if (!ReadBlobLine(blob, position, entry_device) ||
+        !ReadBlobLine(blob, position, entry_driver) ||
+        !ReadBlobLine(blob, position, precision_line) ||
+        !ReadBlobLine(blob, position, name) ||
+        !ReadBlobLine(blob, position, line)) { return false; }
+    auto precision = 0;
+    auto size = size_t{0};
+    auto checksum = std::string{};
+    if (!(std::istringstream(precision_line) >> precision)) { return false; }
+    std::istringstream info(line);
+    if (!(info >> size >> checksum)) { return false; }
+    if (blob.size() - position < size) { return false; }
+    auto binary = blob.substr(position, size);
+    position += size;
+    if (HashString(binary) != checksum) { return false; }
+    if (entry_device != device_name || entry_driver != driver_version) { continue; }
+    imports.push_back(BinaryCache{std::move(binary), entry_device,
+                                  static_cast<Precision>(precision), name, 0});
+  }
+  if (position != blob.size()) { return false; }
+
+  // Adds the entries which are not yet in the cache
+  for (auto &import: imports) {
+    if (BinaryIsInCache(import.device_name, import.precision, import.name)) { continue; }
+    StoreBinaryToCache(import.binary, import.device_name, import.precision, import.name);
+  }
+  return true;
+}
+
+// =================================================================================================
+
+// A binary which is about to be compiled in the background. It is counted, since multiple warm-up
+// calls could request the same binary. The owners are the threads compiling it, if any: these are
+// kept per thread, such that one warm-up call finishing doesn't release the claim of another.
+struct PendingBinary {
+  size_t count;
+  std::multiset<std::thread::id> owners;
+};
+
+// The pending binaries, keyed on the combination of device name, precision, and routine name. The
+// number of entries is also kept separately, such that the common case (nothing pending) is fast.
+static std::unordered_map<std::string, PendingBinary> pending_binaries_;
+static std::atomic<size_t> num_pending_binaries_{0};
+static std::mutex pending_binaries_mutex_;
+static std::condition_variable pending_binaries_condition_;
+
+// The background tasks. These are declared last, such that they are destroyed first: destroying a
+// task waits for it to complete, after which the other caches are no longer being accessed.
+static std::vector<std::future<void>> background_tasks_;
+static std::mutex background_tasks_mutex_;
+
+// Creates the key of a pending binary
+static std::string PendingBinaryKey(const std::string &device_name, const Precision &precision,
+                                    const std::string &routine_name) {
+  return device_name + "|" + ToString(static_cast<int>(precision)) + "|" + routine_name;
+}
+
+// Marks a binary as pending
+void MarkBinaryAsPending(const std::string &device_name, const Precision &precision,
+                         const std::string &routine_name) {
+  std::lock_guard<std::mutex> lock(pending_binaries_mutex_);
+  auto &pending = pending_binaries_[PendingBinaryKey(device_name, precision, routine_name)];
+  if (pending.count == 0) { num_pending_binaries_++; }
+  pending.count++;
+}
+
+// Claims a pending binary for compilation by the calling thread
+void ClaimPendingBinary(const std::string &device_name, const Precision &precision,
+                        const std::string &routine_name) {
+  std::lock_guard<std::mutex> lock(pending_binaries_mutex_);
+  const auto pending = pending_binaries_.find(PendingBinaryKey(device_name, precision, routine_name));
+  if (pending != pending_binaries_.end()) {
+    pending->second.owners.insert(std::this_thread::get_id());
+  }
+}
+
+// Removes the pending mark of a binary and wakes up all waiting threads
+void UnmarkPendingBinary(const std::string &device_name, const Precision &precision,
+                         const std::string &routine_name) {
+  {
+    std::lock_guard<std::mutex> lock(pending_binaries_mutex_);
+    const auto pending = pending_binaries_.find(PendingBinaryKey(device_name, precision,
+                                                                 routine_name));
+    if (pending == pending_binaries_.end()) { return; }
+    pending->second.count--;
+    const auto owner = pending->second.owners.find(std::this_thread::get_id());
+    if (owner != pending->second.owners.end()) { pending->second.owners.erase(owner); }
+    if (pending->second.count == 0) {
+      pending_binaries_.erase(pending);
+      num_pending_binaries_--;
+    }
+  }
+  pending_binaries_condition_.notify_all();
+}
+
+// Blocks as long as the binary is pending and not claimed by the calling thread
+void WaitForPendingBinary(const std::string &device_name, const Precision &precision,
+                          const std::string &routine_name) {
+  if (num_pending_binaries_.load() == 0) { return; }
+  const auto key = PendingBinaryKey(device_name, precision, routine_name);
+  std::unique_lock<std::mutex> lock(pending_binaries_mutex_);
+  pending_binaries_condition_.wait(lock, [&key]() {
+    const auto pending = pending_binaries_.find(key);
+    return (pending == pending_binaries_.end() ||
+            pending->second.owners.count(std::this_thread::get_id()) != 0);
+  });
+}
+
+// Takes ownership of a background task. Completed tasks are removed at the same time.
+void AddBackgroundTask(std::future<void> &&task) {
+  std::lock_guard<std::mutex> lock(background_tasks_mutex_);
+  auto running_tasks = std::vector<std::future<void>>();
+  for (auto &background_task: background_tasks_) {
+    if (background_task.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      running_tasks.push_back(std::move(background_task));
+    }
+  }
+  running_tasks.push_back(std::move(task));
+  background_tasks_ = std::move(running_tasks);
+}
+
 // =================================================================================================
 } // namespace cache
 } // namespace clblast
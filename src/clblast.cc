@@ -14,10 +14,21 @@
 // =================================================================================================
 
 #include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <future>
+#include <cctype>
 
 #include "clblast.h"
 #include "internal/public_api.h"
 #include "internal/cache.h"
+#include "internal/buffer_pool.h"
+#include "internal/database.h"
+#include "internal/handle.h"
 
 // BLAS level-1 includes
 #include "internal/routines/level1/xswap.h"
@@ -68,6 +79,13 @@
 #include "internal/routines/level3/xher2k.h"
 #include "internal/routines/level3/xtrmm.h"
 
+// Extra non-BLAS includes
+#include "internal/routines/levelx/xgemmstridedbatched.h"
+#include "internal/routines/levelx/xgemmgroupedbatched.h"
+#include "internal/routines/levelx/xgemmmixed.h"
+#include "internal/routines/levelx/xconvert.h"
+#include "internal/routines/levelx/xgemmepilogue.h"
+
 namespace clblast {
 
 // =================================================================================================
@@ -160,7 +178,7 @@ template StatusCode PUBLIC_API Rotm<double>(const size_t,
                                             cl_mem, const size_t,
                                             cl_command_queue*, cl_event*);
 
-// Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP
+// Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
 template <typename T>
 StatusCode Swap(const size_t n,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -190,8 +208,12 @@ template StatusCode PUBLIC_API Swap<double2>(const size_t,
                                              cl_mem, const size_t, const size_t,
                                              cl_mem, const size_t, const size_t,
                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Swap<half>(const size_t,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
 
-// Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL
+// Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
 template <typename T>
 StatusCode Scal(const size_t n,
                 const T alpha,
@@ -221,8 +243,12 @@ template StatusCode PUBLIC_API Scal<double2>(const size_t,
                                              const double2,
                                              cl_mem, const size_t, const size_t,
                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Scal<half>(const size_t,
+                                          const half,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
 
-// Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY
+// Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
 template <typename T>
 StatusCode Copy(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -252,8 +278,12 @@ template StatusCode PUBLIC_API Copy<double2>(const size_t,
                                              const cl_mem, const size_t, const size_t,
                                              cl_mem, const size_t, const size_t,
                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Copy<half>(const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
 
-// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY
+// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
 template <typename T>
 StatusCode Axpy(const size_t n,
                 const T alpha,
@@ -289,8 +319,13 @@ template StatusCode PUBLIC_API Axpy<double2>(const size_t,
                                              const cl_mem, const size_t, const size_t,
                                              cl_mem, const size_t, const size_t,
                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpy<half>(const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
 
-// Dot product of two vectors: SDOT/DDOT
+// Dot product of two vectors: SDOT/DDOT/HDOT
 template <typename T>
 StatusCode Dot(const size_t n,
                cl_mem dot_buffer, const size_t dot_offset,
@@ -316,6 +351,11 @@ template StatusCode PUBLIC_API Dot<double>(const size_t,
                                            const cl_mem, const size_t, const size_t,
                                            const cl_mem, const size_t, const size_t,
                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dot<half>(const size_t,
+                                         cl_mem, const size_t,
+                                         const cl_mem, const size_t, const size_t,
+                                         const cl_mem, const size_t, const size_t,
+                                         cl_command_queue*, cl_event*);
 
 // Dot product of two complex vectors: CDOTU/ZDOTU
 template <typename T>
@@ -561,7 +601,7 @@ template StatusCode PUBLIC_API Min<double2>(const size_t,
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
 
-// General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV
+// General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
 template <typename T>
 StatusCode Gemv(const Layout layout, const Transpose a_transpose,
                 const size_t m, const size_t n,
@@ -615,6 +655,14 @@ template StatusCode PUBLIC_API Gemv<double2>(const Layout, const Transpose,
                                              const double2,
                                              cl_mem, const size_t, const size_t,
                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemv<half>(const Layout, const Transpose,
+                                          const size_t, const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          const half,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
 
 // General banded matrix-vector multiplication: SGBMV/DGBMV/CGBMV/ZGBMV
 template <typename T>
@@ -1106,7 +1154,7 @@ template StatusCode PUBLIC_API Tpsv<double2>(const Layout, const Triangle, const
                                              cl_mem, const size_t, const size_t,
                                              cl_command_queue*, cl_event*);
 
-// General rank-1 matrix update: SGER/DGER
+// General rank-1 matrix update: SGER/DGER/HGER
 template <typename T>
 StatusCode Ger(const Layout layout,
                const size_t m, const size_t n,
@@ -1140,6 +1188,13 @@ template StatusCode PUBLIC_API Ger<double>(const Layout,
                                            const cl_mem, const size_t, const size_t,
                                            cl_mem, const size_t, const size_t,
                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Ger<half>(const Layout,
+                                         const size_t, const size_t,
+                                         const half,
+                                         const cl_mem, const size_t, const size_t,
+                                         const cl_mem, const size_t, const size_t,
+                                         cl_mem, const size_t, const size_t,
+                                         cl_command_queue*, cl_event*);
 
 // General rank-1 complex matrix update: CGERU/ZGERU
 template <typename T>
@@ -1479,7 +1534,7 @@ template StatusCode PUBLIC_API Spr2<double>(const Layout, const Triangle,
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
 template <typename T>
 StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                 const size_t m, const size_t n, const size_t k,
@@ -1533,6 +1588,14 @@ template StatusCode PUBLIC_API Gemm<double2>(const Layout, const Transpose, cons
                                              const double2,
                                              cl_mem, const size_t, const size_t,
                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemm<half>(const Layout, const Transpose, const Transpose,
+                                          const size_t, const size_t, const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          const half,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
 
 // Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
 template <typename T>
@@ -1885,70 +1948,1632 @@ template StatusCode PUBLIC_API Trsm<double2>(const Layout, const Side, const Tri
                                              cl_command_queue*, cl_event*);
 
 // =================================================================================================
+// Extra non-BLAS routines (level-X)
+// =================================================================================================
 
-// Clears the cache of stored binaries
-StatusCode ClearCache() { return cache::ClearCache(); }
+// Strided-batched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED
+template <typename T>
+StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                              const T beta,
+                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = XgemmStridedBatched<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine.DoGemmStridedBatched(layout, a_transpose, b_transpose,
+                                      m, n, k,
+                                      alpha,
+                                      Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                      Buffer<T>(b_buffer), b_offset, b_ld, b_stride,
+                                      beta,
+                                      Buffer<T>(c_buffer), c_offset, c_ld, c_stride,
+                                      batch_count);
+}
+template StatusCode PUBLIC_API GemmStridedBatched<float>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatched<double>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatched<float2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmStridedBatched<double2>(const Layout, const Transpose, const Transpose,
+                                                           const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
 
-// Fills the cache with all binaries for a specific device
-StatusCode FillCache(const cl_device_id device) {
-  try {
+// =================================================================================================
+// Handle-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================
 
-    // Creates a sample context and queue to match the normal routine calling conventions
-    auto device_cpp = Device(device);
-    auto context = Context(device_cpp);
-    auto queue = Queue(context, device_cpp);
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+template <typename T>
+StatusCode Gemm(Handle handle,
+                const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event) {
+  auto routine = static_cast<Xgemm<T>*>(nullptr);
+  auto status = GetRoutine(handle, event, routine);
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine->DoGemm(layout, a_transpose, b_transpose,
+                         m, n, k,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         Buffer<T>(b_buffer), b_offset, b_ld,
+                         beta,
+                         Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Gemm<float>(Handle,
+                                           const Layout, const Transpose, const Transpose,
+                                           const size_t, const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_event*);
+template StatusCode PUBLIC_API Gemm<double>(Handle,
+                                            const Layout, const Transpose, const Transpose,
+                                            const size_t, const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Gemm<float2>(Handle,
+                                            const Layout, const Transpose, const Transpose,
+                                            const size_t, const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Gemm<double2>(Handle,
+                                             const Layout, const Transpose, const Transpose,
+                                             const size_t, const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_event*);
+template StatusCode PUBLIC_API Gemm<half>(Handle,
+                                          const Layout, const Transpose, const Transpose,
+                                          const size_t, const size_t, const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          const half,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_event*);
 
-    // Runs all the level 1 set-up functions
-    Xswap<float>(queue, nullptr).SetUp(); Xswap<double>(queue, nullptr).SetUp(); Xswap<float2>(queue, nullptr).SetUp(); Xswap<double2>(queue, nullptr).SetUp();
-    Xswap<float>(queue, nullptr).SetUp(); Xswap<double>(queue, nullptr).SetUp(); Xswap<float2>(queue, nullptr).SetUp(); Xswap<double2>(queue, nullptr).SetUp();
-    Xscal<float>(queue, nullptr).SetUp(); Xscal<double>(queue, nullptr).SetUp(); Xscal<float2>(queue, nullptr).SetUp(); Xscal<double2>(queue, nullptr).SetUp();
-    Xcopy<float>(queue, nullptr).SetUp(); Xcopy<double>(queue, nullptr).SetUp(); Xcopy<float2>(queue, nullptr).SetUp(); Xcopy<double2>(queue, nullptr).SetUp();
-    Xaxpy<float>(queue, nullptr).SetUp(); Xaxpy<double>(queue, nullptr).SetUp(); Xaxpy<float2>(queue, nullptr).SetUp(); Xaxpy<double2>(queue, nullptr).SetUp();
-    Xdot<float>(queue, nullptr).SetUp(); Xdot<double>(queue, nullptr).SetUp();
-    Xdotu<float2>(queue, nullptr).SetUp(); Xdotu<double2>(queue, nullptr).SetUp();
-    Xdotc<float2>(queue, nullptr).SetUp(); Xdotc<double2>(queue, nullptr).SetUp();
-    Xnrm2<float>(queue, nullptr).SetUp(); Xnrm2<double>(queue, nullptr).SetUp(); Xnrm2<float2>(queue, nullptr).SetUp(); Xnrm2<double2>(queue, nullptr).SetUp();
-    Xasum<float>(queue, nullptr).SetUp(); Xasum<double>(queue, nullptr).SetUp(); Xasum<float2>(queue, nullptr).SetUp(); Xasum<double2>(queue, nullptr).SetUp();
-    Xsum<float>(queue, nullptr).SetUp(); Xsum<double>(queue, nullptr).SetUp(); Xsum<float2>(queue, nullptr).SetUp(); Xsum<double2>(queue, nullptr).SetUp();
-    Xamax<float>(queue, nullptr).SetUp(); Xamax<double>(queue, nullptr).SetUp(); Xamax<float2>(queue, nullptr).SetUp(); Xamax<double2>(queue, nullptr).SetUp();
-    Xmax<float>(queue, nullptr).SetUp(); Xmax<double>(queue, nullptr).SetUp(); Xmax<float2>(queue, nullptr).SetUp(); Xmax<double2>(queue, nullptr).SetUp();
-    Xmin<float>(queue, nullptr).SetUp(); Xmin<double>(queue, nullptr).SetUp(); Xmin<float2>(queue, nullptr).SetUp(); Xmin<double2>(queue, nullptr).SetUp();
-
-    // Runs all the level 2 set-up functions
-    Xgemv<float>(queue, nullptr).SetUp(); Xgemv<double>(queue, nullptr).SetUp(); Xgemv<float2>(queue, nullptr).SetUp(); Xgemv<double2>(queue, nullptr).SetUp();
-    Xgbmv<float>(queue, nullptr).SetUp(); Xgbmv<double>(queue, nullptr).SetUp(); Xgbmv<float2>(queue, nullptr).SetUp(); Xgbmv<double2>(queue, nullptr).SetUp();
-    Xhemv<float2>(queue, nullptr).SetUp(); Xhemv<double2>(queue, nullptr).SetUp();
-    Xhbmv<float2>(queue, nullptr).SetUp(); Xhbmv<double2>(queue, nullptr).SetUp();
-    Xhpmv<float2>(queue, nullptr).SetUp(); Xhpmv<double2>(queue, nullptr).SetUp();
-    Xsymv<float>(queue, nullptr).SetUp(); Xsymv<double>(queue, nullptr).SetUp();
-    Xsbmv<float>(queue, nullptr).SetUp(); Xsbmv<double>(queue, nullptr).SetUp();
-    Xspmv<float>(queue, nullptr).SetUp(); Xspmv<double>(queue, nullptr).SetUp();
-    Xtrmv<float>(queue, nullptr).SetUp(); Xtrmv<double>(queue, nullptr).SetUp(); Xtrmv<float2>(queue, nullptr).SetUp(); Xtrmv<double2>(queue, nullptr).SetUp();
-    Xtbmv<float>(queue, nullptr).SetUp(); Xtbmv<double>(queue, nullptr).SetUp(); Xtbmv<float2>(queue, nullptr).SetUp(); Xtbmv<double2>(queue, nullptr).SetUp();
-    Xtpmv<float>(queue, nullptr).SetUp(); Xtpmv<double>(queue, nullptr).SetUp(); Xtpmv<float2>(queue, nullptr).SetUp(); Xtpmv<double2>(queue, nullptr).SetUp();
-    Xger<float>(queue, nullptr).SetUp(); Xger<double>(queue, nullptr).SetUp();
-    Xgeru<float2>(queue, nullptr).SetUp(); Xgeru<double2>(queue, nullptr).SetUp();
-    Xgerc<float2>(queue, nullptr).SetUp(); Xgerc<double2>(queue, nullptr).SetUp();
-    Xher<float2,float>(queue, nullptr).SetUp(); Xher<double2,double>(queue, nullptr).SetUp();
-    Xhpr<float2,float>(queue, nullptr).SetUp(); Xhpr<double2,double>(queue, nullptr).SetUp();
-    Xher2<float2>(queue, nullptr).SetUp(); Xher2<double2>(queue, nullptr).SetUp();
-    Xhpr2<float2>(queue, nullptr).SetUp(); Xhpr2<double2>(queue, nullptr).SetUp();
-    Xsyr<float>(queue, nullptr).SetUp(); Xsyr<double>(queue, nullptr).SetUp();
-    Xspr<float>(queue, nullptr).SetUp(); Xspr<double>(queue, nullptr).SetUp();
-    Xsyr2<float>(queue, nullptr).SetUp(); Xsyr2<double>(queue, nullptr).SetUp();
-    Xspr2<float>(queue, nullptr).SetUp(); Xspr2<double>(queue, nullptr).SetUp();
-
-    // Runs all the level 1 set-up functions
-    Xgemm<float>(queue, nullptr).SetUp(); Xgemm<double>(queue, nullptr).SetUp(); Xgemm<float2>(queue, nullptr).SetUp(); Xgemm<double2>(queue, nullptr).SetUp();
-    Xsymm<float>(queue, nullptr).SetUp(); Xsymm<double>(queue, nullptr).SetUp(); Xsymm<float2>(queue, nullptr).SetUp(); Xsymm<double2>(queue, nullptr).SetUp();
-    Xhemm<float2>(queue, nullptr).SetUp(); Xhemm<double2>(queue, nullptr).SetUp();
-    Xsyrk<float>(queue, nullptr).SetUp(); Xsyrk<double>(queue, nullptr).SetUp(); Xsyrk<float2>(queue, nullptr).SetUp(); Xsyrk<double2>(queue, nullptr).SetUp();
-    Xherk<float2,float>(queue, nullptr).SetUp(); Xherk<double2,double>(queue, nullptr).SetUp();
-    Xsyr2k<float>(queue, nullptr).SetUp(); Xsyr2k<double>(queue, nullptr).SetUp(); Xsyr2k<float2>(queue, nullptr).SetUp(); Xsyr2k<double2>(queue, nullptr).SetUp();
-    Xher2k<float2,float>(queue, nullptr).SetUp(); Xher2k<double2,double>(queue, nullptr).SetUp();
-    Xtrmm<float>(queue, nullptr).SetUp(); Xtrmm<double>(queue, nullptr).SetUp(); Xtrmm<float2>(queue, nullptr).SetUp(); Xtrmm<double2>(queue, nullptr).SetUp();
+// Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
+template <typename T>
+StatusCode Symm(Handle handle,
+                const Layout layout, const Side side, const Triangle triangle,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event) {
+  auto routine = static_cast<Xsymm<T>*>(nullptr);
+  auto status = GetRoutine(handle, event, routine);
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine->DoSymm(layout, side, triangle,
+                         m, n,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         Buffer<T>(b_buffer), b_offset, b_ld,
+                         beta,
+                         Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Symm<float>(Handle,
+                                           const Layout, const Side, const Triangle,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_event*);
+template StatusCode PUBLIC_API Symm<double>(Handle,
+                                            const Layout, const Side, const Triangle,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Symm<float2>(Handle,
+                                            const Layout, const Side, const Triangle,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Symm<double2>(Handle,
+                                             const Layout, const Side, const Triangle,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_event*);
 
-  } catch (...) { return StatusCode::kBuildProgramFailure; }
+// Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
+template <typename T>
+StatusCode Hemm(Handle handle,
+                const Layout layout, const Side side, const Triangle triangle,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event) {
+  auto routine = static_cast<Xhemm<T>*>(nullptr);
+  auto status = GetRoutine(handle, event, routine);
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine->DoHemm(layout, side, triangle,
+                         m, n,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         Buffer<T>(b_buffer), b_offset, b_ld,
+                         beta,
+                         Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Hemm<float2>(Handle,
+                                            const Layout, const Side, const Triangle,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Hemm<double2>(Handle,
+                                             const Layout, const Side, const Triangle,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_event*);
+
+// Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK
+template <typename T>
+StatusCode Syrk(Handle handle,
+                const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event) {
+  auto routine = static_cast<Xsyrk<T>*>(nullptr);
+  auto status = GetRoutine(handle, event, routine);
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine->DoSyrk(layout, triangle, a_transpose,
+                         n, k,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         beta,
+                         Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Syrk<float>(Handle,
+                                           const Layout, const Triangle, const Transpose,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_event*);
+template StatusCode PUBLIC_API Syrk<double>(Handle,
+                                            const Layout, const Triangle, const Transpose,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Syrk<float2>(Handle,
+                                            const Layout, const Triangle, const Transpose,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Syrk<double2>(Handle,
+                                             const Layout, const Triangle, const Transpose,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_event*);
+
+// Rank-K update of a hermitian matrix: CHERK/ZHERK
+template <typename T>
+StatusCode Herk(Handle handle,
+                const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_event* event) {
+  auto routine = static_cast<Xherk<std::complex<T>,T>*>(nullptr);
+  auto status = GetRoutine(handle, event, routine);
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine->DoHerk(layout, triangle, a_transpose,
+                         n, k,
+                         alpha,
+                         Buffer<std::complex<T>>(a_buffer), a_offset, a_ld,
+                         beta,
+                         Buffer<std::complex<T>>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Herk<float>(Handle,
+                                           const Layout, const Triangle, const Transpose,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_event*);
+template StatusCode PUBLIC_API Herk<double>(Handle,
+                                            const Layout, const Triangle, const Transpose,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+
+// Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K
+template <typename T>
+StatusCode Syr2k(Handle handle,
+                 const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                 const size_t n, const size_t k,
+                 const T alpha,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const T beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_event* event) {
+  auto routine = static_cast<Xsyr2k<T>*>(nullptr);
+  auto status = GetRoutine(handle, event, routine);
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine->DoSyr2k(layout, triangle, ab_transpose,
+                          n, k,
+                          alpha,
+                          Buffer<T>(a_buffer), a_offset, a_ld,
+                          Buffer<T>(b_buffer), b_offset, b_ld,
+                          beta,
+                          Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Syr2k<float>(Handle,
+                                            const Layout, const Triangle, const Transpose,
+                                            const size_t, const size_t,
+                                            const float,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Syr2k<double>(Handle,
+                                             const Layout, const Triangle, const Transpose,
+                                             const size_t, const size_t,
+                                             const double,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_event*);
+template StatusCode PUBLIC_API Syr2k<float2>(Handle,
+                                             const Layout, const Triangle, const Transpose,
+                                             const size_t, const size_t,
+                                             const float2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const float2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_event*);
+template StatusCode PUBLIC_API Syr2k<double2>(Handle,
+                                              const Layout, const Triangle, const Transpose,
+                                              const size_t, const size_t,
+                                              const double2,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const double2,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_event*);
+
+// Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
+template <typename T, typename U>
+StatusCode Her2k(Handle handle,
+                 const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                 const size_t n, const size_t k,
+                 const T alpha,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const U beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_event* event) {
+  auto routine = static_cast<Xher2k<T,U>*>(nullptr);
+  auto status = GetRoutine(handle, event, routine);
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine->DoHer2k(layout, triangle, ab_transpose,
+                          n, k,
+                          alpha,
+                          Buffer<T>(a_buffer), a_offset, a_ld,
+                          Buffer<T>(b_buffer), b_offset, b_ld,
+                          beta,
+                          Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Her2k<float2,float>(Handle,
+                                                   const Layout, const Triangle, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const float2,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const float,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_event*);
+template StatusCode PUBLIC_API Her2k<double2,double>(Handle,
+                                                     const Layout, const Triangle, const Transpose,
+                                                     const size_t, const size_t,
+                                                     const double2,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const double,
+                                                     cl_mem, const size_t, const size_t,
+                                                     cl_event*);
+
+// Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM
+template <typename T>
+StatusCode Trmm(Handle handle,
+                const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                cl_event* event) {
+  auto routine = static_cast<Xtrmm<T>*>(nullptr);
+  auto status = GetRoutine(handle, event, routine);
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine->DoTrmm(layout, side, triangle, a_transpose, diagonal,
+                         m, n,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         Buffer<T>(b_buffer), b_offset, b_ld);
+}
+template StatusCode PUBLIC_API Trmm<float>(Handle,
+                                           const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_event*);
+template StatusCode PUBLIC_API Trmm<double>(Handle,
+                                            const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Trmm<float2>(Handle,
+                                            const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_event*);
+template StatusCode PUBLIC_API Trmm<double2>(Handle,
+                                             const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_event*);
+
+// =================================================================================================
+// Workspace-size queries and workspace-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================
+
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+template <typename T>
+StatusCode GemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             cl_command_queue* queue, size_t* workspace_size) {
+  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xgemm<T>(queue_cpp, nullptr);
+  *workspace_size = routine.GemmWorkspaceSize(layout, a_transpose, b_transpose,
+                                              m, n, k);
+  return StatusCode::kSuccess;
+}
+template StatusCode PUBLIC_API GemmWorkspaceSize<float>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API GemmWorkspaceSize<double>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API GemmWorkspaceSize<float2>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API GemmWorkspaceSize<double2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API GemmWorkspaceSize<half>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       cl_command_queue*, size_t*);
+
+template <typename T>
+StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xgemm<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  if (workspace_size < routine.GemmWorkspaceSize(layout, a_transpose, b_transpose,
+                                                 m, n, k)) {
+    return StatusCode::kInsufficientMemoryTemp;
+  }
+  routine.SetWorkspace(workspace, workspace_size);
+  return routine.DoGemm(layout, a_transpose, b_transpose,
+                        m, n, k,
+                        alpha,
+                        Buffer<T>(a_buffer), a_offset, a_ld,
+                        Buffer<T>(b_buffer), b_offset, b_ld,
+                        beta,
+                        Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Gemm<float>(const Layout, const Transpose, const Transpose,
+                                           const size_t, const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemm<double>(const Layout, const Transpose, const Transpose,
+                                            const size_t, const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemm<float2>(const Layout, const Transpose, const Transpose,
+                                            const size_t, const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemm<double2>(const Layout, const Transpose, const Transpose,
+                                             const size_t, const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemm<half>(const Layout, const Transpose, const Transpose,
+                                          const size_t, const size_t, const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          const half,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_mem, const size_t,
+                                          cl_command_queue*, cl_event*);
+
+// Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM
+template <typename T>
+StatusCode SymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                             const size_t m, const size_t n,
+                             cl_command_queue* queue, size_t* workspace_size) {
+  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xsymm<T>(queue_cpp, nullptr);
+  *workspace_size = routine.SymmWorkspaceSize(layout, side, triangle,
+                                              m, n);
+  return StatusCode::kSuccess;
+}
+template StatusCode PUBLIC_API SymmWorkspaceSize<float>(const Layout, const Side, const Triangle,
+                                                        const size_t, const size_t,
+                                                        cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API SymmWorkspaceSize<double>(const Layout, const Side, const Triangle,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API SymmWorkspaceSize<float2>(const Layout, const Side, const Triangle,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API SymmWorkspaceSize<double2>(const Layout, const Side, const Triangle,
+                                                          const size_t, const size_t,
+                                                          cl_command_queue*, size_t*);
+
+template <typename T>
+StatusCode Symm(const Layout layout, const Side side, const Triangle triangle,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xsymm<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  if (workspace_size < routine.SymmWorkspaceSize(layout, side, triangle,
+                                                 m, n)) {
+    return StatusCode::kInsufficientMemoryTemp;
+  }
+  routine.SetWorkspace(workspace, workspace_size);
+  return routine.DoSymm(layout, side, triangle,
+                        m, n,
+                        alpha,
+                        Buffer<T>(a_buffer), a_offset, a_ld,
+                        Buffer<T>(b_buffer), b_offset, b_ld,
+                        beta,
+                        Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Symm<float>(const Layout, const Side, const Triangle,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Symm<double>(const Layout, const Side, const Triangle,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Symm<float2>(const Layout, const Side, const Triangle,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Symm<double2>(const Layout, const Side, const Triangle,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
+template <typename T>
+StatusCode HemmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                             const size_t m, const size_t n,
+                             cl_command_queue* queue, size_t* workspace_size) {
+  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xhemm<T>(queue_cpp, nullptr);
+  *workspace_size = routine.HemmWorkspaceSize(layout, side, triangle,
+                                              m, n);
+  return StatusCode::kSuccess;
+}
+template StatusCode PUBLIC_API HemmWorkspaceSize<float2>(const Layout, const Side, const Triangle,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API HemmWorkspaceSize<double2>(const Layout, const Side, const Triangle,
+                                                          const size_t, const size_t,
+                                                          cl_command_queue*, size_t*);
+
+template <typename T>
+StatusCode Hemm(const Layout layout, const Side side, const Triangle triangle,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xhemm<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  if (workspace_size < routine.HemmWorkspaceSize(layout, side, triangle,
+                                                 m, n)) {
+    return StatusCode::kInsufficientMemoryTemp;
+  }
+  routine.SetWorkspace(workspace, workspace_size);
+  return routine.DoHemm(layout, side, triangle,
+                        m, n,
+                        alpha,
+                        Buffer<T>(a_buffer), a_offset, a_ld,
+                        Buffer<T>(b_buffer), b_offset, b_ld,
+                        beta,
+                        Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Hemm<float2>(const Layout, const Side, const Triangle,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Hemm<double2>(const Layout, const Side, const Triangle,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK
+template <typename T>
+StatusCode SyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                             const size_t n, const size_t k,
+                             cl_command_queue* queue, size_t* workspace_size) {
+  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xsyrk<T>(queue_cpp, nullptr);
+  *workspace_size = routine.SyrkWorkspaceSize(layout, triangle, a_transpose,
+                                              n, k);
+  return StatusCode::kSuccess;
+}
+template StatusCode PUBLIC_API SyrkWorkspaceSize<float>(const Layout, const Triangle, const Transpose,
+                                                        const size_t, const size_t,
+                                                        cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API SyrkWorkspaceSize<double>(const Layout, const Triangle, const Transpose,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API SyrkWorkspaceSize<float2>(const Layout, const Triangle, const Transpose,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API SyrkWorkspaceSize<double2>(const Layout, const Triangle, const Transpose,
+                                                          const size_t, const size_t,
+                                                          cl_command_queue*, size_t*);
+
+template <typename T>
+StatusCode Syrk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xsyrk<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  if (workspace_size < routine.SyrkWorkspaceSize(layout, triangle, a_transpose,
+                                                 n, k)) {
+    return StatusCode::kInsufficientMemoryTemp;
+  }
+  routine.SetWorkspace(workspace, workspace_size);
+  return routine.DoSyrk(layout, triangle, a_transpose,
+                        n, k,
+                        alpha,
+                        Buffer<T>(a_buffer), a_offset, a_ld,
+                        beta,
+                        Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Syrk<float>(const Layout, const Triangle, const Transpose,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Syrk<double>(const Layout, const Triangle, const Transpose,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Syrk<float2>(const Layout, const Triangle, const Transpose,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Syrk<double2>(const Layout, const Triangle, const Transpose,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// Rank-K update of a hermitian matrix: CHERK/ZHERK
+template <typename T>
+StatusCode HerkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                             const size_t n, const size_t k,
+                             cl_command_queue* queue, size_t* workspace_size) {
+  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xherk<std::complex<T>,T>(queue_cpp, nullptr);
+  *workspace_size = routine.HerkWorkspaceSize(layout, triangle, a_transpose,
+                                              n, k);
+  return StatusCode::kSuccess;
+}
+template StatusCode PUBLIC_API HerkWorkspaceSize<float>(const Layout, const Triangle, const Transpose,
+                                                        const size_t, const size_t,
+                                                        cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API HerkWorkspaceSize<double>(const Layout, const Triangle, const Transpose,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+
+template <typename T>
+StatusCode Herk(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xherk<std::complex<T>,T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  if (workspace_size < routine.HerkWorkspaceSize(layout, triangle, a_transpose,
+                                                 n, k)) {
+    return StatusCode::kInsufficientMemoryTemp;
+  }
+  routine.SetWorkspace(workspace, workspace_size);
+  return routine.DoHerk(layout, triangle, a_transpose,
+                        n, k,
+                        alpha,
+                        Buffer<std::complex<T>>(a_buffer), a_offset, a_ld,
+                        beta,
+                        Buffer<std::complex<T>>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Herk<float>(const Layout, const Triangle, const Transpose,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Herk<double>(const Layout, const Triangle, const Transpose,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+
+// Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K
+template <typename T>
+StatusCode Syr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                              const size_t n, const size_t k,
+                              cl_command_queue* queue, size_t* workspace_size) {
+  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xsyr2k<T>(queue_cpp, nullptr);
+  *workspace_size = routine.Syr2kWorkspaceSize(layout, triangle, ab_transpose,
+                                               n, k);
+  return StatusCode::kSuccess;
+}
+template StatusCode PUBLIC_API Syr2kWorkspaceSize<float>(const Layout, const Triangle, const Transpose,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API Syr2kWorkspaceSize<double>(const Layout, const Triangle, const Transpose,
+                                                          const size_t, const size_t,
+                                                          cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API Syr2kWorkspaceSize<float2>(const Layout, const Triangle, const Transpose,
+                                                          const size_t, const size_t,
+                                                          cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API Syr2kWorkspaceSize<double2>(const Layout, const Triangle, const Transpose,
+                                                           const size_t, const size_t,
+                                                           cl_command_queue*, size_t*);
+
+template <typename T>
+StatusCode Syr2k(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                 const size_t n, const size_t k,
+                 const T alpha,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const T beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_mem workspace, const size_t workspace_size,
+                 cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xsyr2k<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  if (workspace_size < routine.Syr2kWorkspaceSize(layout, triangle, ab_transpose,
+                                                  n, k)) {
+    return StatusCode::kInsufficientMemoryTemp;
+  }
+  routine.SetWorkspace(workspace, workspace_size);
+  return routine.DoSyr2k(layout, triangle, ab_transpose,
+                         n, k,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         Buffer<T>(b_buffer), b_offset, b_ld,
+                         beta,
+                         Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Syr2k<float>(const Layout, const Triangle, const Transpose,
+                                            const size_t, const size_t,
+                                            const float,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Syr2k<double>(const Layout, const Triangle, const Transpose,
+                                             const size_t, const size_t,
+                                             const double,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Syr2k<float2>(const Layout, const Triangle, const Transpose,
+                                             const size_t, const size_t,
+                                             const float2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const float2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Syr2k<double2>(const Layout, const Triangle, const Transpose,
+                                              const size_t, const size_t,
+                                              const double2,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const double2,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
+template <typename T, typename U>
+StatusCode Her2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                              const size_t n, const size_t k,
+                              cl_command_queue* queue, size_t* workspace_size) {
+  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xher2k<T,U>(queue_cpp, nullptr);
+  *workspace_size = routine.Her2kWorkspaceSize(layout, triangle, ab_transpose,
+                                               n, k);
+  return StatusCode::kSuccess;
+}
+template StatusCode PUBLIC_API Her2kWorkspaceSize<float2,float>(const Layout, const Triangle, const Transpose,
+                                                                const size_t, const size_t,
+                                                                cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API Her2kWorkspaceSize<double2,double>(const Layout, const Triangle, const Transpose,
+                                                                  const size_t, const size_t,
+                                                                  cl_command_queue*, size_t*);
+
+template <typename T, typename U>
+StatusCode Her2k(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                 const size_t n, const size_t k,
+                 const T alpha,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                 const U beta,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_mem workspace, const size_t workspace_size,
+                 cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xher2k<T,U>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  if (workspace_size < routine.Her2kWorkspaceSize(layout, triangle, ab_transpose,
+                                                  n, k)) {
+    return StatusCode::kInsufficientMemoryTemp;
+  }
+  routine.SetWorkspace(workspace, workspace_size);
+  return routine.DoHer2k(layout, triangle, ab_transpose,
+                         n, k,
+                         alpha,
+                         Buffer<T>(a_buffer), a_offset, a_ld,
+                         Buffer<T>(b_buffer), b_offset, b_ld,
+                         beta,
+                         Buffer<T>(c_buffer), c_offset, c_ld);
+}
+template StatusCode PUBLIC_API Her2k<float2,float>(const Layout, const Triangle, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const float2,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const float,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_mem, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Her2k<double2,double>(const Layout, const Triangle, const Transpose,
+                                                     const size_t, const size_t,
+                                                     const double2,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const double,
+                                                     cl_mem, const size_t, const size_t,
+                                                     cl_mem, const size_t,
+                                                     cl_command_queue*, cl_event*);
+
+// Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM
+template <typename T>
+StatusCode TrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                             const size_t m, const size_t n,
+                             cl_command_queue* queue, size_t* workspace_size) {
+  if (workspace_size == nullptr) { return StatusCode::kInsufficientMemoryTemp; }
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xtrmm<T>(queue_cpp, nullptr);
+  *workspace_size = routine.TrmmWorkspaceSize(layout, side, triangle, a_transpose, diagonal,
+                                              m, n);
+  return StatusCode::kSuccess;
+}
+template StatusCode PUBLIC_API TrmmWorkspaceSize<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                        const size_t, const size_t,
+                                                        cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API TrmmWorkspaceSize<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API TrmmWorkspaceSize<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                         const size_t, const size_t,
+                                                         cl_command_queue*, size_t*);
+template StatusCode PUBLIC_API TrmmWorkspaceSize<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                                          const size_t, const size_t,
+                                                          cl_command_queue*, size_t*);
+
+template <typename T>
+StatusCode Trmm(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                cl_mem workspace, const size_t workspace_size,
+                cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xtrmm<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  if (workspace_size < routine.TrmmWorkspaceSize(layout, side, triangle, a_transpose, diagonal,
+                                                 m, n)) {
+    return StatusCode::kInsufficientMemoryTemp;
+  }
+  routine.SetWorkspace(workspace, workspace_size);
+  return routine.DoTrmm(layout, side, triangle, a_transpose, diagonal,
+                        m, n,
+                        alpha,
+                        Buffer<T>(a_buffer), a_offset, a_ld,
+                        Buffer<T>(b_buffer), b_offset, b_ld);
+}
+template StatusCode PUBLIC_API Trmm<float>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trmm<double>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trmm<float2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trmm<double2>(const Layout, const Side, const Triangle, const Transpose, const Diagonal,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Grouped version of GEMM
+template <typename T>
+StatusCode GemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t group_count, const cl_mem problems_buffer,
+                              const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                              const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                              cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = XgemmGroupedBatched<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine.DoGemmGroupedBatched(layout, a_transpose, b_transpose, group_count,
+                                      Buffer<int>(problems_buffer),
+                                      Buffer<T>(alphas_buffer), Buffer<T>(betas_buffer),
+                                      Buffer<T>(a_buffer), Buffer<T>(b_buffer), Buffer<T>(c_buffer));
+}
+template StatusCode PUBLIC_API GemmGroupedBatched<float>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const cl_mem, const cl_mem, const cl_mem,
+                                                         const cl_mem, const cl_mem, cl_mem,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGroupedBatched<double>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const cl_mem, const cl_mem, const cl_mem,
+                                                          const cl_mem, const cl_mem, cl_mem,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGroupedBatched<float2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const cl_mem, const cl_mem, const cl_mem,
+                                                          const cl_mem, const cl_mem, cl_mem,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGroupedBatched<double2>(const Layout, const Transpose, const Transpose,
+                                                           const size_t, const cl_mem, const cl_mem, const cl_mem,
+                                                           const cl_mem, const cl_mem, cl_mem,
+                                                           cl_command_queue*, cl_event*);
+
+// Mixed-precision version of GEMM
+StatusCode GemmMixed(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                     const size_t m, const size_t n, const size_t k,
+                     const float alpha,
+                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                     const float beta,
+                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                     cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = XgemmMixed(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine.DoGemmMixed(layout, a_transpose, b_transpose, m, n, k, alpha,
+                             Buffer<half>(a_buffer), a_offset, a_ld,
+                             Buffer<half>(b_buffer), b_offset, b_ld, beta,
+                             Buffer<float>(c_buffer), c_offset, c_ld);
+}
+
+// Conversions between single-precision and half-precision on the device
+StatusCode ConvertFloatToHalf(const size_t n,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xconvert(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine.DoConvertFloatToHalf(n, Buffer<float>(x_buffer), x_offset, x_inc,
+                                      Buffer<half>(y_buffer), y_offset, y_inc);
+}
+StatusCode ConvertHalfToFloat(const size_t n,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = Xconvert(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine.DoConvertHalfToFloat(n, Buffer<half>(x_buffer), x_offset, x_inc,
+                                      Buffer<float>(y_buffer), y_offset, y_inc);
+}
+
+// GEMM with a bias, activation, and scaling epilogue
+template <typename T>
+StatusCode GemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        const Bias bias, const cl_mem bias_buffer, const size_t bias_offset,
+                        const Activation activation,
+                        const cl_mem row_scale_buffer, const size_t row_scale_offset,
+                        const cl_mem col_scale_buffer, const size_t col_scale_offset,
+                        cl_command_queue* queue, cl_event* event) {
+  auto queue_cpp = Queue(*queue);
+  auto routine = XgemmEpilogue<T>(queue_cpp, event);
+  auto status = routine.SetUp();
+  if (status != StatusCode::kSuccess) { return status; }
+  return routine.DoGemmEpilogue(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                Buffer<T>(a_buffer), a_offset, a_ld,
+                                Buffer<T>(b_buffer), b_offset, b_ld, beta,
+                                Buffer<T>(c_buffer), c_offset, c_ld,
+                                bias, Buffer<T>(bias_buffer), bias_offset, activation,
+                                Buffer<T>(row_scale_buffer), row_scale_offset,
+                                Buffer<T>(col_scale_buffer), col_scale_offset);
+}
+template StatusCode PUBLIC_API GemmEpilogue<float>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const float,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const float,
+                                                   cl_mem, const size_t, const size_t,
+                                                   const Bias, const cl_mem, const size_t, const Activation,
+                                                   const cl_mem, const size_t, const cl_mem, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmEpilogue<double>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const double,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const double,
+                                                    cl_mem, const size_t, const size_t,
+                                                    const Bias, const cl_mem, const size_t, const Activation,
+                                                    const cl_mem, const size_t, const cl_mem, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmEpilogue<half>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const half,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const half,
+                                                  cl_mem, const size_t, const size_t,
+                                                  const Bias, const cl_mem, const size_t, const Activation,
+                                                  const cl_mem, const size_t, const cl_mem, const size_t,
+                                                  cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Clears the cache of stored binaries
+StatusCode ClearCache() { return cache::ClearCache(); }
+
+// A single task of the cache warm-up: setting up a routine for a specific precision
+struct WarmUpTask {
+  std::string routine_name; // e.g. "GEMM"
+  Precision precision;
+  std::function<StatusCode(Queue&)> set_up;
+};
+
+// Adds a warm-up task for a routine object of type R, which is constructed on the given queue. This
+// sets-up the routine's main program as well as its separately compiled programs (if any).
+template <typename R>
+void AddWarmUpTask(std::vector<WarmUpTask> &tasks, const std::string &routine_name,
+                   const Precision precision) {
+  tasks.push_back(WarmUpTask{routine_name, precision, [](Queue &queue) -> StatusCode {
+    R routine(queue, nullptr);
+    const auto status = routine.SetUp();
+    if (status != StatusCode::kSuccess) { return status; }
+    return routine.SetUpSubPrograms();
+  }});
+}
+
+// As above, but for all four regular precisions at once
+template <template <typename> class R>
+void AddWarmUpTasks(std::vector<WarmUpTask> &tasks, const std::string &routine_name) {
+  AddWarmUpTask<R<float>>(tasks, routine_name, Precision::kSingle);
+  AddWarmUpTask<R<double>>(tasks, routine_name, Precision::kDouble);
+  AddWarmUpTask<R<float2>>(tasks, routine_name, Precision::kComplexSingle);
+  AddWarmUpTask<R<double2>>(tasks, routine_name, Precision::kComplexDouble);
+}
+
+// Retrieves the tasks to set-up all routines for all precisions
+static std::vector<WarmUpTask> AllWarmUpTasks() {
+  auto tasks = std::vector<WarmUpTask>();
+
+  // Level 1 routines
+  AddWarmUpTasks<Xswap>(tasks, "SWAP");
+  AddWarmUpTask<Xswap<half>>(tasks, "SWAP", Precision::kHalf);
+  AddWarmUpTasks<Xscal>(tasks, "SCAL");
+  AddWarmUpTask<Xscal<half>>(tasks, "SCAL", Precision::kHalf);
+  AddWarmUpTasks<Xcopy>(tasks, "COPY");
+  AddWarmUpTask<Xcopy<half>>(tasks, "COPY", Precision::kHalf);
+  AddWarmUpTasks<Xaxpy>(tasks, "AXPY");
+  AddWarmUpTask<Xaxpy<half>>(tasks, "AXPY", Precision::kHalf);
+  AddWarmUpTask<Xdot<float>>(tasks, "DOT", Precision::kSingle);
+  AddWarmUpTask<Xdot<double>>(tasks, "DOT", Precision::kDouble);
+  AddWarmUpTask<Xdot<half>>(tasks, "DOT", Precision::kHalf);
+  AddWarmUpTask<Xdotu<float2>>(tasks, "DOTU", Precision::kComplexSingle);
+  AddWarmUpTask<Xdotu<double2>>(tasks, "DOTU", Precision::kComplexDouble);
+  AddWarmUpTask<Xdotc<float2>>(tasks, "DOTC", Precision::kComplexSingle);
+  AddWarmUpTask<Xdotc<double2>>(tasks, "DOTC", Precision::kComplexDouble);
+  AddWarmUpTasks<Xnrm2>(tasks, "NRM2");
+  AddWarmUpTasks<Xasum>(tasks, "ASUM");
+  AddWarmUpTasks<Xsum>(tasks, "SUM");
+  AddWarmUpTasks<Xamax>(tasks, "AMAX");
+  AddWarmUpTasks<Xmax>(tasks, "MAX");
+  AddWarmUpTasks<Xmin>(tasks, "MIN");
+
+  // Level 2 routines
+  AddWarmUpTasks<Xgemv>(tasks, "GEMV");
+  AddWarmUpTask<Xgemv<half>>(tasks, "GEMV", Precision::kHalf);
+  AddWarmUpTasks<Xgbmv>(tasks, "GBMV");
+  AddWarmUpTask<Xhemv<float2>>(tasks, "HEMV", Precision::kComplexSingle);
+  AddWarmUpTask<Xhemv<double2>>(tasks, "HEMV", Precision::kComplexDouble);
+  AddWarmUpTask<Xhbmv<float2>>(tasks, "HBMV", Precision::kComplexSingle);
+  AddWarmUpTask<Xhbmv<double2>>(tasks, "HBMV", Precision::kComplexDouble);
+  AddWarmUpTask<Xhpmv<float2>>(tasks, "HPMV", Precision::kComplexSingle);
+  AddWarmUpTask<Xhpmv<double2>>(tasks, "HPMV", Precision::kComplexDouble);
+  AddWarmUpTask<Xsymv<float>>(tasks, "SYMV", Precision::kSingle);
+  AddWarmUpTask<Xsymv<double>>(tasks, "SYMV", Precision::kDouble);
+  AddWarmUpTask<Xsbmv<float>>(tasks, "SBMV", Precision::kSingle);
+  AddWarmUpTask<Xsbmv<double>>(tasks, "SBMV", Precision::kDouble);
+  AddWarmUpTask<Xspmv<float>>(tasks, "SPMV", Precision::kSingle);
+  AddWarmUpTask<Xspmv<double>>(tasks, "SPMV", Precision::kDouble);
+  AddWarmUpTasks<Xtrmv>(tasks, "TRMV");
+  AddWarmUpTasks<Xtbmv>(tasks, "TBMV");
+  AddWarmUpTasks<Xtpmv>(tasks, "TPMV");
+  AddWarmUpTask<Xger<float>>(tasks, "GER", Precision::kSingle);
+  AddWarmUpTask<Xger<double>>(tasks, "GER", Precision::kDouble);
+  AddWarmUpTask<Xger<half>>(tasks, "GER", Precision::kHalf);
+  AddWarmUpTask<Xgeru<float2>>(tasks, "GERU", Precision::kComplexSingle);
+  AddWarmUpTask<Xgeru<double2>>(tasks, "GERU", Precision::kComplexDouble);
+  AddWarmUpTask<Xgerc<float2>>(tasks, "GERC", Precision::kComplexSingle);
+  AddWarmUpTask<Xgerc<double2>>(tasks, "GERC", Precision::kComplexDouble);
+  AddWarmUpTask<Xher<float2,float>>(tasks, "HER", Precision::kComplexSingle);
+  AddWarmUpTask<Xher<double2,double>>(tasks, "HER", Precision::kComplexDouble);
+  AddWarmUpTask<Xhpr<float2,float>>(tasks, "HPR", Precision::kComplexSingle);
+  AddWarmUpTask<Xhpr<double2,double>>(tasks, "HPR", Precision::kComplexDouble);
+  AddWarmUpTask<Xher2<float2>>(tasks, "HER2", Precision::kComplexSingle);
+  AddWarmUpTask<Xher2<double2>>(tasks, "HER2", Precision::kComplexDouble);
+  AddWarmUpTask<Xhpr2<float2>>(tasks, "HPR2", Precision::kComplexSingle);
+  AddWarmUpTask<Xhpr2<double2>>(tasks, "HPR2", Precision::kComplexDouble);
+  AddWarmUpTask<Xsyr<float>>(tasks, "SYR", Precision::kSingle);
+  AddWarmUpTask<Xsyr<double>>(tasks, "SYR", Precision::kDouble);
+  AddWarmUpTask<Xspr<float>>(tasks, "SPR", Precision::kSingle);
+  AddWarmUpTask<Xspr<double>>(tasks, "SPR", Precision::kDouble);
+  AddWarmUpTask<Xsyr2<float>>(tasks, "SYR2", Precision::kSingle);
+  AddWarmUpTask<Xsyr2<double>>(tasks, "SYR2", Precision::kDouble);
+  AddWarmUpTask<Xspr2<float>>(tasks, "SPR2", Precision::kSingle);
+  AddWarmUpTask<Xspr2<double>>(tasks, "SPR2", Precision::kDouble);
+
+  // Level 3 routines
+  AddWarmUpTasks<Xgemm>(tasks, "GEMM");
+  AddWarmUpTask<Xgemm<half>>(tasks, "GEMM", Precision::kHalf);
+  AddWarmUpTasks<Xsymm>(tasks, "SYMM");
+  AddWarmUpTask<Xhemm<float2>>(tasks, "HEMM", Precision::kComplexSingle);
+  AddWarmUpTask<Xhemm<double2>>(tasks, "HEMM", Precision::kComplexDouble);
+  AddWarmUpTasks<Xsyrk>(tasks, "SYRK");
+  AddWarmUpTask<Xherk<float2,float>>(tasks, "HERK", Precision::kComplexSingle);
+  AddWarmUpTask<Xherk<double2,double>>(tasks, "HERK", Precision::kComplexDouble);
+  AddWarmUpTasks<Xsyr2k>(tasks, "SYR2K");
+  AddWarmUpTask<Xher2k<float2,float>>(tasks, "HER2K", Precision::kComplexSingle);
+  AddWarmUpTask<Xher2k<double2,double>>(tasks, "HER2K", Precision::kComplexDouble);
+  AddWarmUpTasks<Xtrmm>(tasks, "TRMM");
+
+  // Extra non-BLAS routines
+  AddWarmUpTasks<XgemmStridedBatched>(tasks, "GEMMSTRIDEDBATCHED");
+  AddWarmUpTasks<XgemmGroupedBatched>(tasks, "GEMMGROUPEDBATCHED");
+  AddWarmUpTask<XgemmMixed>(tasks, "GEMMMIXED", Precision::kSingle);
+  AddWarmUpTask<Xconvert>(tasks, "CONVERT", Precision::kSingle);
+  AddWarmUpTask<XgemmEpilogue<float>>(tasks, "GEMMEPILOGUE", Precision::kSingle);
+  AddWarmUpTask<XgemmEpilogue<double>>(tasks, "GEMMEPILOGUE", Precision::kDouble);
+  AddWarmUpTask<XgemmEpilogue<half>>(tasks, "GEMMEPILOGUE", Precision::kHalf);
+  return tasks;
+}
+
+// Retrieves the single-letter prefix of a routine's name for a given precision, e.g. 'S' for SGEMM
+static std::string PrecisionPrefix(const Precision precision) {
+  switch (precision) {
+    case Precision::kHalf: return "H";
+    case Precision::kSingle: return "S";
+    case Precision::kDouble: return "D";
+    case Precision::kComplexSingle: return "C";
+    case Precision::kComplexDouble: return "Z";
+  }
+  return "";
+}
+
+// Retrieves the warm-up tasks for a selection of routines, given as a comma-separated list of names
+// with a precision prefix (e.g. "SGEMM,ZHERK"). Returns false if any of the names is unknown.
+static bool SelectWarmUpTasks(const char* routines, std::vector<WarmUpTask> &tasks) {
+  const auto all_tasks = AllWarmUpTasks();
+  if (routines == nullptr) { tasks = all_tasks; return true; }
+  std::stringstream selection(routines);
+  auto name = std::string{};
+  while (std::getline(selection, name, ',')) {
+    name.erase(0, name.find_first_not_of(" \t"));
+    name.erase(name.find_last_not_of(" \t") + 1);
+    if (name.empty()) { continue; }
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+    auto found = false;
+    for (const auto &task: all_tasks) {
+      const auto prefix = PrecisionPrefix(task.precision);
+      if (name == prefix + task.routine_name) { tasks.push_back(task); found = true; }
+    }
+    if (!found) { return false; }
+  }
+  return true;
+}
+
+// Runs the warm-up tasks on a number of host threads, each picking the next task from the list
+// until all are done. The tasks must have been marked as pending beforehand and are unmarked when
+// finished, whether successful or not (e.g. double-precision on a device without support for it).
+static void RunWarmUpTasks(const std::vector<WarmUpTask> &tasks, Queue &queue,
+                           const std::string &device_name, const size_t num_threads) {
+  std::atomic<size_t> next_task{0};
+  auto worker = [&]() {
+    for (auto i = next_task++; i < tasks.size(); i = next_task++) {
+      const auto &task = tasks[i];
+      cache::ClaimPendingBinary(device_name, task.precision, task.routine_name);
+      try { task.set_up(queue); } catch (...) { }
+      cache::UnmarkPendingBinary(device_name, task.precision, task.routine_name);
+    }
+  };
+  auto threads = std::vector<std::thread>();
+  for (auto t = size_t{1}; t < num_threads; ++t) {
+    try { threads.push_back(std::thread(worker)); } catch (...) { break; } // Continues with fewer
+  }
+  worker();
+  for (auto &thread: threads) { thread.join(); }
+}
+
+// Removes the pending marks of the first 'num_marked' warm-up tasks when going out of scope, unless
+// released: this happens once the tasks are handed off to 'RunWarmUpTasks', which unmarks them
+// itself. Otherwise, e.g. when starting the background task fails, routine calls would wait forever.
+struct PendingBinariesGuard {
+  const std::vector<WarmUpTask> &tasks;
+  const std::string &device_name;
+  size_t num_marked;
+  bool released;
+  ~PendingBinariesGuard() {
+    if (released) { return; }
+    for (auto i = size_t{0}; i < num_marked; ++i) {
+      cache::UnmarkPendingBinary(device_name, tasks[i].precision, tasks[i].routine_name);
+    }
+  }
+};
+
+// Fills the cache for a selection of routines, either blocking or in the background
+static StatusCode FillCacheSelection(const cl_device_id device, const char* routines,
+                                     const size_t num_threads, const bool asynchronous) {
+  try {
+    auto tasks = std::vector<WarmUpTask>();
+    if (!SelectWarmUpTasks(routines, tasks)) { return StatusCode::kNotImplemented; }
+    auto threads = (num_threads != 0) ? num_threads :
+                   std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+    threads = std::min(threads, std::max(size_t{1}, tasks.size()));
+
+    // Creates a sample context and queue to match the normal routine calling conventions
+    auto device_cpp = Device(device);
+    auto context = Context(device_cpp);
+    auto queue = Queue(context, device_cpp);
+    const auto device_name = device_cpp.Name();
+
+    // Marks all binaries as pending, such that routine calls wait for them instead of compiling
+    // them a second time. This has to be done before returning in the asynchronous case.
+    auto guard = PendingBinariesGuard{tasks, device_name, 0, false};
+    for (const auto &task: tasks) {
+      cache::MarkBinaryAsPending(device_name, task.precision, task.routine_name);
+      guard.num_marked++;
+    }
+    if (!asynchronous) {
+      guard.released = true;
+      RunWarmUpTasks(tasks, queue, device_name, threads);
+    }
+    else {
+      auto background_task = std::async(std::launch::async, [=]() mutable {
+        RunWarmUpTasks(tasks, queue, device_name, threads);
+      });
+      guard.released = true; // Destroying the task (e.g. on failure below) waits for it to finish
+      cache::AddBackgroundTask(std::move(background_task));
+    }
+  } catch (...) { return StatusCode::kBuildProgramFailure; }
+  return StatusCode::kSuccess;
+}
+
+// Fills the cache with all binaries for a specific device
+StatusCode FillCache(const cl_device_id device) {
+  return FillCacheSelection(device, nullptr, 0, false);
+}
+
+// Fills the cache with the binaries of a selection of routines for a specific device
+StatusCode FillCache(const cl_device_id device, const char* routines, const size_t num_threads) {
+  return FillCacheSelection(device, routines, num_threads, false);
+}
+
+// As above, but returns immediately and compiles in the background
+StatusCode FillCacheAsync(const cl_device_id device, const char* routines,
+                          const size_t num_threads) {
+  return FillCacheSelection(device, routines, num_threads, true);
+}
+
+// Sets the directory of the on-disk cache of binaries
+StatusCode SetCacheDirectory(const char* directory) {
+  cache::SetCacheDirectory((directory == nullptr) ? std::string{} : std::string{directory});
+  return StatusCode::kSuccess;
+}
+
+// Sets the limits of the cache
+StatusCode SetCacheLimits(const size_t max_binary_bytes, const size_t max_programs) {
+  cache::SetCacheLimits(max_binary_bytes, max_programs);
+  return StatusCode::kSuccess;
+}
+
+// Removes all programs of a specific context from the cache
+StatusCode ClearCacheForContext(const cl_context context) {
+  cache::ClearCacheForContext(context);
+  return StatusCode::kSuccess;
+}
+
+// Retrieves statistics about the usage of the cache. A null-pointer is ignored.
+StatusCode GetCacheStatistics(CacheStatistics* statistics) {
+  if (statistics == nullptr) { return StatusCode::kSuccess; }
+  const auto cache_statistics = cache::GetStatistics();
+  statistics->program_hits = cache_statistics.program_hits;
+  statistics->program_misses = cache_statistics.program_misses;
+  statistics->compilations = cache_statistics.compilations;
+  statistics->compilation_time_ms = cache_statistics.compilation_time_ms;
+  statistics->num_binaries = cache_statistics.num_binaries;
+  statistics->binary_bytes = cache_statistics.binary_bytes;
+  statistics->num_programs = cache_statistics.num_programs;
+  statistics->evictions = cache_statistics.evictions;
+  return StatusCode::kSuccess;
+}
+
+// Exports the binaries of a specific device into a blob
+StatusCode ExportCache(const cl_device_id device, char* blob, size_t* blob_size) {
+  if (blob_size == nullptr) { return StatusCode::kInsufficientMemoryBlob; }
+  try {
+    const auto device_cpp = Device(device);
+    const auto data = cache::ExportBinaries(device_cpp.Name(), device_cpp.DriverVersion());
+    const auto available_size = *blob_size;
+    *blob_size = data.size();
+    if (blob == nullptr) { return StatusCode::kSuccess; }
+    if (available_size < data.size()) { return StatusCode::kInsufficientMemoryBlob; }
+    std::copy(data.begin(), data.end(), blob);
+  } catch (...) { return StatusCode::kInvalidBinary; }
+  return StatusCode::kSuccess;
+}
+
+// Imports the binaries from a blob for a specific device
+StatusCode ImportCache(const cl_device_id device, const char* blob, const size_t blob_size) {
+  if (blob == nullptr) { return StatusCode::kInvalidBinary; }
+  try {
+    const auto device_cpp = Device(device);
+    const auto data = std::string(blob, blob_size);
+    if (!cache::ImportBinaries(data, device_cpp.Name(), device_cpp.DriverVersion())) {
+      return StatusCode::kInvalidBinary;
+    }
+  } catch (...) { return StatusCode::kInvalidBinary; }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Sets the path of the tuner output files overriding the built-in tuning parameters. Programs are
+// removed from the cache, since they were compiled with the previous parameters.
+StatusCode SetTuningParametersPath(const char* path) {
+  Database::SetOverridesPath((path == nullptr) ? std::string{} : std::string{path});
+  cache::ClearProgramCache();
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Sets the limit of the total size of the idle buffers in the pool
+StatusCode SetBufferPoolLimit(const size_t max_idle_bytes) {
+  pool::SetPoolLimit(max_idle_bytes);
+  return StatusCode::kSuccess;
+}
+
+// Releases the idle buffers of a specific context (or of all contexts)
+StatusCode ClearBufferPool(const cl_context context) {
+  pool::ClearPool(context);
+  return StatusCode::kSuccess;
+}
+
+// Retrieves statistics about the usage of the buffer pool. A null-pointer is ignored.
+StatusCode GetBufferPoolStatistics(BufferPoolStatistics* statistics) {
+  if (statistics == nullptr) { return StatusCode::kSuccess; }
+  const auto pool_statistics = pool::GetStatistics();
+  statistics->allocations = pool_statistics.allocations;
+  statistics->reuses = pool_statistics.reuses;
+  statistics->releases = pool_statistics.releases;
+  statistics->bytes_in_use = pool_statistics.bytes_in_use;
+  statistics->num_idle = pool_statistics.num_idle;
+  statistics->idle_bytes = pool_statistics.idle_bytes;
+  return StatusCode::kSuccess;
+}
+
+// Sets the memory budget for the temporary buffers of a context
+StatusCode SetMemoryBudget(const cl_context context, const size_t max_bytes) {
+  pool::SetMemoryBudget(context, max_bytes);
+  return StatusCode::kSuccess;
+}
+
+// Sets the accuracy mode of the GEMM routines
+StatusCode SetGemmAccuracy(const GemmAccuracy accuracy) {
+  SetGemmAccuracyMode(accuracy);
+  return StatusCode::kSuccess;
+}
+
+// Sets the maximum depth of the Strassen-Winograd recursion of the GEMM routines
+StatusCode SetGemmStrassenDepth(const size_t max_depth) {
+  SetGemmStrassenDepthLimit(max_depth);
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Creates a new handle for a specific queue
+StatusCode CreateHandle(cl_command_queue* queue, Handle* handle) {
+  if (queue == nullptr || handle == nullptr) { return StatusCode::kInvalidHandle; }
+  *handle = new HandleImpl(*queue);
+  return StatusCode::kSuccess;
+}
+
+// Releases a handle and all the routine objects it holds
+StatusCode ReleaseHandle(Handle handle) {
+  if (handle == nullptr) { return StatusCode::kInvalidHandle; }
+  delete handle;
   return StatusCode::kSuccess;
 }
 
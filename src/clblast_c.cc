@@ -178,6 +178,16 @@ StatusCode CLBlastZswap(const size_t n,
                                        queue, event);
   return static_cast<StatusCode>(status);
 }
+StatusCode CLBlastHswap(const size_t n,
+                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                        cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Swap<half>(n,
+                                    x_buffer, x_offset, x_inc,
+                                    y_buffer, y_offset, y_inc,
+                                    queue, event);
+  return static_cast<StatusCode>(status);
+}
 
 // SCAL
 StatusCode CLBlastSscal(const size_t n,
@@ -220,6 +230,16 @@ StatusCode CLBlastZscal(const size_t n,
                               queue, event);
   return static_cast<StatusCode>(status);
 }
+StatusCode CLBlastHscal(const size_t n,
+                        const cl_half alpha,
+                        cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                        cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Scal(n,
+                              alpha,
+                              x_buffer, x_offset, x_inc,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
 
 // COPY
 StatusCode CLBlastScopy(const size_t n,
@@ -262,6 +282,16 @@ StatusCode CLBlastZcopy(const size_t n,
                                        queue, event);
   return static_cast<StatusCode>(status);
 }
+StatusCode CLBlastHcopy(const size_t n,
+                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                        cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Copy<half>(n,
+                                    x_buffer, x_offset, x_inc,
+                                    y_buffer, y_offset, y_inc,
+                                    queue, event);
+  return static_cast<StatusCode>(status);
+}
 
 // AXPY
 StatusCode CLBlastSaxpy(const size_t n,
@@ -312,6 +342,18 @@ StatusCode CLBlastZaxpy(const size_t n,
                               queue, event);
   return static_cast<StatusCode>(status);
 }
+StatusCode CLBlastHaxpy(const size_t n,
+                        const cl_half alpha,
+                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                        cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Axpy(n,
+                              alpha,
+                              x_buffer, x_offset, x_inc,
+                              y_buffer, y_offset, y_inc,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
 
 // DOT
 StatusCode CLBlastSdot(const size_t n,
@@ -338,6 +380,18 @@ StatusCode CLBlastDdot(const size_t n,
                                      queue, event);
   return static_cast<StatusCode>(status);
 }
+StatusCode CLBlastHdot(const size_t n,
+                       cl_mem dot_buffer, const size_t dot_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Dot<half>(n,
+                                   dot_buffer, dot_offset,
+                                   x_buffer, x_offset, x_inc,
+                                   y_buffer, y_offset, y_inc,
+                                   queue, event);
+  return static_cast<StatusCode>(status);
+}
 
 // DOTU
 StatusCode CLBlastCdotu(const size_t n,
@@ -724,6 +778,25 @@ StatusCode CLBlastZgemv(const Layout layout, const Transpose a_transpose,
                               queue, event);
   return static_cast<StatusCode>(status);
 }
+StatusCode CLBlastHgemv(const Layout layout, const Transpose a_transpose,
+                        const size_t m, const size_t n,
+                        const cl_half alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                        const cl_half beta,
+                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                        cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Gemv(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              x_buffer, x_offset, x_inc,
+                              beta,
+                              y_buffer, y_offset, y_inc,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
 
 // GBMV
 StatusCode CLBlastSgbmv(const Layout layout, const Transpose a_transpose,
@@ -1448,6 +1521,22 @@ StatusCode CLBlastDger(const Layout layout,
                              queue, event);
   return static_cast<StatusCode>(status);
 }
+StatusCode CLBlastHger(const Layout layout,
+                       const size_t m, const size_t n,
+                       const cl_half alpha,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                       cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Ger(static_cast<clblast::Layout>(layout),
+                             m, n,
+                             alpha,
+                             x_buffer, x_offset, x_inc,
+                             y_buffer, y_offset, y_inc,
+                             a_buffer, a_offset, a_ld,
+                             queue, event);
+  return static_cast<StatusCode>(status);
+}
 
 // GERU
 StatusCode CLBlastCgeru(const Layout layout,
@@ -1874,6 +1963,26 @@ StatusCode CLBlastZgemm(const Layout layout, const Transpose a_transpose, const
                               queue, event);
   return static_cast<StatusCode>(status);
 }
+StatusCode CLBlastHgemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const cl_half alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const cl_half beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Gemm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
 
 // SYMM
 StatusCode CLBlastSsymm(const Layout layout, const Side side, const Triangle triangle,
@@ -2383,16 +2492,1883 @@ StatusCode CLBlastZtrsm(const Layout layout, const Side side, const Triangle tri
   return static_cast<StatusCode>(status);
 }
 
+// =================================================================================================
+// Extra non-BLAS routines (level-X)
 // =================================================================================================
 
-// Clears the cache of stored binaries
-StatusCode CLBlastClearCache() {
-  return static_cast<StatusCode>(clblast::ClearCache());
+// GEMMSTRIDEDBATCHED
+StatusCode CLBlastSgemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const float alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                      const float beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                            static_cast<clblast::Transpose>(a_transpose),
+                                            static_cast<clblast::Transpose>(b_transpose),
+                                            m, n, k,
+                                            alpha,
+                                            a_buffer, a_offset, a_ld, a_stride,
+                                            b_buffer, b_offset, b_ld, b_stride,
+                                            beta,
+                                            c_buffer, c_offset, c_ld, c_stride,
+                                            batch_count,
+                                            queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDgemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const double alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                      const double beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                            static_cast<clblast::Transpose>(a_transpose),
+                                            static_cast<clblast::Transpose>(b_transpose),
+                                            m, n, k,
+                                            alpha,
+                                            a_buffer, a_offset, a_ld, a_stride,
+                                            b_buffer, b_offset, b_ld, b_stride,
+                                            beta,
+                                            c_buffer, c_offset, c_ld, c_stride,
+                                            batch_count,
+                                            queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCgemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const cl_float2 alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                      const cl_float2 beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                            static_cast<clblast::Transpose>(a_transpose),
+                                            static_cast<clblast::Transpose>(b_transpose),
+                                            m, n, k,
+                                            float2{alpha.s[0], alpha.s[1]},
+                                            a_buffer, a_offset, a_ld, a_stride,
+                                            b_buffer, b_offset, b_ld, b_stride,
+                                            float2{beta.s[0], beta.s[1]},
+                                            c_buffer, c_offset, c_ld, c_stride,
+                                            batch_count,
+                                            queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZgemmStridedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const cl_double2 alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride,
+                                      const cl_double2 beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmStridedBatched(static_cast<clblast::Layout>(layout),
+                                            static_cast<clblast::Transpose>(a_transpose),
+                                            static_cast<clblast::Transpose>(b_transpose),
+                                            m, n, k,
+                                            double2{alpha.s[0], alpha.s[1]},
+                                            a_buffer, a_offset, a_ld, a_stride,
+                                            b_buffer, b_offset, b_ld, b_stride,
+                                            double2{beta.s[0], beta.s[1]},
+                                            c_buffer, c_offset, c_ld, c_stride,
+                                            batch_count,
+                                            queue, event);
+  return static_cast<StatusCode>(status);
 }
 
-// Fills the cache with binaries for a specific device
-StatusCode CLBlastFillCache(const cl_device_id device) {
-  return static_cast<StatusCode>(clblast::FillCache(device));
+// =================================================================================================
+// Handle-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================
+
+// GEMM
+StatusCode CLBlastSgemmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const float alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const float beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Gemm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDgemmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const double alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const double beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Gemm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCgemmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const cl_float2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const cl_float2 beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Gemm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              float2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZgemmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const cl_double2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const cl_double2 beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Gemm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              double2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastHgemmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const cl_half alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const cl_half beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Gemm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+
+// SYMM
+StatusCode CLBlastSsymmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle,
+                                  const size_t m, const size_t n,
+                                  const float alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const float beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Symm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsymmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle,
+                                  const size_t m, const size_t n,
+                                  const double alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const double beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Symm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsymmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle,
+                                  const size_t m, const size_t n,
+                                  const cl_float2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const cl_float2 beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Symm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              float2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsymmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle,
+                                  const size_t m, const size_t n,
+                                  const cl_double2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const cl_double2 beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Symm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              double2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+
+// HEMM
+StatusCode CLBlastChemmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle,
+                                  const size_t m, const size_t n,
+                                  const cl_float2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const cl_float2 beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Hemm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              float2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZhemmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle,
+                                  const size_t m, const size_t n,
+                                  const cl_double2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  const cl_double2 beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Hemm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              double2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+
+// SYRK
+StatusCode CLBlastSsyrkWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                  const size_t n, const size_t k,
+                                  const float alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const float beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Syrk(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsyrkWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                  const size_t n, const size_t k,
+                                  const double alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const double beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Syrk(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsyrkWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                  const size_t n, const size_t k,
+                                  const cl_float2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_float2 beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Syrk(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              float2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsyrkWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                  const size_t n, const size_t k,
+                                  const cl_double2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const cl_double2 beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Syrk(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              double2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+
+// HERK
+StatusCode CLBlastCherkWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                  const size_t n, const size_t k,
+                                  const float alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const float beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Herk(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZherkWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                  const size_t n, const size_t k,
+                                  const double alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  const double beta,
+                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                  cl_event* event) {
+  auto status = clblast::Herk(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+
+// SYR2K
+StatusCode CLBlastSsyr2kWithHandle(CLBlastHandle handle,
+                                   const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                   const size_t n, const size_t k,
+                                   const float alpha,
+                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const float beta,
+                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                   cl_event* event) {
+  auto status = clblast::Syr2k(reinterpret_cast<clblast::Handle>(handle),
+                               static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               alpha,
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsyr2kWithHandle(CLBlastHandle handle,
+                                   const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                   const size_t n, const size_t k,
+                                   const double alpha,
+                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const double beta,
+                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                   cl_event* event) {
+  auto status = clblast::Syr2k(reinterpret_cast<clblast::Handle>(handle),
+                               static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               alpha,
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsyr2kWithHandle(CLBlastHandle handle,
+                                   const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                   const size_t n, const size_t k,
+                                   const cl_float2 alpha,
+                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const cl_float2 beta,
+                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                   cl_event* event) {
+  auto status = clblast::Syr2k(reinterpret_cast<clblast::Handle>(handle),
+                               static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               float2{alpha.s[0], alpha.s[1]},
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               float2{beta.s[0], beta.s[1]},
+                               c_buffer, c_offset, c_ld,
+                               event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsyr2kWithHandle(CLBlastHandle handle,
+                                   const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                   const size_t n, const size_t k,
+                                   const cl_double2 alpha,
+                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const cl_double2 beta,
+                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                   cl_event* event) {
+  auto status = clblast::Syr2k(reinterpret_cast<clblast::Handle>(handle),
+                               static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               double2{alpha.s[0], alpha.s[1]},
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               double2{beta.s[0], beta.s[1]},
+                               c_buffer, c_offset, c_ld,
+                               event);
+  return static_cast<StatusCode>(status);
+}
+
+// HER2K
+StatusCode CLBlastCher2kWithHandle(CLBlastHandle handle,
+                                   const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                   const size_t n, const size_t k,
+                                   const cl_float2 alpha,
+                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const float beta,
+                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                   cl_event* event) {
+  auto status = clblast::Her2k(reinterpret_cast<clblast::Handle>(handle),
+                               static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               float2{alpha.s[0], alpha.s[1]},
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZher2kWithHandle(CLBlastHandle handle,
+                                   const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                   const size_t n, const size_t k,
+                                   const cl_double2 alpha,
+                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                   const double beta,
+                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                   cl_event* event) {
+  auto status = clblast::Her2k(reinterpret_cast<clblast::Handle>(handle),
+                               static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               double2{alpha.s[0], alpha.s[1]},
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               event);
+  return static_cast<StatusCode>(status);
+}
+
+// TRMM
+StatusCode CLBlastStrmmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                  const size_t m, const size_t n,
+                                  const float alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  cl_event* event) {
+  auto status = clblast::Trmm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Diagonal>(diagonal),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDtrmmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                  const size_t m, const size_t n,
+                                  const double alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  cl_event* event) {
+  auto status = clblast::Trmm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Diagonal>(diagonal),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCtrmmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                  const size_t m, const size_t n,
+                                  const cl_float2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  cl_event* event) {
+  auto status = clblast::Trmm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Diagonal>(diagonal),
+                              m, n,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZtrmmWithHandle(CLBlastHandle handle,
+                                  const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                  const size_t m, const size_t n,
+                                  const cl_double2 alpha,
+                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                  cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                  cl_event* event) {
+  auto status = clblast::Trmm(reinterpret_cast<clblast::Handle>(handle),
+                              static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Diagonal>(diagonal),
+                              m, n,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              event);
+  return static_cast<StatusCode>(status);
+}
+
+// =================================================================================================
+// Workspace-size queries and workspace-based variants of the BLAS level-3 (matrix-matrix) routines
+// =================================================================================================
+
+// GEMM
+StatusCode CLBlastSgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::GemmWorkspaceSize<float>(static_cast<clblast::Layout>(layout),
+                                                  static_cast<clblast::Transpose>(a_transpose),
+                                                  static_cast<clblast::Transpose>(b_transpose),
+                                                  m, n, k,
+                                                  queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::GemmWorkspaceSize<double>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Transpose>(a_transpose),
+                                                   static_cast<clblast::Transpose>(b_transpose),
+                                                   m, n, k,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::GemmWorkspaceSize<float2>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Transpose>(a_transpose),
+                                                   static_cast<clblast::Transpose>(b_transpose),
+                                                   m, n, k,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::GemmWorkspaceSize<double2>(static_cast<clblast::Layout>(layout),
+                                                    static_cast<clblast::Transpose>(a_transpose),
+                                                    static_cast<clblast::Transpose>(b_transpose),
+                                                    m, n, k,
+                                                    queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastHgemmWorkspaceSize(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::GemmWorkspaceSize<half>(static_cast<clblast::Layout>(layout),
+                                                 static_cast<clblast::Transpose>(a_transpose),
+                                                 static_cast<clblast::Transpose>(b_transpose),
+                                                 m, n, k,
+                                                 queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastSgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const float alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const float beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Gemm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const double alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const double beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Gemm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_float2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_float2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Gemm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              float2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_double2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_double2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Gemm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              double2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastHgemmWithWorkspace(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_half alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_half beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Gemm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Transpose>(b_transpose),
+                              m, n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// SYMM
+StatusCode CLBlastSsymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::SymmWorkspaceSize<float>(static_cast<clblast::Layout>(layout),
+                                                  static_cast<clblast::Side>(side),
+                                                  static_cast<clblast::Triangle>(triangle),
+                                                  m, n,
+                                                  queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::SymmWorkspaceSize<double>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Side>(side),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   m, n,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::SymmWorkspaceSize<float2>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Side>(side),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   m, n,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsymmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::SymmWorkspaceSize<double2>(static_cast<clblast::Layout>(layout),
+                                                    static_cast<clblast::Side>(side),
+                                                    static_cast<clblast::Triangle>(triangle),
+                                                    m, n,
+                                                    queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastSsymmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     const float alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const float beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Symm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsymmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     const double alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const double beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Symm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsymmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     const cl_float2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_float2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Symm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              float2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsymmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     const cl_double2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_double2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Symm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              double2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// HEMM
+StatusCode CLBlastChemmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::HemmWorkspaceSize<float2>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Side>(side),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   m, n,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZhemmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::HemmWorkspaceSize<double2>(static_cast<clblast::Layout>(layout),
+                                                    static_cast<clblast::Side>(side),
+                                                    static_cast<clblast::Triangle>(triangle),
+                                                    m, n,
+                                                    queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastChemmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     const cl_float2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_float2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Hemm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              float2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZhemmWithWorkspace(const Layout layout, const Side side, const Triangle triangle,
+                                     const size_t m, const size_t n,
+                                     const cl_double2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_double2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Hemm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              m, n,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              double2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// SYRK
+StatusCode CLBlastSsyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::SyrkWorkspaceSize<float>(static_cast<clblast::Layout>(layout),
+                                                  static_cast<clblast::Triangle>(triangle),
+                                                  static_cast<clblast::Transpose>(a_transpose),
+                                                  n, k,
+                                                  queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::SyrkWorkspaceSize<double>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   static_cast<clblast::Transpose>(a_transpose),
+                                                   n, k,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::SyrkWorkspaceSize<float2>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   static_cast<clblast::Transpose>(a_transpose),
+                                                   n, k,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsyrkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::SyrkWorkspaceSize<double2>(static_cast<clblast::Layout>(layout),
+                                                    static_cast<clblast::Triangle>(triangle),
+                                                    static_cast<clblast::Transpose>(a_transpose),
+                                                    n, k,
+                                                    queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastSsyrkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     const float alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const float beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Syrk(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsyrkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     const double alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const double beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Syrk(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsyrkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     const cl_float2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_float2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Syrk(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              float2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsyrkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     const cl_double2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_double2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Syrk(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              double2{beta.s[0], beta.s[1]},
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// HERK
+StatusCode CLBlastCherkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::HerkWorkspaceSize<float>(static_cast<clblast::Layout>(layout),
+                                                  static_cast<clblast::Triangle>(triangle),
+                                                  static_cast<clblast::Transpose>(a_transpose),
+                                                  n, k,
+                                                  queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZherkWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::HerkWorkspaceSize<double>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   static_cast<clblast::Transpose>(a_transpose),
+                                                   n, k,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCherkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     const float alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const float beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Herk(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZherkWithWorkspace(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                                     const size_t n, const size_t k,
+                                     const double alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const double beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Herk(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              n, k,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              beta,
+                              c_buffer, c_offset, c_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// SYR2K
+StatusCode CLBlastSsyr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::Syr2kWorkspaceSize<float>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   static_cast<clblast::Transpose>(ab_transpose),
+                                                   n, k,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsyr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::Syr2kWorkspaceSize<double>(static_cast<clblast::Layout>(layout),
+                                                    static_cast<clblast::Triangle>(triangle),
+                                                    static_cast<clblast::Transpose>(ab_transpose),
+                                                    n, k,
+                                                    queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsyr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::Syr2kWorkspaceSize<float2>(static_cast<clblast::Layout>(layout),
+                                                    static_cast<clblast::Triangle>(triangle),
+                                                    static_cast<clblast::Transpose>(ab_transpose),
+                                                    n, k,
+                                                    queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsyr2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::Syr2kWorkspaceSize<double2>(static_cast<clblast::Layout>(layout),
+                                                     static_cast<clblast::Triangle>(triangle),
+                                                     static_cast<clblast::Transpose>(ab_transpose),
+                                                     n, k,
+                                                     queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastSsyr2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      const float alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const float beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                      cl_mem workspace, const size_t workspace_size,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Syr2k(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               alpha,
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               workspace, workspace_size,
+                               queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDsyr2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      const double alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const double beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                      cl_mem workspace, const size_t workspace_size,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Syr2k(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               alpha,
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               workspace, workspace_size,
+                               queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCsyr2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      const cl_float2 alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const cl_float2 beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                      cl_mem workspace, const size_t workspace_size,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Syr2k(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               float2{alpha.s[0], alpha.s[1]},
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               float2{beta.s[0], beta.s[1]},
+                               c_buffer, c_offset, c_ld,
+                               workspace, workspace_size,
+                               queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZsyr2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      const cl_double2 alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const cl_double2 beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                      cl_mem workspace, const size_t workspace_size,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Syr2k(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               double2{alpha.s[0], alpha.s[1]},
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               double2{beta.s[0], beta.s[1]},
+                               c_buffer, c_offset, c_ld,
+                               workspace, workspace_size,
+                               queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// HER2K
+StatusCode CLBlastCher2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::Her2kWorkspaceSize<float2,float>(static_cast<clblast::Layout>(layout),
+                                                          static_cast<clblast::Triangle>(triangle),
+                                                          static_cast<clblast::Transpose>(ab_transpose),
+                                                          n, k,
+                                                          queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZher2kWorkspaceSize(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::Her2kWorkspaceSize<double2,double>(static_cast<clblast::Layout>(layout),
+                                                            static_cast<clblast::Triangle>(triangle),
+                                                            static_cast<clblast::Transpose>(ab_transpose),
+                                                            n, k,
+                                                            queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCher2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      const cl_float2 alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const float beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                      cl_mem workspace, const size_t workspace_size,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Her2k(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               float2{alpha.s[0], alpha.s[1]},
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               workspace, workspace_size,
+                               queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZher2kWithWorkspace(const Layout layout, const Triangle triangle, const Transpose ab_transpose,
+                                      const size_t n, const size_t k,
+                                      const cl_double2 alpha,
+                                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const double beta,
+                                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                      cl_mem workspace, const size_t workspace_size,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Her2k(static_cast<clblast::Layout>(layout),
+                               static_cast<clblast::Triangle>(triangle),
+                               static_cast<clblast::Transpose>(ab_transpose),
+                               n, k,
+                               double2{alpha.s[0], alpha.s[1]},
+                               a_buffer, a_offset, a_ld,
+                               b_buffer, b_offset, b_ld,
+                               beta,
+                               c_buffer, c_offset, c_ld,
+                               workspace, workspace_size,
+                               queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// TRMM
+StatusCode CLBlastStrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::TrmmWorkspaceSize<float>(static_cast<clblast::Layout>(layout),
+                                                  static_cast<clblast::Side>(side),
+                                                  static_cast<clblast::Triangle>(triangle),
+                                                  static_cast<clblast::Transpose>(a_transpose),
+                                                  static_cast<clblast::Diagonal>(diagonal),
+                                                  m, n,
+                                                  queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDtrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::TrmmWorkspaceSize<double>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Side>(side),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   static_cast<clblast::Transpose>(a_transpose),
+                                                   static_cast<clblast::Diagonal>(diagonal),
+                                                   m, n,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCtrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::TrmmWorkspaceSize<float2>(static_cast<clblast::Layout>(layout),
+                                                   static_cast<clblast::Side>(side),
+                                                   static_cast<clblast::Triangle>(triangle),
+                                                   static_cast<clblast::Transpose>(a_transpose),
+                                                   static_cast<clblast::Diagonal>(diagonal),
+                                                   m, n,
+                                                   queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZtrmmWorkspaceSize(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     cl_command_queue* queue, size_t* workspace_size) {
+  auto status = clblast::TrmmWorkspaceSize<double2>(static_cast<clblast::Layout>(layout),
+                                                    static_cast<clblast::Side>(side),
+                                                    static_cast<clblast::Triangle>(triangle),
+                                                    static_cast<clblast::Transpose>(a_transpose),
+                                                    static_cast<clblast::Diagonal>(diagonal),
+                                                    m, n,
+                                                    queue, workspace_size);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastStrmmWithWorkspace(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     const float alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Trmm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Diagonal>(diagonal),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDtrmmWithWorkspace(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     const double alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Trmm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Diagonal>(diagonal),
+                              m, n,
+                              alpha,
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCtrmmWithWorkspace(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     const cl_float2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Trmm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Diagonal>(diagonal),
+                              m, n,
+                              float2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZtrmmWithWorkspace(const Layout layout, const Side side, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                                     const size_t m, const size_t n,
+                                     const cl_double2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     cl_mem workspace, const size_t workspace_size,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::Trmm(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Side>(side),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Transpose>(a_transpose),
+                              static_cast<clblast::Diagonal>(diagonal),
+                              m, n,
+                              double2{alpha.s[0], alpha.s[1]},
+                              a_buffer, a_offset, a_ld,
+                              b_buffer, b_offset, b_ld,
+                              workspace, workspace_size,
+                              queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// =================================================================================================
+
+// Grouped version of GEMM
+StatusCode CLBlastSgemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t group_count, const cl_mem problems_buffer,
+                                      const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                                      const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmGroupedBatched<float>(static_cast<clblast::Layout>(layout),
+                                                static_cast<clblast::Transpose>(a_transpose),
+                                                static_cast<clblast::Transpose>(b_transpose),
+                                                group_count, problems_buffer,
+                                                alphas_buffer, betas_buffer,
+                                                a_buffer, b_buffer, c_buffer,
+                                                queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDgemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t group_count, const cl_mem problems_buffer,
+                                      const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                                      const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmGroupedBatched<double>(static_cast<clblast::Layout>(layout),
+                                                static_cast<clblast::Transpose>(a_transpose),
+                                                static_cast<clblast::Transpose>(b_transpose),
+                                                group_count, problems_buffer,
+                                                alphas_buffer, betas_buffer,
+                                                a_buffer, b_buffer, c_buffer,
+                                                queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastCgemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t group_count, const cl_mem problems_buffer,
+                                      const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                                      const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmGroupedBatched<float2>(static_cast<clblast::Layout>(layout),
+                                                static_cast<clblast::Transpose>(a_transpose),
+                                                static_cast<clblast::Transpose>(b_transpose),
+                                                group_count, problems_buffer,
+                                                alphas_buffer, betas_buffer,
+                                                a_buffer, b_buffer, c_buffer,
+                                                queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastZgemmGroupedBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t group_count, const cl_mem problems_buffer,
+                                      const cl_mem alphas_buffer, const cl_mem betas_buffer,
+                                      const cl_mem a_buffer, const cl_mem b_buffer, cl_mem c_buffer,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmGroupedBatched<double2>(static_cast<clblast::Layout>(layout),
+                                                static_cast<clblast::Transpose>(a_transpose),
+                                                static_cast<clblast::Transpose>(b_transpose),
+                                                group_count, problems_buffer,
+                                                alphas_buffer, betas_buffer,
+                                                a_buffer, b_buffer, c_buffer,
+                                                queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// Mixed-precision version of GEMM
+StatusCode CLBlastGemmMixed(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const float alpha,
+                            const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                            const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                            const float beta,
+                            cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                            cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmMixed(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Transpose>(b_transpose),
+                                   m, n, k,
+                                   alpha,
+                                   a_buffer, a_offset, a_ld,
+                                   b_buffer, b_offset, b_ld,
+                                   beta,
+                                   c_buffer, c_offset, c_ld,
+                                   queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// Conversions between single-precision and half-precision on the device
+StatusCode CLBlastConvertFloatToHalf(const size_t n,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::ConvertFloatToHalf(n,
+                                            x_buffer, x_offset, x_inc,
+                                            y_buffer, y_offset, y_inc,
+                                            queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastConvertHalfToFloat(const size_t n,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::ConvertHalfToFloat(n,
+                                            x_buffer, x_offset, x_inc,
+                                            y_buffer, y_offset, y_inc,
+                                            queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// GEMM with a bias, activation, and scaling epilogue applied when storing the result
+StatusCode CLBlastSgemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const float alpha,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                const float beta,
+                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                const Bias bias, const cl_mem bias_buffer, const size_t bias_offset,
+                                const Activation activation,
+                                const cl_mem row_scale_buffer, const size_t row_scale_offset,
+                                const cl_mem col_scale_buffer, const size_t col_scale_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmEpilogue(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      static_cast<clblast::Transpose>(b_transpose),
+                                      m, n, k,
+                                      alpha,
+                                      a_buffer, a_offset, a_ld,
+                                      b_buffer, b_offset, b_ld,
+                                      beta,
+                                      c_buffer, c_offset, c_ld,
+                                      static_cast<clblast::Bias>(bias), bias_buffer, bias_offset,
+                                      static_cast<clblast::Activation>(activation),
+                                      row_scale_buffer, row_scale_offset,
+                                      col_scale_buffer, col_scale_offset,
+                                      queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastDgemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const double alpha,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                const double beta,
+                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                const Bias bias, const cl_mem bias_buffer, const size_t bias_offset,
+                                const Activation activation,
+                                const cl_mem row_scale_buffer, const size_t row_scale_offset,
+                                const cl_mem col_scale_buffer, const size_t col_scale_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmEpilogue(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      static_cast<clblast::Transpose>(b_transpose),
+                                      m, n, k,
+                                      alpha,
+                                      a_buffer, a_offset, a_ld,
+                                      b_buffer, b_offset, b_ld,
+                                      beta,
+                                      c_buffer, c_offset, c_ld,
+                                      static_cast<clblast::Bias>(bias), bias_buffer, bias_offset,
+                                      static_cast<clblast::Activation>(activation),
+                                      row_scale_buffer, row_scale_offset,
+                                      col_scale_buffer, col_scale_offset,
+                                      queue, event);
+  return static_cast<StatusCode>(status);
+}
+StatusCode CLBlastHgemmEpilogue(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const cl_half alpha,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                const cl_half beta,
+                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                const Bias bias, const cl_mem bias_buffer, const size_t bias_offset,
+                                const Activation activation,
+                                const cl_mem row_scale_buffer, const size_t row_scale_offset,
+                                const cl_mem col_scale_buffer, const size_t col_scale_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  auto status = clblast::GemmEpilogue(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      static_cast<clblast::Transpose>(b_transpose),
+                                      m, n, k,
+                                      alpha,
+                                      a_buffer, a_offset, a_ld,
+                                      b_buffer, b_offset, b_ld,
+                                      beta,
+                                      c_buffer, c_offset, c_ld,
+                                      static_cast<clblast::Bias>(bias), bias_buffer, bias_offset,
+                                      static_cast<clblast::Activation>(activation),
+                                      row_scale_buffer, row_scale_offset,
+                                      col_scale_buffer, col_scale_offset,
+                                      queue, event);
+  return static_cast<StatusCode>(status);
+}
+
+// =================================================================================================
+
+// Clears the cache of stored binaries
+StatusCode CLBlastClearCache() {
+  return static_cast<StatusCode>(clblast::ClearCache());
+}
+
+// Fills the cache with binaries for a specific device
+StatusCode CLBlastFillCache(const cl_device_id device) {
+  return static_cast<StatusCode>(clblast::FillCache(device));
+}
+
+// Fills the cache with binaries of a selection of routines for a specific device
+StatusCode CLBlastFillCacheSelection(const cl_device_id device, const char* routines,
+                                     const size_t num_threads) {
+  return static_cast<StatusCode>(clblast::FillCache(device, routines, num_threads));
+}
+
+// As above, but returns immediately and fills the cache in the background
+StatusCode CLBlastFillCacheAsync(const cl_device_id device, const char* routines,
+                                 const size_t num_threads) {
+  return static_cast<StatusCode>(clblast::FillCacheAsync(device, routines, num_threads));
+}
+
+// Sets the directory of the on-disk cache of binaries
+StatusCode CLBlastSetCacheDirectory(const char* directory) {
+  return static_cast<StatusCode>(clblast::SetCacheDirectory(directory));
+}
+
+// Sets the limits of the cache
+StatusCode CLBlastSetCacheLimits(const size_t max_binary_bytes, const size_t max_programs) {
+  return static_cast<StatusCode>(clblast::SetCacheLimits(max_binary_bytes, max_programs));
+}
+
+// Removes all programs of a specific context from the cache
+StatusCode CLBlastClearCacheForContext(const cl_context context) {
+  return static_cast<StatusCode>(clblast::ClearCacheForContext(context));
+}
+
+// Retrieves statistics about the usage of the cache
+StatusCode CLBlastGetCacheStatistics(CLBlastCacheStatistics* statistics) {
+  if (statistics == nullptr) { return kSuccess; }
+  auto cache_statistics = clblast::CacheStatistics();
+  const auto status = clblast::GetCacheStatistics(&cache_statistics);
+  statistics->program_hits = cache_statistics.program_hits;
+  statistics->program_misses = cache_statistics.program_misses;
+  statistics->compilations = cache_statistics.compilations;
+  statistics->compilation_time_ms = cache_statistics.compilation_time_ms;
+  statistics->num_binaries = cache_statistics.num_binaries;
+  statistics->binary_bytes = cache_statistics.binary_bytes;
+  statistics->num_programs = cache_statistics.num_programs;
+  statistics->evictions = cache_statistics.evictions;
+  return static_cast<StatusCode>(status);
+}
+
+// Exports the binaries of a specific device into a blob
+StatusCode CLBlastExportCache(const cl_device_id device, char* blob, size_t* blob_size) {
+  return static_cast<StatusCode>(clblast::ExportCache(device, blob, blob_size));
+}
+
+// Imports the binaries from a blob for a specific device
+StatusCode CLBlastImportCache(const cl_device_id device, const char* blob,
+                              const size_t blob_size) {
+  return static_cast<StatusCode>(clblast::ImportCache(device, blob, blob_size));
+}
+
+// =================================================================================================
+
+// Sets the path of the tuner output files overriding the built-in tuning parameters
+StatusCode CLBlastSetTuningParametersPath(const char* path) {
+  return static_cast<StatusCode>(clblast::SetTuningParametersPath(path));
+}
+
+// =================================================================================================
+
+// Sets the limit of the total size of the idle buffers in the pool
+StatusCode CLBlastSetBufferPoolLimit(const size_t max_idle_bytes) {
+  return static_cast<StatusCode>(clblast::SetBufferPoolLimit(max_idle_bytes));
+}
+
+// Releases the idle buffers of a specific context (or of all contexts)
+StatusCode CLBlastClearBufferPool(const cl_context context) {
+  return static_cast<StatusCode>(clblast::ClearBufferPool(context));
+}
+
+// Retrieves statistics about the usage of the buffer pool
+StatusCode CLBlastGetBufferPoolStatistics(CLBlastBufferPoolStatistics* statistics) {
+  if (statistics == nullptr) { return kSuccess; }
+  auto pool_statistics = clblast::BufferPoolStatistics();
+  const auto status = clblast::GetBufferPoolStatistics(&pool_statistics);
+  statistics->allocations = pool_statistics.allocations;
+  statistics->reuses = pool_statistics.reuses;
+  statistics->releases = pool_statistics.releases;
+  statistics->bytes_in_use = pool_statistics.bytes_in_use;
+  statistics->num_idle = pool_statistics.num_idle;
+  statistics->idle_bytes = pool_statistics.idle_bytes;
+  return static_cast<StatusCode>(status);
+}
+
+// Sets the memory budget for the temporary buffers of a context
+StatusCode CLBlastSetMemoryBudget(const cl_context context, const size_t max_bytes) {
+  return static_cast<StatusCode>(clblast::SetMemoryBudget(context, max_bytes));
+}
+
+// Sets the accuracy mode of the GEMM routines
+StatusCode CLBlastSetGemmAccuracy(const GemmAccuracy accuracy) {
+  return static_cast<StatusCode>(
+    clblast::SetGemmAccuracy(static_cast<clblast::GemmAccuracy>(accuracy))
+  );
+}
+
+// Sets the maximum depth of the Strassen-Winograd recursion of the GEMM routines
+StatusCode CLBlastSetGemmStrassenDepth(const size_t max_depth) {
+  return static_cast<StatusCode>(clblast::SetGemmStrassenDepth(max_depth));
+}
+
+// =================================================================================================
+
+// Creates a new handle for a specific queue
+StatusCode CLBlastCreateHandle(cl_command_queue* queue, CLBlastHandle* handle) {
+  return static_cast<StatusCode>(clblast::CreateHandle(queue,
+                                                       reinterpret_cast<clblast::Handle*>(handle)));
+}
+
+// Releases a handle
+StatusCode CLBlastReleaseHandle(CLBlastHandle handle) {
+  return static_cast<StatusCode>(clblast::ReleaseHandle(reinterpret_cast<clblast::Handle>(handle)));
 }
 
 // =================================================================================================
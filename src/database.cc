@@ -7,16 +7,30 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Database class (see the header for information about the class).
+// This file implements the Database class (see the header for information about the class). It also
+// implements the run-time overrides of the database, read from the JSON output files of the tuners.
 //
 // =================================================================================================
 
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <limits>
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <cstdlib>
+#include <algorithm>
+
 #include "internal/database.h"
 #include "internal/database/xaxpy.h"
 #include "internal/database/xdot.h"
 #include "internal/database/xgemv.h"
 #include "internal/database/xger.h"
 #include "internal/database/xgemm.h"
+#include "internal/database/xgemm_direct.h"
+#include "internal/database/xgemm_direct_batched.h"
+#include "internal/database/gemm_routine.h"
 #include "internal/database/copy.h"
 #include "internal/database/pad.h"
 #include "internal/database/transpose.h"
@@ -29,35 +43,306 @@ namespace clblast {
 
 // Initializes the database
 const std::vector<Database::DatabaseEntry> Database::database = {
-  XaxpySingle, XaxpyDouble, XaxpyComplexSingle, XaxpyComplexDouble,
-  XdotSingle, XdotDouble, XdotComplexSingle, XdotComplexDouble,
-  XgemvSingle, XgemvDouble, XgemvComplexSingle, XgemvComplexDouble,
-  XgerSingle, XgerDouble, XgerComplexSingle, XgerComplexDouble,
-  XgemmSingle, XgemmDouble, XgemmComplexSingle, XgemmComplexDouble,
-  CopySingle, CopyDouble, CopyComplexSingle, CopyComplexDouble,
-  PadSingle, PadDouble, PadComplexSingle, PadComplexDouble,
-  TransposeSingle, TransposeDouble, TransposeComplexSingle, TransposeComplexDouble,
-  PadtransposeSingle, PadtransposeDouble, PadtransposeComplexSingle, PadtransposeComplexDouble
+  XaxpyHalf, XaxpySingle, XaxpyDouble, XaxpyComplexSingle, XaxpyComplexDouble,
+  XdotHalf, XdotSingle, XdotDouble, XdotComplexSingle, XdotComplexDouble,
+  XgemvHalf, XgemvSingle, XgemvDouble, XgemvComplexSingle, XgemvComplexDouble,
+  XgerHalf, XgerSingle, XgerDouble, XgerComplexSingle, XgerComplexDouble,
+  XgemmHalf, XgemmSingle, XgemmDouble, XgemmComplexSingle, XgemmComplexDouble,
+  XgemmDirectHalf, XgemmDirectSingle, XgemmDirectDouble,
+  XgemmDirectComplexSingle, XgemmDirectComplexDouble,
+  XgemmDirectBatchedHalf, XgemmDirectBatchedSingle, XgemmDirectBatchedDouble,
+  XgemmDirectBatchedComplexSingle, XgemmDirectBatchedComplexDouble,
+  GemmRoutineHalf, GemmRoutineSingle, GemmRoutineDouble,
+  GemmRoutineComplexSingle, GemmRoutineComplexDouble,
+  CopyHalf, CopySingle, CopyDouble, CopyComplexSingle, CopyComplexDouble,
+  PadHalf, PadSingle, PadDouble, PadComplexSingle, PadComplexDouble,
+  TransposeHalf, TransposeSingle, TransposeDouble, TransposeComplexSingle, TransposeComplexDouble,
+  PadtransposeHalf, PadtransposeSingle, PadtransposeDouble,
+  PadtransposeComplexSingle, PadtransposeComplexDouble
 };
 
+// The maximum size of a size-specific entry which applies to all sizes
+constexpr size_t Database::kSizeUnbounded;
+
+// Alternative names for some OpenCL vendors
+const std::unordered_map<std::string,std::string> Database::kVendorNames {
+  {"Intel(R) Corporation", "Intel"},
+  {"GenuineIntel", "Intel"},
+  {"Advanced Micro Devices, Inc.", "AMD"},
+  {"NVIDIA Corporation", "NVIDIA"},
+};
+
+// The names of the parameters, in the same order as the 'DatabaseParameter' keys
+const std::array<std::string,kNumDatabaseParameters> Database::kParameterNames {{
+  "COPY_DIMX", "COPY_DIMY", "COPY_VW", "COPY_WPT",
+  "DBUF", "KWG", "KWI", "MDIMA", "MDIMC", "MWG", "NDIMB", "NDIMC", "NWG", "SA", "SB", "STRM",
+  "STRN", "VWM", "VWN",
+  "KWID", "MDIMAD", "MDIMCD", "NDIMBD", "NDIMCD", "PADA", "PADB", "WGD",
+  "PADTRA_PAD", "PADTRA_TILE", "PADTRA_WPT",
+  "PAD_DIMX", "PAD_DIMY", "PAD_WPTX", "PAD_WPTY",
+  "TRA_DIM", "TRA_PAD", "TRA_SHUFFLE", "TRA_WPT",
+  "VW", "VW2", "VW3", "WGS", "WGS1", "WGS2", "WGS3", "WPT", "WPT1", "WPT2", "WPT3",
+  "XGEMM_MIN_INDIRECT_SIZE", "XGEMM_SPLITK_MIN_K", "XGEMM_SPLITK_RATIO",
+  "XGEMM_MIN_3M_SIZE", "XGEMM_MIN_STRASSEN_SIZE"
+}};
+
+// The index of search results: the found parameters per device, kernel, and precision. Devices are
+// thus only searched for once, after which finding their parameters is a single look-up.
+using DatabaseIndexKey = std::tuple<cl_device_id, std::string, Precision>;
+static std::map<DatabaseIndexKey, Database::DatabaseDevice> database_index_;
+static std::mutex database_index_mutex_;
+
+// The run-time overrides of the database: the best-found parameters of the tuner output files, per
+// device name, kernel, and precision. These are loaded on first use from the given path.
+using OverrideKey = std::tuple<std::string, std::string, Precision>;
+using Overrides = std::map<OverrideKey, Database::Parameters>;
+static Overrides overrides_;
+static std::string overrides_path_;
+static bool overrides_initialized_ = false;
+static bool overrides_loaded_ = false;
+static std::mutex overrides_mutex_;
+
+// =================================================================================================
+
+// The tuner output files which are looked for in a directory, named as by the tuners themselves:
+// 'clblast_<family>_<precision>.json'
+static const std::vector<std::string> kTunerFamilies = {
+  "xaxpy", "xdot_1", "xdot_2", "xgemv_1", "xgemv_2", "xgemv_3", "xger", "xgemm", "xgemm_direct",
+  "xgemm_direct_batched", "copy", "pad", "transpose", "padtranspose"
+};
+static const std::vector<std::string> kTunerPrecisions = {"16", "32", "64", "3232", "6464"};
+
+// The problem size (m, n, and k) at which the Xgemm kernel is tuned by default. Tuner output for
+// other sizes is ignored, since it holds the parameters of a size-specific entry instead.
+static const std::string kXgemmTunerDefaultSize = "1024";
+
+// Skips white-space in a JSON text
+static void SkipJsonWhitespace(const std::string &text, size_t &pos) {
+  while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) { ++pos; }
+}
+
+// Parses a JSON string. Unicode escape sequences are not needed for the tuner output and are
+// replaced by a question mark.
+static bool ParseJsonString(const std::string &text, size_t &pos, std::string &value) {
+  if (pos >= text.size() || text[pos] != '"') { return false; }
+  value.clear();
+  for (++pos; pos < text.size(); ++pos) {
+    if (text[pos] == '"') { ++pos; return true; }
+    if (text[pos] != '\\') { value += text[pos]; continue; }
+    if (++pos == text.size()) { return false; }
+    switch (text[pos]) {
+      case 'b': value += '\b'; break;
+      case 'f': value += '\f'; break;
+      case 'n': value += '\n'; break;
+      case 'r': value += '\r'; break;
+      case 't': value += '\t'; break;
+      case 'u': value += '?'; pos += 4; break;
+      default: value += text[pos]; break;
+    }
+  }
+  return false;
+}
+
+// Parses a JSON value. Rather than building a tree, all leaf values (strings, numbers, booleans) are
+// stored under their path, e.g. 'results/0/parameters/MWG'. Returns false if the text is invalid.
+static bool ParseJson(const std::string &text, size_t &pos, const std::string &path,
+                      std::map<std::string,std::string> &leaves) {
+  SkipJsonWhitespace(text, pos);
+  if (pos >= text.size()) { return false; }
+
+  // Objects and arrays: their members are stored under their key or index respectively
+  if (text[pos] == '{' || text[pos] == '[') {
+    const auto is_object = (text[pos] == '{');
+    const auto closing = (is_object) ? '}' : ']';
+    const auto prefix = (path.empty()) ? path : path + "/";
+    ++pos;
+    SkipJsonWhitespace(text, pos);
+    if (pos < text.size() && text[pos] == closing) { ++pos; return true; }
+    for (auto index = size_t{0}; ; ++index) {
+      auto key = ToString(index);
+      if (is_object) {
+        SkipJsonWhitespace(text, pos);
+        if (!ParseJsonString(text, pos, key)) { return false; }
+        SkipJsonWhitespace(text, pos);
+        if (pos >= text.size() || text[pos] != ':') { return false; }
+        ++pos;
+      }
+      if (!ParseJson(text, pos, prefix + key, leaves)) { return false; }
+      SkipJsonWhitespace(text, pos);
+      if (pos >= text.size()) { return false; }
+      if (text[pos] == closing) { ++pos; return true; }
+      if (text[pos] != ',') { return false; }
+      ++pos;
+    }
+  }
+
+  // Strings
+  if (text[pos] == '"') { return ParseJsonString(text, pos, leaves[path]); }
+
+  // Numbers, booleans, and null: stored as they are written
+  const auto end = std::min(text.find_first_of(",}] \t\r\n", pos), text.size());
+  if (end == pos) { return false; }
+  leaves[path] = text.substr(pos, end - pos);
+  pos = end;
+  return true;
+}
+
+// Converts a string to an unsigned integer, returning false if it isn't a (reasonably sized) one
+static bool ParseUnsigned(const std::string &text, size_t &value) {
+  if (text.empty() || text.size() > 9) { return false; }
+  if (text.find_first_not_of("0123456789") != std::string::npos) { return false; }
+  value = static_cast<size_t>(std::stoul(text));
+  return true;
+}
+
+// Loads a tuner output file and adds its best-found (i.e. fastest) parameters to the overrides.
+// Results with unknown or non-integer parameters are skipped. Returns false if the file could not
+// be read or is not a tuner output file.
+static bool LoadOverridesFile(const std::string &file_name, Overrides &overrides) {
+  std::ifstream file(file_name);
+  if (!file.is_open()) { return false; }
+  std::stringstream contents;
+  contents << file.rdbuf();
+  auto leaves = std::map<std::string,std::string>();
+  auto pos = size_t{0};
+  if (!ParseJson(contents.str(), pos, "", leaves)) { return false; }
+
+  // Retrieves the meta-data. The kernel's name in the database is its family name without the
+  // index of the tuner (e.g. 'xdot_2') in camel-case, e.g. 'Xdot' or 'XgemmDirect'.
+  const auto family = leaves.find("kernel_family");
+  const auto precision = leaves.find("precision");
+  const auto device_name = leaves.find("device");
+  if (family == leaves.end() || precision == leaves.end() || device_name == leaves.end()) {
+    return false;
+  }
+  auto kernel = std::string{};
+  auto capitalize = true;
+  for (const auto character: family->second) {
+    const auto c = static_cast<unsigned char>(character);
+    if (c == '_') { capitalize = true; continue; }
+    if (capitalize && std::isdigit(c)) { break; }
+    kernel += static_cast<char>((capitalize) ? std::toupper(c) : c);
+    capitalize = false;
+  }
+  auto precision_value = size_t{0};
+  if (kernel.empty() || !ParseUnsigned(precision->second, precision_value)) { return false; }
+  if (kernel == "Xgemm") {
+    for (const auto &argument: {"arg_m", "arg_n", "arg_k"}) {
+      const auto size = leaves.find(argument);
+      if (size != leaves.end() && size->second != kXgemmTunerDefaultSize) { return false; }
+    }
+  }
+
+  // Selects the fastest of the results
+  auto best_time = std::numeric_limits<double>::max();
+  auto best_parameters = Database::Parameters();
+  for (auto index = size_t{0}; ; ++index) {
+    const auto result = "results/" + ToString(index) + "/";
+    const auto time = leaves.find(result + "time");
+    if (time == leaves.end()) { break; }
+    auto time_ms = 0.0;
+    if (!(std::istringstream(time->second) >> time_ms) || time_ms >= best_time) { continue; }
+
+    // Collects the parameters of this result, except for the precision
+    const auto prefix = result + "parameters/";
+    auto parameters = Database::Parameters();
+    auto valid = true;
+    for (auto leaf = leaves.lower_bound(prefix);
+         leaf != leaves.end() && leaf->first.compare(0, prefix.size(), prefix) == 0; ++leaf) {
+      const auto name = leaf->first.substr(prefix.size());
+      if (name == "PRECISION") { continue; }
+      const auto &names = Database::kParameterNames;
+      const auto key = std::find(names.begin(), names.end(), name);
+      auto value = size_t{0};
+      if (key == names.end() || !ParseUnsigned(leaf->second, value)) { valid = false; break; }
+      parameters.push_back({static_cast<DatabaseParameter>(key - names.begin()), value});
+    }
+    if (!valid || parameters.empty()) { continue; }
+    best_time = time_ms;
+    best_parameters = parameters;
+  }
+  if (best_parameters.empty()) { return false; }
+
+  // Adds the parameters, merging them with those of other files of the same kernel (e.g. 'xdot_1'
+  // and 'xdot_2' together form the parameters of 'Xdot')
+  const auto key = OverrideKey{device_name->second, kernel,
+                               static_cast<Precision>(precision_value)};
+  auto &entry = overrides[key];
+  for (const auto &parameter: best_parameters) {
+    const auto matches = [&](const std::pair<DatabaseParameter,size_t> &existing) {
+      return existing.first == parameter.first;
+    };
+    const auto existing = std::find_if(entry.begin(), entry.end(), matches);
+    if (existing != entry.end()) { existing->second = parameter.second; }
+    else { entry.push_back(parameter); }
+  }
+  return true;
+}
+
+// Loads the overrides from the configured path (or from the environmental variable) if not done so
+// before. The path is either a single tuner output file, or a directory with tuner output files.
+// Should be called with the overrides mutex held.
+static void LoadOverrides() {
+  if (!overrides_initialized_) {
+    const auto environment = std::getenv("CLBLAST_TUNING_PATH");
+    if (environment != nullptr) { overrides_path_ = std::string{environment}; }
+    overrides_initialized_ = true;
+  }
+  if (overrides_loaded_) { return; }
+  overrides_loaded_ = true;
+  if (overrides_path_.empty()) { return; }
+  if (LoadOverridesFile(overrides_path_, overrides_)) { return; }
+  auto directory = overrides_path_;
+  if (directory.back() != '/' && directory.back() != '\\') { directory += "/"; }
+  for (const auto &family: kTunerFamilies) {
+    for (const auto &precision: kTunerPrecisions) {
+      LoadOverridesFile(directory + "clblast_" + family + "_" + precision + ".json", overrides_);
+    }
+  }
+}
+
+// Sets the path of the overrides. The index is cleared, such that all devices are searched again.
+void Database::SetOverridesPath(const std::string &path) {
+  {
+    std::lock_guard<std::mutex> lock(overrides_mutex_);
+    overrides_.clear();
+    overrides_path_ = path;
+    overrides_initialized_ = true;
+    overrides_loaded_ = false;
+  }
+  std::lock_guard<std::mutex> lock(database_index_mutex_);
+  database_index_.clear();
+}
+
 // =================================================================================================
 
-// Constructor, computing device properties and populating the parameter-vector from the database
+// Constructor, populating the parameter-array with the (pre-searched) entries from the database
 Database::Database(const Queue &queue, const std::vector<std::string> &kernels,
                    const Precision precision):
-  parameters_{} {
-
-  // Finds information of the current device
-  auto device = queue.GetDevice();
-  auto device_type = device.Type();
-  auto device_vendor = device.Vendor();
-  auto device_name = device.Name();
+  values_(), regular_values_(), found_(), size_entries_(), selected_size_entry_(0) {
+  const auto device = queue.GetDevice();
 
-  // Iterates over all kernels to include, and retrieves the parameters for each of them
+  // Iterates over all kernels to include, and retrieves the parameters for each of them. These are
+  // searched for only if they are not yet in the index.
   for (auto &kernel: kernels) {
-    auto search_result = Search(kernel, device_type, device_vendor, device_name, precision);
-    parameters_.insert(search_result.begin(), search_result.end());
+    const auto key = DatabaseIndexKey{device(), kernel, precision};
+    std::unique_lock<std::mutex> lock(database_index_mutex_);
+    auto entry = database_index_.find(key);
+    if (entry == database_index_.end()) {
+      lock.unlock(); // searching queries the device and might load the overrides from disk
+      auto found = Find(device, kernel, precision);
+      lock.lock();
+      entry = database_index_.insert({key, std::move(found)}).first;
+    }
+    for (const auto &parameter: entry->second.parameters) {
+      values_[parameter.first] = parameter.second;
+      found_.set(parameter.first);
+    }
+    for (const auto &size_entry: entry->second.size_entries) {
+      size_entries_.push_back(size_entry);
+    }
   }
+  regular_values_ = values_;
 }
 
 // =================================================================================================
@@ -65,20 +350,72 @@ Database::Database(const Queue &queue, const std::vector<std::string> &kernels,
 // Returns a list of OpenCL pre-processor defines in string form
 std::string Database::GetDefines() const {
   std::string defines{};
-  for (auto &parameter: parameters_) {
-    defines += "#define "+parameter.first+" "+ToString(parameter.second)+"\n";
+  for (auto key = size_t{0}; key < kNumDatabaseParameters; ++key) {
+    if (!found_.test(key)) { continue; }
+    defines += "#define "+kParameterNames[key]+" "+ToString(values_[key])+"\n";
   }
   return defines;
 }
 
+// Selects the parameters of the first size-specific entry matching the problem size, if any
+size_t Database::SelectProblemSize(const size_t m, const size_t n, const size_t k) {
+  auto selected = size_t{0};
+  for (auto i = size_t{0}; i < size_entries_.size(); ++i) {
+    const auto &size_entry = size_entries_[i];
+    if (m <= size_entry.max_m && n <= size_entry.max_n && k <= size_entry.max_k) {
+      selected = i + 1;
+      break;
+    }
+  }
+  SelectSizeEntry(selected);
+  return selected;
+}
+
+// Selects the parameters by the identifier returned by 'SelectProblemSize'
+void Database::SelectSizeEntry(const size_t selected) {
+  if (selected == selected_size_entry_) { return; }
+
+  // Sets the values: the regular ones, replaced by those of the size-specific entry (if any)
+  values_ = regular_values_;
+  if (selected != 0) {
+    for (const auto &parameter: size_entries_[selected - 1].parameters) {
+      values_[parameter.first] = parameter.second;
+    }
+  }
+  selected_size_entry_ = selected;
+}
+
 // =================================================================================================
 
+// Finds the entry of a device: with the parameters of the run-time overrides if these are available
+// and complete (i.e. they provide exactly the same parameters), or otherwise with those of the
+// database. Size-specific entries are always those of the database.
+Database::DatabaseDevice Database::Find(const Device &device, const std::string &this_kernel,
+                                        const Precision this_precision) {
+  const auto device_name = device.Name();
+  const auto &found = Search(this_kernel, device.Type(), device.Vendor(), device_name,
+                             this_precision);
+  const auto &parameters = found.parameters;
+
+  std::lock_guard<std::mutex> lock(overrides_mutex_);
+  LoadOverrides();
+  const auto entry = overrides_.find(OverrideKey{device_name, this_kernel, this_precision});
+  if (entry == overrides_.end() || entry->second.size() != parameters.size()) { return found; }
+  for (const auto &parameter: parameters) {
+    const auto matches = [&](const std::pair<DatabaseParameter,size_t> &override) {
+      return override.first == parameter.first;
+    };
+    if (std::none_of(entry->second.begin(), entry->second.end(), matches)) { return found; }
+  }
+  return DatabaseDevice(found.name, entry->second, found.size_entries);
+}
+
 // Searches the database for the right kernel and precision
-Database::Parameters Database::Search(const std::string &this_kernel,
-                                      const std::string &this_type,
-                                      const std::string &this_vendor,
-                                      const std::string &this_device,
-                                      const Precision this_precision) const {
+const Database::DatabaseDevice& Database::Search(const std::string &this_kernel,
+                                                 const std::string &this_type,
+                                                 const std::string &this_vendor,
+                                                 const std::string &this_device,
+                                                 const Precision this_precision) {
   // Set the short vendor name
   auto this_short_vendor = this_vendor;
   for (auto &combination : kVendorNames) {
@@ -104,7 +441,7 @@ Database::Parameters Database::Search(const std::string &this_kernel,
             if (device.name == this_device || device.name == "default") {
 
               // Sets the parameters accordingly
-              return device.parameters;
+              return device;
             }
           }
         }
@@ -13,6 +13,8 @@
 
 #include <string>
 #include <vector>
+#include <cctype>
+#include <chrono>
 
 #include "internal/routine.h"
 
@@ -33,7 +35,11 @@ Routine<T>::Routine(Queue &queue, EventPointer event, const std::string &name,
     max_work_item_dimensions_(device_.MaxWorkItemDimensions()),
     max_work_item_sizes_(device_.MaxWorkItemSizes()),
     max_work_group_size_(device_.MaxWorkGroupSize()),
-    db_(queue_, routines, precision_) {
+    db_(queue_, routines, precision_),
+    problem_size_id_(0),
+    workspace_(nullptr),
+    workspace_size_(0),
+    workspace_offset_(0) {
 }
 
 // =================================================================================================
@@ -41,25 +47,115 @@ Routine<T>::Routine(Queue &queue, EventPointer event, const std::string &name,
 // Separate set-up function to allow for status codes to be returned
 template <typename T>
 StatusCode Routine<T>::SetUp() {
+  return SetUpProgram(routine_name_, source_string_, program_);
+}
 
-  // Queries the cache to see whether or not the program (context-specific) is already there
-  if (ProgramIsInCache()) { return StatusCode::kSuccess; }
+// Sets-up all the separately compiled programs, e.g. when filling the cache
+template <typename T>
+StatusCode Routine<T>::SetUpSubPrograms() {
+  for (const auto &sub_program_source: sub_program_sources_) {
+    auto program = std::shared_ptr<Program>();
+    auto status = SetUpSubProgram(sub_program_source.first, program);
+    if (ErrorIn(status)) { return status; }
+  }
+  return StatusCode::kSuccess;
+}
 
-  // Queries the cache to see whether or not the binary (device-specific) is already there. If it
-  // is, a program is created and stored in the cache
-  if (BinaryIsInCache()) {
-    try {
-      auto& binary = cache::GetBinaryFromCache(device_name_, precision_, routine_name_);
-      auto program = Program(device_, context_, binary);
-      auto options = std::vector<std::string>();
-      program.Build(device_, options);
-      StoreProgramToCache(program);
-    } catch (...) { return StatusCode::kBuildProgramFailure; }
+// Sets-up one of the separately compiled programs, unless it was already set-up before
+template <typename T>
+StatusCode Routine<T>::SetUpSubProgram(const std::string &name, std::shared_ptr<Program> &program) {
+  auto &sub_program = sub_programs_[name];
+  if (!sub_program) {
+    const auto source = sub_program_sources_.find(name);
+    if (source == sub_program_sources_.end()) { return StatusCode::kInvalidKernel; }
+    auto status = SetUpProgram(routine_name_ + "_" + name, source->second, sub_program);
+    if (ErrorIn(status)) { return status; }
+  }
+  program = sub_program;
+  return StatusCode::kSuccess;
+}
+
+// Sets the workspace for the next call. Sub-buffers are carved out of it starting at its beginning.
+template <typename T>
+void Routine<T>::SetWorkspace(const cl_mem workspace, const size_t workspace_size) {
+  workspace_ = workspace;
+  workspace_size_ = workspace_size;
+  workspace_offset_ = 0;
+}
+
+// Retrieves a temporary buffer. A sub-buffer of the workspace is released once it is no longer
+// used, which does not affect the workspace itself.
+template <typename T>
+Buffer<T> Routine<T>::GetTempBuffer(const size_t size) {
+  if (workspace_ == nullptr) { return pool::GetBuffer<T>(context_, queue_, size); }
+  const auto bytes = WorkspaceBytes(size);
+  if (workspace_offset_ + bytes > workspace_size_) { Error("workspace is too small"); }
+  const auto region = cl_buffer_region{workspace_offset_, size*sizeof(T)};
+  auto status = CL_SUCCESS;
+  const auto sub_buffer = clCreateSubBuffer(workspace_, CL_MEM_READ_WRITE,
+                                            CL_BUFFER_CREATE_TYPE_REGION, &region, &status);
+  CheckError(status);
+  workspace_offset_ += bytes;
+  return Buffer<T>(std::shared_ptr<cl_mem>(new cl_mem(sub_buffer), [](cl_mem* m) {
+    CheckError(clReleaseMemObject(*m));
+    delete m;
+  }));
+}
+
+// Computes the size of a temporary buffer within the workspace, rounded up to the device's
+// alignment requirement for the origin of a sub-buffer
+template <typename T>
+size_t Routine<T>::WorkspaceBytes(const size_t size) const {
+  return Ceil(size*sizeof(T), device_.MemBaseAddrAlign());
+}
+
+// Selects the parameters for a problem size. Each set of size-specific parameters has its own
+// program, which is cached under the routine's name with a suffix. The separately compiled programs
+// are not affected, since the size-specific parameters are only those of the main kernel (Xgemm).
+// In case the program can't be set-up, the parameters of the current program are selected again.
+template <typename T>
+StatusCode Routine<T>::SetUpForProblemSize(const size_t m, const size_t n, const size_t k) {
+  const auto problem_size_id = db_.SelectProblemSize(m, n, k);
+  if (problem_size_id == problem_size_id_) { return StatusCode::kSuccess; }
+  const auto program_name = (problem_size_id == 0) ? routine_name_ :
+                            routine_name_ + "_SIZE" + ToString(problem_size_id);
+  const auto status = SetUpProgram(program_name, source_string_, program_);
+  if (ErrorIn(status)) {
+    db_.SelectSizeEntry(problem_size_id_);
+    return status;
+  }
+  problem_size_id_ = problem_size_id;
+  return StatusCode::kSuccess;
+}
+
+// Finds out whether a source refers to the define of a specific routine (e.g. 'ROUTINE_SYR'), not
+// counting defines which merely start with the same name (e.g. 'ROUTINE_SYR2K')
+static bool RefersToRoutineDefine(const std::string &source, const std::string &routine_name) {
+  const auto define = "ROUTINE_" + routine_name;
+  for (auto pos = source.find(define); pos != std::string::npos;
+       pos = source.find(define, pos + 1)) {
+    const auto end = pos + define.size();
+    if (end == source.size()) { return true; }
+    const auto next = source[end];
+    if (!std::isalnum(static_cast<unsigned char>(next)) && next != '_') { return true; }
+  }
+  return false;
+}
+
+// Retrieves a program from the cache or compiles it. Programs are content-addressed: they are
+// shared among all routines (and separately compiled programs) with exactly the same source code.
+// The program's name is used as an additional key for fast look-ups on subsequent calls.
+template <typename T>
+StatusCode Routine<T>::SetUpProgram(const std::string &program_name, const std::string &source,
+                                    std::shared_ptr<Program> &program_out) {
+
+  // Queries the cache to see whether or not the program (context-specific) is already there
+  if (cache::FindProgramInCache(context_, precision_, program_name, program_out)) {
     return StatusCode::kSuccess;
   }
 
-  // Otherwise, the kernel will be compiled and program will be built. Both the binary and the
-  // program will be added to the cache.
+  // Waits in case the binary is currently being compiled in the background (see 'FillCacheAsync')
+  cache::WaitForPendingBinary(device_name_, precision_, program_name);
 
   // Inspects whether or not cl_khr_fp64 is supported in case of double precision
   auto extensions = device_.Capabilities();
@@ -85,8 +181,12 @@ StatusCode Routine<T>::SetUp() {
   auto defines = db_.GetDefines();
   defines += "#define PRECISION "+ToString(static_cast<int>(precision_))+"\n";
 
-  // Adds the name of the routine as a define
-  defines += "#define ROUTINE_"+routine_name_+"\n";
+  // Adds the name of the routine as a define. This is only done if the kernel code actually refers
+  // to it, such that routines with otherwise identical kernels can share the compiled program.
+  if (RefersToRoutineDefine(common_header, routine_name_) ||
+      RefersToRoutineDefine(source, routine_name_)) {
+    defines += "#define ROUTINE_"+routine_name_+"\n";
+  }
 
   // Determines whether this is a specific device
   const auto isAMD = device_.Vendor() == "AMD" || device_.Vendor() == "Advanced Micro Devices, Inc.";
@@ -104,13 +204,70 @@ StatusCode Routine<T>::SetUp() {
   }
 
   // Combines everything together into a single source string
-  auto source_string = defines + common_header + source_string_;
+  auto source_string = defines + common_header + source;
+
+  // Stores a program in the cache, both content-addressed and under the program's name
+  const auto source_hash = cache::SourceHash(source_string);
+  auto store_program = [&](const Program &program) {
+    cache::StoreProgramToCache(program, context_, precision_, source_hash);
+    cache::StoreProgramToCache(program, context_, precision_, program_name);
+    program_out = std::make_shared<Program>(program);
+  };
+
+  // Queries the cache to see whether or not a program with the same source code was already
+  // compiled for this context, e.g. by another routine
+  auto shared_program = std::shared_ptr<Program>();
+  if (cache::FindProgramInCache(context_, precision_, source_hash, shared_program)) {
+    cache::StoreProgramToCache(*shared_program, context_, precision_, program_name);
+    program_out = shared_program;
+    return StatusCode::kSuccess;
+  }
+  cache::RecordProgramMiss();
+
+  // Queries the cache to see whether or not the binary (device-specific) is already there. If it
+  // is, a program is created and stored in the cache
+  if (cache::BinaryIsInCache(device_name_, precision_, source_hash)) {
+    try {
+      const auto binary = cache::GetBinaryFromCache(device_name_, precision_, source_hash);
+      auto program = Program(device_, context_, binary);
+      auto options = std::vector<std::string>();
+      program.Build(device_, options);
+      store_program(program);
+    } catch (...) { return StatusCode::kBuildProgramFailure; }
+    return StatusCode::kSuccess;
+  }
+
+  // Otherwise, the kernel will be compiled and program will be built. Both the binary and the
+  // program will be added to the cache.
+
+  // Queries the on-disk cache (if enabled) for a binary compiled from exactly this source for this
+  // device and driver. Stale or corrupt entries are rejected there; invalid binaries are rejected
+  // here by the build. In both cases the kernel is simply compiled from source below.
+  auto disk_cache_key = std::string{};
+  if (!cache::GetCacheDirectory().empty()) {
+    try {
+      disk_cache_key = cache::DiskCacheKey(device_, precision_, source_string);
+      auto binary = std::string{};
+      if (cache::LoadBinaryFromDisk(disk_cache_key, binary)) {
+        auto program = Program(device_, context_, binary);
+        auto options = std::vector<std::string>();
+        if (program.Build(device_, options) == BuildStatus::kSuccess) {
+          cache::StoreBinaryToCache(binary, device_name_, precision_, source_hash);
+          store_program(program);
+          return StatusCode::kSuccess;
+        }
+      }
+    } catch (...) { } // Falls back to compilation from source
+  }
 
   // Compiles the kernel
   try {
+    const auto start_time = std::chrono::steady_clock::now();
     auto program = Program(context_, source_string);
     auto options = std::vector<std::string>();
     auto build_status = program.Build(device_, options);
+    const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+    cache::RecordCompilation(std::chrono::duration<double,std::milli>(elapsed_time).count());
 
     // Checks for compiler crashes/errors/warnings
     if (build_status == BuildStatus::kError) {
@@ -122,8 +279,11 @@ StatusCode Routine<T>::SetUp() {
 
     // Store the compiled binary and program in the cache
     const auto binary = program.GetIR();
-    StoreBinaryToCache(binary);
-    StoreProgramToCache(program);
+    cache::StoreBinaryToCache(binary, device_name_, precision_, source_hash);
+    store_program(program);
+
+    // Also stores the binary on disk, overwriting any stale or corrupt entry
+    if (!disk_cache_key.empty()) { cache::StoreBinaryToDisk(disk_cache_key, binary); }
   } catch (...) { return StatusCode::kBuildProgramFailure; }
 
   // No errors, normal termination of this function
@@ -155,7 +315,7 @@ StatusCode Routine<T>::RunKernel(Kernel &kernel, std::vector<size_t> &global,
   }
 
   // Tests for local memory usage
-  auto local_mem_usage = kernel.LocalMemUsage(device_);
+  auto local_mem_usage = cache::GetLocalMemUsageFromCache(kernel, device_);
   if (!device_.IsLocalMemoryValid(local_mem_usage)) { return StatusCode::kInvalidLocalMemUsage; }
 
   // Launches the kernel (and checks for launch errors)
@@ -299,8 +459,7 @@ StatusCode Routine<T>::PadCopyTransposeMatrix(EventPointer event, std::vector<Ev
                                               const Buffer<T> &src,
                                               const size_t dest_one, const size_t dest_two,
                                               const size_t dest_ld, const size_t dest_offset,
-                                              const Buffer<T> &dest,
-                                              const Program &program, const bool do_pad,
+                                              const Buffer<T> &dest, const bool do_pad,
                                               const bool do_transpose, const bool do_conjugate,
                                               const bool upper, const bool lower,
                                               const bool diagonal_imag_zero) {
@@ -314,9 +473,9 @@ StatusCode Routine<T>::PadCopyTransposeMatrix(EventPointer event, std::vector<Ev
   auto kernel_name = std::string{};
   if (do_transpose) {
     if (use_fast_kernel &&
-        IsMultiple(src_ld, db_["TRA_WPT"]) &&
-        IsMultiple(src_one, db_["TRA_WPT"]*db_["TRA_WPT"]) &&
-        IsMultiple(src_two, db_["TRA_WPT"]*db_["TRA_WPT"])) {
+        IsMultiple(src_ld, db_[kTRA_WPT]) &&
+        IsMultiple(src_one, db_[kTRA_WPT]*db_[kTRA_WPT]) &&
+        IsMultiple(src_two, db_[kTRA_WPT]*db_[kTRA_WPT])) {
       kernel_name = "TransposeMatrix";
     }
     else {
@@ -326,9 +485,9 @@ StatusCode Routine<T>::PadCopyTransposeMatrix(EventPointer event, std::vector<Ev
   }
   else {
     if (use_fast_kernel &&
-        IsMultiple(src_ld, db_["COPY_VW"]) &&
-        IsMultiple(src_one, db_["COPY_VW"]*db_["COPY_DIMX"]) &&
-        IsMultiple(src_two, db_["COPY_WPT"]*db_["COPY_DIMY"])) {
+        IsMultiple(src_ld, db_[kCOPY_VW]) &&
+        IsMultiple(src_one, db_[kCOPY_VW]*db_[kCOPY_DIMX]) &&
+        IsMultiple(src_two, db_[kCOPY_WPT]*db_[kCOPY_DIMY])) {
       kernel_name = "CopyMatrix";
     }
     else {
@@ -337,9 +496,17 @@ StatusCode Routine<T>::PadCopyTransposeMatrix(EventPointer event, std::vector<Ev
     }
   }
 
+  // Retrieves the separately compiled program holding this kernel, compiling it if needed
+  const auto program_name = (kernel_name == "CopyMatrix") ? "Copy" :
+                            (kernel_name == "TransposeMatrix") ? "Transpose" :
+                            (do_transpose) ? "Padtranspose" : "Pad";
+  auto program = std::shared_ptr<Program>();
+  auto status = SetUpSubProgram(program_name, program);
+  if (ErrorIn(status)) { return status; }
+
   // Retrieves the kernel from the compiled binary
   try {
-    auto kernel = Kernel(program, kernel_name);
+    auto kernel = GetKernelFromCache(*program, kernel_name);
 
     // Sets the kernel arguments
     if (use_fast_kernel) {
@@ -370,32 +537,31 @@ StatusCode Routine<T>::PadCopyTransposeMatrix(EventPointer event, std::vector<Ev
 
     // Launches the kernel and returns the error code. Uses global and local thread sizes based on
     // parameters in the database.
-    auto status = StatusCode::kSuccess;
     if (do_transpose) {
       if (use_fast_kernel) {
-        auto global = std::vector<size_t>{dest_one / db_["TRA_WPT"],
-                                          dest_two / db_["TRA_WPT"]};
-        auto local = std::vector<size_t>{db_["TRA_DIM"], db_["TRA_DIM"]};
+        auto global = std::vector<size_t>{dest_one / db_[kTRA_WPT],
+                                          dest_two / db_[kTRA_WPT]};
+        auto local = std::vector<size_t>{db_[kTRA_DIM], db_[kTRA_DIM]};
         status = RunKernel(kernel, global, local, event, waitForEvents);
       }
       else {
-        auto global = std::vector<size_t>{Ceil(CeilDiv(dest_one, db_["PADTRA_WPT"]), db_["PADTRA_TILE"]),
-                                          Ceil(CeilDiv(dest_two, db_["PADTRA_WPT"]), db_["PADTRA_TILE"])};
-        auto local = std::vector<size_t>{db_["PADTRA_TILE"], db_["PADTRA_TILE"]};
+        auto global = std::vector<size_t>{Ceil(CeilDiv(dest_one, db_[kPADTRA_WPT]), db_[kPADTRA_TILE]),
+                                          Ceil(CeilDiv(dest_two, db_[kPADTRA_WPT]), db_[kPADTRA_TILE])};
+        auto local = std::vector<size_t>{db_[kPADTRA_TILE], db_[kPADTRA_TILE]};
         status = RunKernel(kernel, global, local, event, waitForEvents);
       }
     }
     else {
       if (use_fast_kernel) {
-        auto global = std::vector<size_t>{dest_one / db_["COPY_VW"],
-                                          dest_two / db_["COPY_WPT"]};
-        auto local = std::vector<size_t>{db_["COPY_DIMX"], db_["COPY_DIMY"]};
+        auto global = std::vector<size_t>{dest_one / db_[kCOPY_VW],
+                                          dest_two / db_[kCOPY_WPT]};
+        auto local = std::vector<size_t>{db_[kCOPY_DIMX], db_[kCOPY_DIMY]};
         status = RunKernel(kernel, global, local, event, waitForEvents);
       }
       else {
-        auto global = std::vector<size_t>{Ceil(CeilDiv(dest_one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                          Ceil(CeilDiv(dest_two, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-        auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+        auto global = std::vector<size_t>{Ceil(CeilDiv(dest_one, db_[kPAD_WPTX]), db_[kPAD_DIMX]),
+                                          Ceil(CeilDiv(dest_two, db_[kPAD_WPTY]), db_[kPAD_DIMY])};
+        auto local = std::vector<size_t>{db_[kPAD_DIMX], db_[kPAD_DIMY]};
         status = RunKernel(kernel, global, local, event, waitForEvents);
       }
     }
@@ -406,6 +572,7 @@ StatusCode Routine<T>::PadCopyTransposeMatrix(EventPointer event, std::vector<Ev
 // =================================================================================================
 
 // Compiles the templated class
+template class Routine<half>;
 template class Routine<float>;
 template class Routine<double>;
 template class Routine<float2>;
@@ -56,13 +56,13 @@ StatusCode Xamax<T>::DoAmax(const size_t n,
   // Retrieves the Xamax kernels from the compiled binary
   try {
     const auto program = GetProgramFromCache();
-    auto kernel1 = Kernel(program, "Xamax");
-    auto kernel2 = Kernel(program, "XamaxEpilogue");
+    auto kernel1 = GetKernelFromCache(program, "Xamax");
+    auto kernel2 = GetKernelFromCache(program, "XamaxEpilogue");
 
     // Creates the buffer for intermediate values
-    auto temp_size = 2*db_["WGS2"];
-    auto temp_buffer1 = Buffer<T>(context_, temp_size);
-    auto temp_buffer2 = Buffer<unsigned int>(context_, temp_size);
+    auto temp_size = 2*db_[kWGS2];
+    auto temp_buffer1 = pool::GetBuffer<T>(context_, queue_, temp_size);
+    auto temp_buffer2 = pool::GetBuffer<unsigned int>(context_, queue_, temp_size);
 
     // Sets the kernel arguments
     kernel1.SetArgument(0, static_cast<int>(n));
@@ -76,8 +76,8 @@ StatusCode Xamax<T>::DoAmax(const size_t n,
     auto eventWaitList = std::vector<Event>();
 
     // Launches the main kernel
-    auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
-    auto local1 = std::vector<size_t>{db_["WGS1"]};
+    auto global1 = std::vector<size_t>{db_[kWGS1]*temp_size};
+    auto local1 = std::vector<size_t>{db_[kWGS1]};
     auto kernelEvent = Event();
     status = RunKernel(kernel1, global1, local1, kernelEvent.pointer());
     if (ErrorIn(status)) { return status; }
@@ -90,8 +90,8 @@ StatusCode Xamax<T>::DoAmax(const size_t n,
     kernel2.SetArgument(3, static_cast<int>(imax_offset));
 
     // Launches the epilogue kernel
-    auto global2 = std::vector<size_t>{db_["WGS2"]};
-    auto local2 = std::vector<size_t>{db_["WGS2"]};
+    auto global2 = std::vector<size_t>{db_[kWGS2]};
+    auto local2 = std::vector<size_t>{db_[kWGS2]};
     status = RunKernel(kernel2, global2, local2, event_, eventWaitList);
     if (ErrorIn(status)) { return status; }
 
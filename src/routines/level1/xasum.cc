@@ -56,12 +56,12 @@ StatusCode Xasum<T>::DoAsum(const size_t n,
   // Retrieves the Xasum kernels from the compiled binary
   try {
     const auto program = GetProgramFromCache();
-    auto kernel1 = Kernel(program, "Xasum");
-    auto kernel2 = Kernel(program, "XasumEpilogue");
+    auto kernel1 = GetKernelFromCache(program, "Xasum");
+    auto kernel2 = GetKernelFromCache(program, "XasumEpilogue");
 
     // Creates the buffer for intermediate values
-    auto temp_size = 2*db_["WGS2"];
-    auto temp_buffer = Buffer<T>(context_, temp_size);
+    auto temp_size = 2*db_[kWGS2];
+    auto temp_buffer = pool::GetBuffer<T>(context_, queue_, temp_size);
 
     // Sets the kernel arguments
     kernel1.SetArgument(0, static_cast<int>(n));
@@ -74,8 +74,8 @@ StatusCode Xasum<T>::DoAsum(const size_t n,
     auto eventWaitList = std::vector<Event>();
 
     // Launches the main kernel
-    auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
-    auto local1 = std::vector<size_t>{db_["WGS1"]};
+    auto global1 = std::vector<size_t>{db_[kWGS1]*temp_size};
+    auto local1 = std::vector<size_t>{db_[kWGS1]};
     auto kernelEvent = Event();
     status = RunKernel(kernel1, global1, local1, kernelEvent.pointer());
     if (ErrorIn(status)) { return status; }
@@ -87,8 +87,8 @@ StatusCode Xasum<T>::DoAsum(const size_t n,
     kernel2.SetArgument(2, static_cast<int>(asum_offset));
 
     // Launches the epilogue kernel
-    auto global2 = std::vector<size_t>{db_["WGS2"]};
-    auto local2 = std::vector<size_t>{db_["WGS2"]};
+    auto global2 = std::vector<size_t>{db_[kWGS2]};
+    auto local2 = std::vector<size_t>{db_[kWGS2]};
     status = RunKernel(kernel2, global2, local2, event_, eventWaitList);
     if (ErrorIn(status)) { return status; }
 
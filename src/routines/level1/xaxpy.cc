@@ -20,6 +20,7 @@ namespace clblast {
 // =================================================================================================
 
 // Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xaxpy<half>::precision_ = Precision::kHalf;
 template <> const Precision Xaxpy<float>::precision_ = Precision::kSingle;
 template <> const Precision Xaxpy<double>::precision_ = Precision::kDouble;
 template <> const Precision Xaxpy<float2>::precision_ = Precision::kComplexSingle;
@@ -57,7 +58,7 @@ StatusCode Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
   // Determines whether or not the fast-version can be used
   bool use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
                          (y_offset == 0) && (y_inc == 1) &&
-                         IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+                         IsMultiple(n, db_[kWGS]*db_[kWPT]*db_[kVW]);
 
   // If possible, run the fast-version of the kernel
   auto kernel_name = (use_fast_kernel) ? "XaxpyFast" : "Xaxpy";
@@ -65,7 +66,7 @@ StatusCode Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
   // Retrieves the Xaxpy kernel from the compiled binary
   try {
     const auto program = GetProgramFromCache();
-    auto kernel = Kernel(program, kernel_name);
+    auto kernel = GetKernelFromCache(program, kernel_name);
 
     // Sets the kernel arguments
     if (use_fast_kernel) {
@@ -87,14 +88,14 @@ StatusCode Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
 
     // Launches the kernel
     if (use_fast_kernel) {
-      auto global = std::vector<size_t>{CeilDiv(n, db_["WPT"]*db_["VW"])};
-      auto local = std::vector<size_t>{db_["WGS"]};
+      auto global = std::vector<size_t>{CeilDiv(n, db_[kWPT]*db_[kVW])};
+      auto local = std::vector<size_t>{db_[kWGS]};
       status = RunKernel(kernel, global, local, event_);
     }
     else {
-      auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
-      auto global = std::vector<size_t>{n_ceiled/db_["WPT"]};
-      auto local = std::vector<size_t>{db_["WGS"]};
+      auto n_ceiled = Ceil(n, db_[kWGS]*db_[kWPT]);
+      auto global = std::vector<size_t>{n_ceiled/db_[kWPT]};
+      auto local = std::vector<size_t>{db_[kWGS]};
       status = RunKernel(kernel, global, local, event_);
     }
     if (ErrorIn(status)) { return status; }
@@ -107,6 +108,7 @@ StatusCode Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
 // =================================================================================================
 
 // Compiles the templated class
+template class Xaxpy<half>;
 template class Xaxpy<float>;
 template class Xaxpy<double>;
 template class Xaxpy<float2>;
@@ -20,6 +20,7 @@ namespace clblast {
 // =================================================================================================
 
 // Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xdot<half>::precision_ = Precision::kHalf;
 template <> const Precision Xdot<float>::precision_ = Precision::kSingle;
 template <> const Precision Xdot<double>::precision_ = Precision::kDouble;
 template <> const Precision Xdot<float2>::precision_ = Precision::kComplexSingle;
@@ -60,12 +61,12 @@ StatusCode Xdot<T>::DoDot(const size_t n,
   // Retrieves the Xdot kernels from the compiled binary
   try {
     const auto program = GetProgramFromCache();
-    auto kernel1 = Kernel(program, "Xdot");
-    auto kernel2 = Kernel(program, "XdotEpilogue");
+    auto kernel1 = GetKernelFromCache(program, "Xdot");
+    auto kernel2 = GetKernelFromCache(program, "XdotEpilogue");
 
     // Creates the buffer for intermediate values
-    auto temp_size = 2*db_["WGS2"];
-    auto temp_buffer = Buffer<T>(context_, temp_size);
+    auto temp_size = 2*db_[kWGS2];
+    auto temp_buffer = pool::GetBuffer<T>(context_, queue_, temp_size);
 
     // Sets the kernel arguments
     kernel1.SetArgument(0, static_cast<int>(n));
@@ -82,8 +83,8 @@ StatusCode Xdot<T>::DoDot(const size_t n,
     auto eventWaitList = std::vector<Event>();
 
     // Launches the main kernel
-    auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
-    auto local1 = std::vector<size_t>{db_["WGS1"]};
+    auto global1 = std::vector<size_t>{db_[kWGS1]*temp_size};
+    auto local1 = std::vector<size_t>{db_[kWGS1]};
     auto kernelEvent = Event();
     status = RunKernel(kernel1, global1, local1, kernelEvent.pointer());
     if (ErrorIn(status)) { return status; }
@@ -95,8 +96,8 @@ StatusCode Xdot<T>::DoDot(const size_t n,
     kernel2.SetArgument(2, static_cast<int>(dot_offset));
 
     // Launches the epilogue kernel
-    auto global2 = std::vector<size_t>{db_["WGS2"]};
-    auto local2 = std::vector<size_t>{db_["WGS2"]};
+    auto global2 = std::vector<size_t>{db_[kWGS2]};
+    auto local2 = std::vector<size_t>{db_[kWGS2]};
     status = RunKernel(kernel2, global2, local2, event_, eventWaitList);
     if (ErrorIn(status)) { return status; }
 
@@ -108,6 +109,7 @@ StatusCode Xdot<T>::DoDot(const size_t n,
 // =================================================================================================
 
 // Compiles the templated class
+template class Xdot<half>;
 template class Xdot<float>;
 template class Xdot<double>;
 template class Xdot<float2>;
@@ -20,6 +20,7 @@ namespace clblast {
 // =================================================================================================
 
 // Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xscal<half>::precision_ = Precision::kHalf;
 template <> const Precision Xscal<float>::precision_ = Precision::kSingle;
 template <> const Precision Xscal<double>::precision_ = Precision::kDouble;
 template <> const Precision Xscal<float2>::precision_ = Precision::kComplexSingle;
@@ -53,7 +54,7 @@ StatusCode Xscal<T>::DoScal(const size_t n, const T alpha,
 
   // Determines whether or not the fast-version can be used
   bool use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
-                         IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+                         IsMultiple(n, db_[kWGS]*db_[kWPT]*db_[kVW]);
 
   // If possible, run the fast-version of the kernel
   auto kernel_name = (use_fast_kernel) ? "XscalFast" : "Xscal";
@@ -61,7 +62,7 @@ StatusCode Xscal<T>::DoScal(const size_t n, const T alpha,
   // Retrieves the Xscal kernel from the compiled binary
   try {
     const auto program = GetProgramFromCache();
-    auto kernel = Kernel(program, kernel_name);
+    auto kernel = GetKernelFromCache(program, kernel_name);
 
     // Sets the kernel arguments
     if (use_fast_kernel) {
@@ -79,14 +80,14 @@ StatusCode Xscal<T>::DoScal(const size_t n, const T alpha,
 
     // Launches the kernel
     if (use_fast_kernel) {
-      auto global = std::vector<size_t>{CeilDiv(n, db_["WPT"]*db_["VW"])};
-      auto local = std::vector<size_t>{db_["WGS"]};
+      auto global = std::vector<size_t>{CeilDiv(n, db_[kWPT]*db_[kVW])};
+      auto local = std::vector<size_t>{db_[kWGS]};
       status = RunKernel(kernel, global, local, event_);
     }
     else {
-      auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
-      auto global = std::vector<size_t>{n_ceiled/db_["WPT"]};
-      auto local = std::vector<size_t>{db_["WGS"]};
+      auto n_ceiled = Ceil(n, db_[kWGS]*db_[kWPT]);
+      auto global = std::vector<size_t>{n_ceiled/db_[kWPT]};
+      auto local = std::vector<size_t>{db_[kWGS]};
       status = RunKernel(kernel, global, local, event_);
     }
     if (ErrorIn(status)) { return status; }
@@ -99,6 +100,7 @@ StatusCode Xscal<T>::DoScal(const size_t n, const T alpha,
 // =================================================================================================
 
 // Compiles the templated class
+template class Xscal<half>;
 template class Xscal<float>;
 template class Xscal<double>;
 template class Xscal<float2>;
@@ -20,6 +20,7 @@ namespace clblast {
 // =================================================================================================
 
 // Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xgemv<half>::precision_ = Precision::kHalf;
 template <> const Precision Xgemv<float>::precision_ = Precision::kSingle;
 template <> const Precision Xgemv<double>::precision_ = Precision::kDouble;
 template <> const Precision Xgemv<float2>::precision_ = Precision::kComplexSingle;
@@ -110,34 +111,34 @@ StatusCode Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
 
   // Determines whether or not the fast-version can be used
   fast_kernel = fast_kernel && (a_offset == 0) && (a_rotated == 0) && (a_conjugate == 0) &&
-                IsMultiple(m, db_["WGS2"]*db_["WPT2"]) &&
-                IsMultiple(n, db_["WGS2"]) &&
-                IsMultiple(a_ld, db_["VW2"]);
+                IsMultiple(m, db_[kWGS2]*db_[kWPT2]) &&
+                IsMultiple(n, db_[kWGS2]) &&
+                IsMultiple(a_ld, db_[kVW2]);
   fast_kernel_rot = fast_kernel_rot && (a_offset == 0) && (a_rotated == 1) && (a_conjugate == 0) &&
-                    IsMultiple(m, db_["WGS3"]*db_["WPT3"]) &&
-                    IsMultiple(n, db_["WGS3"]) &&
-                    IsMultiple(a_ld, db_["VW3"]);
+                    IsMultiple(m, db_[kWGS3]*db_[kWPT3]) &&
+                    IsMultiple(n, db_[kWGS3]) &&
+                    IsMultiple(a_ld, db_[kVW3]);
 
   // If possible, run the fast-version (rotated or non-rotated) of the kernel
   auto kernel_name = "Xgemv";
-  auto m_ceiled = Ceil(m_real, db_["WGS1"]*db_["WPT1"]);
-  auto global_size = m_ceiled / db_["WPT1"];
-  auto local_size = db_["WGS1"];
+  auto m_ceiled = Ceil(m_real, db_[kWGS1]*db_[kWPT1]);
+  auto global_size = m_ceiled / db_[kWPT1];
+  auto local_size = db_[kWGS1];
   if (fast_kernel) {
     kernel_name = "XgemvFast";
-    global_size = m_real / db_["WPT2"];
-    local_size = db_["WGS2"];
+    global_size = m_real / db_[kWPT2];
+    local_size = db_[kWGS2];
   }
   if (fast_kernel_rot) {
     kernel_name = "XgemvFastRot";
-    global_size = m_real / db_["WPT3"];
-    local_size = db_["WGS3"];
+    global_size = m_real / db_[kWPT3];
+    local_size = db_[kWGS3];
   }
 
   // Retrieves the Xgemv kernel from the compiled binary
   try {
     const auto program = GetProgramFromCache();
-    auto kernel = Kernel(program, kernel_name);
+    auto kernel = GetKernelFromCache(program, kernel_name);
 
     // Sets the kernel arguments
     kernel.SetArgument(0, static_cast<int>(m_real));
@@ -173,6 +174,7 @@ StatusCode Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
 // =================================================================================================
 
 // Compiles the templated class
+template class Xgemv<half>;
 template class Xgemv<float>;
 template class Xgemv<double>;
 template class Xgemv<float2>;
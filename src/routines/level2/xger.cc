@@ -20,6 +20,7 @@ namespace clblast {
 // =================================================================================================
 
 // Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xger<half>::precision_ = Precision::kHalf;
 template <> const Precision Xger<float>::precision_ = Precision::kSingle;
 template <> const Precision Xger<double>::precision_ = Precision::kDouble;
 template <> const Precision Xger<float2>::precision_ = Precision::kComplexSingle;
@@ -67,7 +68,7 @@ StatusCode Xger<T>::DoGer(const Layout layout,
   // Retrieves the Xgemv kernel from the compiled binary
   try {
     const auto program = GetProgramFromCache();
-    auto kernel = Kernel(program, "Xger");
+    auto kernel = GetKernelFromCache(program, "Xger");
 
     // Sets the kernel arguments
     kernel.SetArgument(0, static_cast<int>(a_one));
@@ -85,10 +86,10 @@ StatusCode Xger<T>::DoGer(const Layout layout,
     kernel.SetArgument(12, static_cast<int>(a_is_rowmajor));
 
     // Launches the kernel
-    auto a_one_ceiled = Ceil(CeilDiv(a_one, db_["WPT"]), db_["WGS1"]);
-    auto a_two_ceiled = Ceil(CeilDiv(a_two, db_["WPT"]), db_["WGS2"]);
+    auto a_one_ceiled = Ceil(CeilDiv(a_one, db_[kWPT]), db_[kWGS1]);
+    auto a_two_ceiled = Ceil(CeilDiv(a_two, db_[kWPT]), db_[kWGS2]);
     auto global = std::vector<size_t>{a_one_ceiled, a_two_ceiled};
-    auto local = std::vector<size_t>{db_["WGS1"], db_["WGS2"]};
+    auto local = std::vector<size_t>{db_[kWGS1], db_[kWGS2]};
     status = RunKernel(kernel, global, local, event_);
     if (ErrorIn(status)) { return status; }
 
@@ -100,6 +101,7 @@ StatusCode Xger<T>::DoGer(const Layout layout,
 // =================================================================================================
 
 // Compiles the templated class
+template class Xger<half>;
 template class Xger<float>;
 template class Xger<double>;
 template class Xger<float2>;
@@ -80,7 +80,7 @@ StatusCode Xher<T,U>::DoHer(const Layout layout, const Triangle triangle,
   // Retrieves the Xgemv kernel from the compiled binary
   try {
     const auto program = GetProgramFromCache();
-    auto kernel = Kernel(program, "Xher");
+    auto kernel = GetKernelFromCache(program, "Xher");
 
     // Sets the kernel arguments
     kernel.SetArgument(0, static_cast<int>(n));
@@ -95,10 +95,10 @@ StatusCode Xher<T,U>::DoHer(const Layout layout, const Triangle triangle,
     kernel.SetArgument(9, static_cast<int>(is_rowmajor));
 
     // Launches the kernel
-    auto global_one = Ceil(CeilDiv(n, db_["WPT"]), db_["WGS1"]);
-    auto global_two = Ceil(CeilDiv(n, db_["WPT"]), db_["WGS2"]);
+    auto global_one = Ceil(CeilDiv(n, db_[kWPT]), db_[kWGS1]);
+    auto global_two = Ceil(CeilDiv(n, db_[kWPT]), db_[kWGS2]);
     auto global = std::vector<size_t>{global_one, global_two};
-    auto local = std::vector<size_t>{db_["WGS1"], db_["WGS2"]};
+    auto local = std::vector<size_t>{db_[kWGS1], db_[kWGS2]};
     status = RunKernel(kernel, global, local, event_);
     if (ErrorIn(status)) { return status; }
 
@@ -36,7 +36,7 @@ StatusCode Xtpmv<T>::DoTpmv(const Layout layout, const Triangle triangle,
                             const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
 
   // Creates a copy of X: a temporary scratch buffer
-  auto scratch_buffer = Buffer<T>(context_, n*x_inc + x_offset);
+  auto scratch_buffer = pool::GetBuffer<T>(context_, queue_, n*x_inc + x_offset);
   try {
     x_buffer.CopyTo(queue_, n*x_inc + x_offset, scratch_buffer);
   } catch (...) { } // Continues: error-code is returned in MatVec
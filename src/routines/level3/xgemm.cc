@@ -15,29 +15,73 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <atomic>
 
 namespace clblast {
 // =================================================================================================
 
 // Specific implementations to get the memory-type based on a template argument
+template <> const Precision Xgemm<half>::precision_ = Precision::kHalf;
 template <> const Precision Xgemm<float>::precision_ = Precision::kSingle;
 template <> const Precision Xgemm<double>::precision_ = Precision::kDouble;
 template <> const Precision Xgemm<float2>::precision_ = Precision::kComplexSingle;
 template <> const Precision Xgemm<double2>::precision_ = Precision::kComplexDouble;
 
+// The accuracy mode of the GEMM routines, which is the same for all routine objects
+static std::atomic<GemmAccuracy> gemm_accuracy_{GemmAccuracy::kPrecise};
+void SetGemmAccuracyMode(const GemmAccuracy accuracy) { gemm_accuracy_ = accuracy; }
+GemmAccuracy GetGemmAccuracyMode() { return gemm_accuracy_; }
+
+// The maximum depth of the Strassen-Winograd recursion, which is also the same for all objects
+static std::atomic<size_t> gemm_strassen_depth_{2};
+void SetGemmStrassenDepthLimit(const size_t max_depth) { gemm_strassen_depth_ = max_depth; }
+size_t GetGemmStrassenDepthLimit() { return gemm_strassen_depth_; }
+
 // =================================================================================================
 
 // Constructor: forwards to base class constructor
 template <typename T>
 Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
-    Routine<T>(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm"}, precision_) {
+    Routine<T>(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect",
+                                    "GemmRoutine"}, precision_),
+    epilogue_(nullptr),
+    compute_units_(device_.ComputeUnits()),
+    computing_blocks_(false),
+    computing_strassen_(false) {
   source_string_ =
+    #include "../../kernels/level3/xgemm_part1.opencl"
+    #include "../../kernels/level3/xgemm_part2.opencl"
+  ;
+
+  // The pre/post-processing kernels and the direct kernel are compiled separately and only when
+  // they are needed
+  sub_program_sources_["Copy"] =
     #include "../../kernels/level3/copy.opencl"
+  ;
+  sub_program_sources_["Pad"] =
     #include "../../kernels/level3/pad.opencl"
+  ;
+  sub_program_sources_["Transpose"] =
     #include "../../kernels/level3/transpose.opencl"
+  ;
+  sub_program_sources_["Padtranspose"] =
     #include "../../kernels/level3/padtranspose.opencl"
-    #include "../../kernels/level3/xgemm_part1.opencl"
-    #include "../../kernels/level3/xgemm_part2.opencl"
+  ;
+  sub_program_sources_["XgemmDirect"] =
+    #include "../../kernels/level3/xgemm_direct.opencl"
+  ;
+
+  // The kernels of the split-K, 3M, and Strassen-Winograd variants are launched with the work-group
+  // sizes of the copy kernel (COPY_DIMX and COPY_DIMY), since they are similar memory-bound kernels
+  sub_program_sources_["XgemmSplitKReduce"] =
+    #include "../../kernels/level3/xgemm_splitk.opencl"
+  ;
+  sub_program_sources_["Xgemm3M"] =
+    #include "../../kernels/level3/xgemm_3m.opencl"
+  ;
+  sub_program_sources_["XgemmStrassen"] =
+    #include "../../kernels/level3/xgemm_strassen.opencl"
   ;
 }
 
@@ -98,10 +142,67 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
   status = TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld, sizeof(T));
   if (ErrorIn(status)) { return status; }
 
-  // Calculates the ceiled versions of m, n, and k
-  auto m_ceiled = Ceil(m, db_["MWG"]);
-  auto n_ceiled = Ceil(n, db_["NWG"]);
-  auto k_ceiled = Ceil(k, db_["KWG"]);
+  // Large complex problems might be computed with three real matrix-multiplications instead
+  if (Use3M(m, n, k)) {
+    return DoGemm3M(layout, a_transpose, b_transpose, m, n, k, alpha,
+                    a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+                    beta, c_buffer, c_offset, c_ld,
+                    a_one, a_two, b_one, b_two, c_one, c_two);
+  }
+
+  // Very large problems might be computed with the Strassen-Winograd recursion
+  const auto strassen_depth = StrassenDepth(layout, a_transpose, b_transpose, m, n, k);
+  if (strassen_depth > 0) {
+    return DoGemmStrassen(layout, a_transpose, b_transpose, m, n, k, alpha,
+                          MatrixView<T>{a_buffer, a_offset, a_ld},
+                          MatrixView<T>{b_buffer, b_offset, b_ld},
+                          beta, MatrixView<T>{c_buffer, c_offset, c_ld}, strassen_depth);
+  }
+
+  // Small problems are computed by the direct kernel, avoiding the pre/post-processing kernels
+  if (UseDirectKernel(m, n, k)) {
+    return DoGemmDirect(m, n, k, alpha,
+                        a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+                        beta, c_buffer, c_offset, c_ld,
+                        a_rotated, b_rotated, c_rotated, a_conjugate, b_conjugate);
+  }
+
+  // Selects the tuning parameters for this problem size, which might require another program
+  status = SetUpForProblemSize(m, n, k);
+  if (ErrorIn(status)) { return status; }
+
+  // Calculates the ceiled versions of m, n, and k. In case of split-K, k is padded to a multiple of
+  // the number of parts, each a multiple of the kernel's tile size.
+  auto m_ceiled = Ceil(m, db_[kMWG]);
+  auto n_ceiled = Ceil(n, db_[kNWG]);
+  auto k_ceiled = Ceil(k, db_[kKWG]);
+  const auto num_splits = SplitKCount(m, n, k);
+  if (num_splits > 1) { k_ceiled = Ceil(CeilDiv(k, num_splits), db_[kKWG]) * num_splits; }
+
+  // Determines whether or not temporary matrices are needed
+  auto a_no_temp = a_one == m_ceiled && a_two == k_ceiled && a_ld == m_ceiled && a_offset == 0 &&
+                   a_do_transpose == false && a_conjugate == false;
+  auto b_no_temp = b_one == n_ceiled && b_two == k_ceiled && b_ld == n_ceiled && b_offset == 0 &&
+                   b_do_transpose == false && b_conjugate == false;
+  auto c_no_temp = c_one == m_ceiled && c_two == n_ceiled && c_ld == m_ceiled && c_offset == 0 &&
+                   c_do_transpose == false;
+
+  // In case the temporary matrices (including the partial results of split-K) exceed the memory
+  // budget of the context (if any), the problem is split into blocks which are computed one after
+  // the other. This does not apply when the caller provided a workspace, which is already known to
+  // be large enough.
+  if (workspace_ == nullptr && !computing_blocks_) {
+    const auto budget = pool::GetMemoryBudget(context_());
+    const auto temp_size = ((a_no_temp) ? 0 : k_ceiled*m_ceiled) +
+                           ((b_no_temp) ? 0 : k_ceiled*n_ceiled) +
+                           ((c_no_temp) ? 0 : m_ceiled*n_ceiled) +
+                           ((num_splits > 1) ? num_splits*m_ceiled*n_ceiled : 0);
+    if (budget != 0 && temp_size*sizeof(T) > budget) {
+      return DoGemmInBlocks(layout, a_transpose, b_transpose, m, n, k, alpha,
+                            a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+                            beta, c_buffer, c_offset, c_ld, budget);
+    }
+  }
 
   // The padded/transposed input/output matrices: if memory allocation fails, throw an exception
   try {
@@ -109,18 +210,11 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
     // Loads the program from the database
     const auto program = GetProgramFromCache();
 
-    // Determines whether or not temporary matrices are needed
-    auto a_no_temp = a_one == m_ceiled && a_two == k_ceiled && a_ld == m_ceiled && a_offset == 0 &&
-                     a_do_transpose == false && a_conjugate == false;
-    auto b_no_temp = b_one == n_ceiled && b_two == k_ceiled && b_ld == n_ceiled && b_offset == 0 &&
-                     b_do_transpose == false && b_conjugate == false;
-    auto c_no_temp = c_one == m_ceiled && c_two == n_ceiled && c_ld == m_ceiled && c_offset == 0 &&
-                     c_do_transpose == false;
-
     // Creates the temporary matrices
-    auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*m_ceiled);
-    auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto c_temp = (c_no_temp) ? c_buffer : Buffer<T>(context_, m_ceiled*n_ceiled);
+    auto a_temp = (a_no_temp) ? a_buffer : GetTempBuffer(k_ceiled*m_ceiled);
+    auto b_temp = (b_no_temp) ? b_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto c_temp = (c_no_temp) ? c_buffer : GetTempBuffer(m_ceiled*n_ceiled);
+    auto c_partial = (num_splits > 1) ? GetTempBuffer(num_splits*m_ceiled*n_ceiled) : c_temp;
 
     // Events of all kernels (including pre/post processing kernels)
     auto eventWaitList = std::vector<Event>();
@@ -134,7 +228,7 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
       status = PadCopyTransposeMatrix(eventProcessA.pointer(), emptyEventList,
                                       a_one, a_two, a_ld, a_offset, a_buffer,
                                       m_ceiled, k_ceiled, m_ceiled, 0, a_temp,
-                                      program, true, a_do_transpose, a_conjugate);
+                                      true, a_do_transpose, a_conjugate);
       if (ErrorIn(status)) { return status; }
       eventWaitList.push_back(eventProcessA);
     }
@@ -145,7 +239,7 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
       status = PadCopyTransposeMatrix(eventProcessB.pointer(), emptyEventList,
                                       b_one, b_two, b_ld, b_offset, b_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, b_temp,
-                                      program, true, b_do_transpose, b_conjugate);
+                                      true, b_do_transpose, b_conjugate);
       if (ErrorIn(status)) { return status; }
       eventWaitList.push_back(eventProcessB);
     }
@@ -156,37 +250,47 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
       status = PadCopyTransposeMatrix(eventProcessC.pointer(), emptyEventList,
                                       c_one, c_two, c_ld, c_offset, c_buffer,
                                       m_ceiled, n_ceiled, m_ceiled, 0, c_temp,
-                                      program, true, c_do_transpose, false);
+                                      true, c_do_transpose, false);
       if (ErrorIn(status)) { return status; }
       eventWaitList.push_back(eventProcessC);
     }
 
-    // Retrieves the Xgemm kernel from the compiled binary
-    try {
-      auto kernel = Kernel(program, "Xgemm");
-
-      // Sets the kernel arguments
-      kernel.SetArgument(0, static_cast<int>(m_ceiled));
-      kernel.SetArgument(1, static_cast<int>(n_ceiled));
-      kernel.SetArgument(2, static_cast<int>(k_ceiled));
-      kernel.SetArgument(3, alpha);
-      kernel.SetArgument(4, beta);
-      kernel.SetArgument(5, a_temp());
-      kernel.SetArgument(6, b_temp());
-      kernel.SetArgument(7, c_temp());
-
-      // Computes the global and local thread sizes
-      auto global = std::vector<size_t>{
-        (m_ceiled * db_["MDIMC"]) / db_["MWG"],
-        (n_ceiled * db_["NDIMC"]) / db_["NWG"]
-      };
-      auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
-
-      // Launches the kernel
-      auto eventKernel = Event();
-      auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event_;
-      status = RunKernel(kernel, global, local, eventPointer, eventWaitList);
+    // Computes the product with the split-K kernels in case k is split among the work-groups
+    auto eventKernel = Event();
+    auto eventPointer = (!c_no_temp) ? eventKernel.pointer() : event_;
+    if (num_splits > 1) {
+      status = DoGemmSplitK(program, m_ceiled, n_ceiled, k_ceiled, num_splits, alpha, beta,
+                            a_temp, b_temp, c_partial, c_temp, eventPointer, eventWaitList);
       if (ErrorIn(status)) { return status; }
+    }
+
+    // Otherwise, retrieves the regular Xgemm kernel from the compiled binary
+    try {
+      if (num_splits == 1) {
+        auto kernel = GetKernelFromCache(program, "Xgemm");
+
+        // Sets the kernel arguments
+        kernel.SetArgument(0, static_cast<int>(m_ceiled));
+        kernel.SetArgument(1, static_cast<int>(n_ceiled));
+        kernel.SetArgument(2, static_cast<int>(k_ceiled));
+        kernel.SetArgument(3, alpha);
+        kernel.SetArgument(4, beta);
+        kernel.SetArgument(5, a_temp());
+        kernel.SetArgument(6, b_temp());
+        kernel.SetArgument(7, c_temp());
+        if (epilogue_ != nullptr) { SetEpilogueArguments(kernel, 8, m, n, c_temp); }
+
+        // Computes the global and local thread sizes
+        auto global = std::vector<size_t>{
+          (m_ceiled * db_[kMDIMC]) / db_[kMWG],
+          (n_ceiled * db_[kNDIMC]) / db_[kNWG]
+        };
+        auto local = std::vector<size_t>{db_[kMDIMC], db_[kNDIMC]};
+
+        // Launches the kernel
+        status = RunKernel(kernel, global, local, eventPointer, eventWaitList);
+        if (ErrorIn(status)) { return status; }
+      }
 
       // Runs the post-processing kernel if needed
       if (!c_no_temp) {
@@ -194,7 +298,7 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
         status = PadCopyTransposeMatrix(event_, eventWaitList,
                                         m_ceiled, n_ceiled, m_ceiled, 0, c_temp,
                                         c_one, c_two, c_ld, c_offset, c_buffer,
-                                        program, false, c_do_transpose, false);
+                                        false, c_do_transpose, false);
         if (ErrorIn(status)) { return status; }
       }
 
@@ -206,7 +310,636 @@ StatusCode Xgemm<T>::DoGemm(const Layout layout,
 
 // =================================================================================================
 
+// Finds out whether a problem is small enough to be computed by the direct kernel, i.e. whether
+// m*n*k is below the cube of the threshold in the database. The product is computed in floating-
+// point to avoid overflows for very large problems. The direct kernel has no epilogue.
+template <typename T>
+bool Xgemm<T>::UseDirectKernel(const size_t m, const size_t n, const size_t k) const {
+  if (epilogue_ != nullptr) { return false; }
+  const auto min_indirect_size = static_cast<double>(db_[kXGEMM_MIN_INDIRECT_SIZE]);
+  return static_cast<double>(m) * static_cast<double>(n) * static_cast<double>(k) <
+         min_indirect_size * min_indirect_size * min_indirect_size;
+}
+
+// Computes the matrix-multiplication with the direct kernel: the matrices are read in place, so
+// there are no temporary matrices nor pre/post-processing kernels. The kernel is chosen based on
+// whether A and B are stored transposed (i.e. rotated, see 'DoGemm'), which is a compile-time
+// constant in the kernels.
+template <typename T>
+StatusCode Xgemm<T>::DoGemmDirect(const size_t m, const size_t n, const size_t k,
+                                  const T alpha,
+                                  const Buffer<T> &a_buffer, const size_t a_offset,
+                                  const size_t a_ld,
+                                  const Buffer<T> &b_buffer, const size_t b_offset,
+                                  const size_t b_ld,
+                                  const T beta,
+                                  const Buffer<T> &c_buffer, const size_t c_offset,
+                                  const size_t c_ld,
+                                  const bool a_rotated, const bool b_rotated, const bool c_rotated,
+                                  const bool a_conjugate, const bool b_conjugate) {
+
+  // Loads the separately compiled program of the direct kernel
+  auto program = std::shared_ptr<Program>();
+  auto status = SetUpSubProgram("XgemmDirect", program);
+  if (ErrorIn(status)) { return status; }
+
+  // Retrieves the proper XgemmDirect kernel from the compiled binary
+  try {
+    const auto kernel_name = std::string{"XgemmDirect"} + ((a_rotated) ? "T" : "N") +
+                                                          ((b_rotated) ? "T" : "N");
+    auto kernel = GetKernelFromCache(*program, kernel_name);
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(m));
+    kernel.SetArgument(1, static_cast<int>(n));
+    kernel.SetArgument(2, static_cast<int>(k));
+    kernel.SetArgument(3, alpha);
+    kernel.SetArgument(4, beta);
+    kernel.SetArgument(5, a_buffer());
+    kernel.SetArgument(6, static_cast<int>(a_offset));
+    kernel.SetArgument(7, static_cast<int>(a_ld));
+    kernel.SetArgument(8, b_buffer());
+    kernel.SetArgument(9, static_cast<int>(b_offset));
+    kernel.SetArgument(10, static_cast<int>(b_ld));
+    kernel.SetArgument(11, c_buffer());
+    kernel.SetArgument(12, static_cast<int>(c_offset));
+    kernel.SetArgument(13, static_cast<int>(c_ld));
+    kernel.SetArgument(14, static_cast<int>(c_rotated));
+    kernel.SetArgument(15, static_cast<int>(a_conjugate));
+    kernel.SetArgument(16, static_cast<int>(b_conjugate));
+
+    // Computes the global and local thread sizes: one workgroup per WGD * WGD tile of C
+    auto global = std::vector<size_t>{
+      (Ceil(m, db_[kWGD]) * db_[kMDIMCD]) / db_[kWGD],
+      (Ceil(n, db_[kWGD]) * db_[kNDIMCD]) / db_[kWGD]
+    };
+    auto local = std::vector<size_t>{db_[kMDIMCD], db_[kNDIMCD]};
+
+    // Launches the kernel
+    status = RunKernel(kernel, global, local, event_);
+    if (ErrorIn(status)) { return status; }
+
+    // Successfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Finds out whether k is split among the work-groups and in how many parts. This is the case if
+// k/(m*n) is at least 1/XGEMM_SPLITK_RATIO (from the database) and if the regular kernel would run
+// fewer work-groups than there are compute units: k is then split such that each compute unit gets
+// a work-group, as long as each part holds at least XGEMM_SPLITK_MIN_K values of k. There is no
+// split-K variant with an epilogue.
+template <typename T>
+size_t Xgemm<T>::SplitKCount(const size_t m, const size_t n, const size_t k) const {
+  const auto ratio = db_[kXGEMM_SPLITK_RATIO];
+  if (epilogue_ != nullptr || ratio == 0) { return 1; }
+  if (static_cast<double>(k) * static_cast<double>(ratio) <
+      static_cast<double>(m) * static_cast<double>(n)) { return 1; }
+  const auto num_groups = CeilDiv(m, db_[kMWG]) * CeilDiv(n, db_[kNWG]);
+  if (num_groups >= compute_units_) { return 1; }
+  const auto max_splits = k / std::max(db_[kXGEMM_SPLITK_MIN_K], db_[kKWG]);
+  return std::max(size_t{1}, std::min(CeilDiv(compute_units_, num_groups), max_splits));
+}
+
+// Computes the matrix-multiplication with split-K in two passes: the first kernel computes the
+// product of each of the 'num_splits' parts of k in a separate (padded) matrix in 'c_partial',
+// after which the second kernel sums them and performs the multiplication with alpha and beta.
+template <typename T>
+StatusCode Xgemm<T>::DoGemmSplitK(const Program &program,
+                                  const size_t m_ceiled, const size_t n_ceiled,
+                                  const size_t k_ceiled, const size_t num_splits,
+                                  const T alpha, const T beta,
+                                  const Buffer<T> &a_temp, const Buffer<T> &b_temp,
+                                  const Buffer<T> &c_partial, const Buffer<T> &c_temp,
+                                  EventPointer event, std::vector<Event> &eventWaitList) {
+
+  // Loads the separately compiled program of the second pass
+  auto reduce_program = std::shared_ptr<Program>();
+  auto status = SetUpSubProgram("XgemmSplitKReduce", reduce_program);
+  if (ErrorIn(status)) { return status; }
+
+  // Retrieves the split-K kernels from the compiled binaries
+  try {
+    auto kernel = GetKernelFromCache(program, "XgemmSplitK");
+    auto reduce_kernel = GetKernelFromCache(*reduce_program, "XgemmSplitKReduce");
+
+    // Sets the kernel arguments of the first pass
+    kernel.SetArgument(0, static_cast<int>(m_ceiled));
+    kernel.SetArgument(1, static_cast<int>(n_ceiled));
+    kernel.SetArgument(2, static_cast<int>(k_ceiled / num_splits));
+    kernel.SetArgument(3, a_temp());
+    kernel.SetArgument(4, b_temp());
+    kernel.SetArgument(5, c_partial());
+
+    // Launches the first pass: the third dimension of the work-groups selects the part of k
+    auto global = std::vector<size_t>{
+      (m_ceiled * db_[kMDIMC]) / db_[kMWG],
+      (n_ceiled * db_[kNDIMC]) / db_[kNWG],
+      num_splits
+    };
+    auto local = std::vector<size_t>{db_[kMDIMC], db_[kNDIMC], 1};
+    auto eventSplits = Event();
+    status = RunKernel(kernel, global, local, eventSplits.pointer(), eventWaitList);
+    if (ErrorIn(status)) { return status; }
+
+    // Sets the kernel arguments of the second pass
+    reduce_kernel.SetArgument(0, static_cast<int>(m_ceiled));
+    reduce_kernel.SetArgument(1, static_cast<int>(n_ceiled));
+    reduce_kernel.SetArgument(2, static_cast<int>(num_splits));
+    reduce_kernel.SetArgument(3, alpha);
+    reduce_kernel.SetArgument(4, beta);
+    reduce_kernel.SetArgument(5, c_partial());
+    reduce_kernel.SetArgument(6, c_temp());
+
+    // Launches the second pass once the first one has finished
+    auto reduce_global = std::vector<size_t>{
+      Ceil(m_ceiled, db_[kCOPY_DIMX]),
+      Ceil(n_ceiled, db_[kCOPY_DIMY])
+    };
+    auto reduce_local = std::vector<size_t>{db_[kCOPY_DIMX], db_[kCOPY_DIMY]};
+    auto reduceWaitList = std::vector<Event>{eventSplits};
+    return RunKernel(reduce_kernel, reduce_global, reduce_local, event, reduceWaitList);
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Finds out whether the 3M algorithm is used: only for complex problems in the fast accuracy mode
+// for which m*n*k is at least the cube of XGEMM_MIN_3M_SIZE (from the database). Its temporary
+// matrices are not included in the workspace size, so it is not used with a workspace nor with a
+// memory budget.
+template <typename T>
+bool Xgemm<T>::Use3M(const size_t m, const size_t n, const size_t k) const {
+  const auto is_complex = (precision_ == Precision::kComplexSingle ||
+                           precision_ == Precision::kComplexDouble);
+  if (!is_complex || GetGemmAccuracyMode() != GemmAccuracy::kFast) { return false; }
+  if (epilogue_ != nullptr || workspace_ != nullptr || computing_blocks_) { return false; }
+  if (pool::GetMemoryBudget(context_()) != 0) { return false; }
+  const auto min_3m_size = static_cast<double>(db_[kXGEMM_MIN_3M_SIZE]);
+  return min_3m_size != 0.0 &&
+         static_cast<double>(m) * static_cast<double>(n) * static_cast<double>(k) >=
+         min_3m_size * min_3m_size * min_3m_size;
+}
+
+// Computes the complex matrix-multiplication with the 3M algorithm: with T1 = Ar*Br, T2 = Ai*Bi,
+// and T3 = (Ar+Ai)*(Br+Bi), the product A*B equals T1 - T2 + i*(T3 - T1 - T2). This saves a
+// quarter of the floating-point operations at the cost of accuracy, since T3 - T1 - T2 suffers
+// from cancellation. First, A and B are split into real matrices of the same layout (conjugating if
+// needed), of which a routine of the corresponding real precision computes the three products.
+// These are then merged into C, which includes the multiplication with alpha and beta.
+template <typename T>
+StatusCode Xgemm<T>::DoGemm3M(const Layout layout,
+                              const Transpose a_transpose, const Transpose b_transpose,
+                              const size_t m, const size_t n, const size_t k,
+                              const T alpha,
+                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                              const T beta,
+                              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                              const size_t a_one, const size_t a_two, const size_t b_one,
+                              const size_t b_two, const size_t c_one, const size_t c_two) {
+  using R = typename ComplexPart<T>::Type;
+
+  // Loads the separately compiled program of the split and merge kernels
+  auto program = std::shared_ptr<Program>();
+  auto status = SetUpSubProgram("Xgemm3M", program);
+  if (ErrorIn(status)) { return status; }
+
+  // The real matrix-multiplications are computed by a routine of the corresponding real precision
+  if (!real_gemm_) {
+    auto real_gemm = std::unique_ptr<Xgemm<R>>(new Xgemm<R>(queue_, nullptr));
+    status = real_gemm->SetUp();
+    if (ErrorIn(status)) { return status; }
+    real_gemm_ = std::move(real_gemm);
+  }
+
+  // The real and imaginary parts of A and B and their sums, and the three real products
+  try {
+    auto a_parts = std::vector<Buffer<R>>();
+    auto b_parts = std::vector<Buffer<R>>();
+    auto c_parts = std::vector<Buffer<R>>();
+    for (auto i = size_t{0}; i < 3; ++i) {
+      a_parts.push_back(pool::GetBuffer<R>(context_, queue_, a_one*a_two));
+      b_parts.push_back(pool::GetBuffer<R>(context_, queue_, b_one*b_two));
+      c_parts.push_back(pool::GetBuffer<R>(context_, queue_, c_one*c_two));
+    }
+
+    try {
+      auto global_split = std::vector<size_t>();
+      const auto local = std::vector<size_t>{db_[kCOPY_DIMX], db_[kCOPY_DIMY]};
+
+      // Splits matrices A and B. On out-of-order queues these are waited for, since the real routine
+      // doesn't take a list of events to wait for.
+      const auto in_order = pool::IsInOrderQueue(queue_());
+      auto split = [&](const size_t one, const size_t two, const size_t ld, const size_t offset,
+                       const Buffer<T> &buffer, const std::vector<Buffer<R>> &parts,
+                       const bool conjugate) -> StatusCode {
+        auto kernel = GetKernelFromCache(*program, "Xgemm3MSplit");
+        kernel.SetArgument(0, static_cast<int>(one));
+        kernel.SetArgument(1, static_cast<int>(two));
+        kernel.SetArgument(2, static_cast<int>(ld));
+        kernel.SetArgument(3, static_cast<int>(offset));
+        kernel.SetArgument(4, buffer());
+        kernel.SetArgument(5, parts[0]());
+        kernel.SetArgument(6, parts[1]());
+        kernel.SetArgument(7, parts[2]());
+        kernel.SetArgument(8, static_cast<int>(conjugate));
+        global_split = std::vector<size_t>{Ceil(one, db_[kCOPY_DIMX]), Ceil(two, db_[kCOPY_DIMY])};
+        auto event_split = Event();
+        const auto split_status = RunKernel(kernel, global_split, local, event_split.pointer());
+        if (!ErrorIn(split_status) && !in_order) { event_split.WaitForCompletion(); }
+        return split_status;
+      };
+      status = split(a_one, a_two, a_ld, a_offset, a_buffer, a_parts,
+                     a_transpose == Transpose::kConjugate);
+      if (ErrorIn(status)) { return status; }
+      status = split(b_one, b_two, b_ld, b_offset, b_buffer, b_parts,
+                     b_transpose == Transpose::kConjugate);
+      if (ErrorIn(status)) { return status; }
+
+      // Computes the three real products. Their layouts and transposes are those of the complex
+      // matrices, without the conjugation which is already applied.
+      const auto a_real_transpose = (a_transpose == Transpose::kNo) ? Transpose::kNo :
+                                                                      Transpose::kYes;
+      const auto b_real_transpose = (b_transpose == Transpose::kNo) ? Transpose::kNo :
+                                                                      Transpose::kYes;
+      auto eventWaitList = std::vector<Event>(3);
+      for (auto i = size_t{0}; i < 3; ++i) {
+        real_gemm_->SetEvent(eventWaitList[i].pointer());
+        status = real_gemm_->DoGemm(layout, a_real_transpose, b_real_transpose, m, n, k,
+                                  ConstantOne<R>(), a_parts[i], 0, a_one, b_parts[i], 0, b_one,
+                                  ConstantZero<R>(), c_parts[i], 0, c_one);
+        if (ErrorIn(status)) { return status; }
+      }
+
+      // Merges the three products into C
+      auto kernel = GetKernelFromCache(*program, "Xgemm3MMerge");
+      kernel.SetArgument(0, static_cast<int>(c_one));
+      kernel.SetArgument(1, static_cast<int>(c_two));
+      kernel.SetArgument(2, static_cast<int>(c_ld));
+      kernel.SetArgument(3, static_cast<int>(c_offset));
+      kernel.SetArgument(4, alpha);
+      kernel.SetArgument(5, beta);
+      kernel.SetArgument(6, c_parts[0]());
+      kernel.SetArgument(7, c_parts[1]());
+      kernel.SetArgument(8, c_parts[2]());
+      kernel.SetArgument(9, c_buffer());
+      auto global = std::vector<size_t>{Ceil(c_one, db_[kCOPY_DIMX]), Ceil(c_two, db_[kCOPY_DIMY])};
+      return RunKernel(kernel, global, local, event_, eventWaitList);
+    } catch (...) { return StatusCode::kInvalidKernel; }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Sets the kernel arguments of the epilogue (see the Xgemm kernel). These include the actual sizes
+// of C, since the kernel computes the padded matrix. Vectors which are not used are replaced by C,
+// which the epilogue doesn't read.
+template <typename T>
+void Xgemm<T>::SetEpilogueArguments(Kernel &kernel, const size_t index,
+                                    const size_t m, const size_t n,
+                                    const Buffer<T> &c_buffer) const {
+  const auto bias_mode = (epilogue_->bias == Bias::kRowBias) ? 1 :
+                         (epilogue_->bias == Bias::kColumnBias) ? 2 : 0;
+  const auto activation = (epilogue_->activation == Activation::kRelu) ? 1 :
+                          (epilogue_->activation == Activation::kGelu) ? 2 : 0;
+  const auto row_scaling = (epilogue_->row_scale_buffer != nullptr);
+  const auto col_scaling = (epilogue_->col_scale_buffer != nullptr);
+  kernel.SetArgument(index + 0, static_cast<int>(m));
+  kernel.SetArgument(index + 1, static_cast<int>(n));
+  kernel.SetArgument(index + 2, static_cast<int>(bias_mode));
+  kernel.SetArgument(index + 3, (bias_mode != 0) ? epilogue_->bias_buffer : c_buffer());
+  kernel.SetArgument(index + 4, static_cast<int>(epilogue_->bias_offset));
+  kernel.SetArgument(index + 5, static_cast<int>(activation));
+  kernel.SetArgument(index + 6, static_cast<int>(row_scaling));
+  kernel.SetArgument(index + 7, (row_scaling) ? epilogue_->row_scale_buffer : c_buffer());
+  kernel.SetArgument(index + 8, static_cast<int>(epilogue_->row_scale_offset));
+  kernel.SetArgument(index + 9, static_cast<int>(col_scaling));
+  kernel.SetArgument(index + 10, (col_scaling) ? epilogue_->col_scale_buffer : c_buffer());
+  kernel.SetArgument(index + 11, static_cast<int>(epilogue_->col_scale_offset));
+}
+
+// =================================================================================================
+
+// Computes the offset of the element at (row, col) of a matrix, which is stored transposed or not
+static size_t ElementOffset(const Layout layout, const bool transposed,
+                            const size_t row, const size_t col, const size_t ld) {
+  const auto stored_row = (transposed) ? col : row;
+  const auto stored_col = (transposed) ? row : col;
+  return (layout == Layout::kColMajor) ? stored_row + stored_col*ld : stored_row*ld + stored_col;
+}
+
+// Computes C in blocks, each with temporary matrices within the memory budget. The block sizes are
+// found by halving first the columns of C (i.e. processing it in column panels), then its rows,
+// and finally the inner dimension k. The blocks along k accumulate into C, so only the first one
+// uses the original value of beta and only the last one applies the epilogue (if any), of which
+// the vectors are offset to the block. The blocks are processed one after the other, such that
+// their temporary buffers are re-used (from the pool) and the memory usage is that of a single
+// block.
+template <typename T>
+StatusCode Xgemm<T>::DoGemmInBlocks(const Layout layout,
+                                    const Transpose a_transpose, const Transpose b_transpose,
+                                    const size_t m, const size_t n, const size_t k,
+                                    const T alpha,
+                                    const Buffer<T> &a_buffer, const size_t a_offset,
+                                    const size_t a_ld,
+                                    const Buffer<T> &b_buffer, const size_t b_offset,
+                                    const size_t b_ld,
+                                    const T beta,
+                                    const Buffer<T> &c_buffer, const size_t c_offset,
+                                    const size_t c_ld,
+                                    const size_t budget) {
+
+  // Finds the block sizes, as multiples of the kernel's tile sizes
+  auto m_block = m;
+  auto n_block = n;
+  auto k_block = k;
+  while (GemmWorkspaceSize(layout, a_transpose, b_transpose, m_block, n_block, k_block) > budget) {
+    if (n_block > db_[kNWG]) {
+      n_block = Ceil(CeilDiv(n_block, 2), db_[kNWG]);
+    } else if (m_block > db_[kMWG]) {
+      m_block = Ceil(CeilDiv(m_block, 2), db_[kMWG]);
+    } else if (k_block > db_[kKWG]) {
+      k_block = Ceil(CeilDiv(k_block, 2), db_[kKWG]);
+    } else {
+      return StatusCode::kTempBufferAllocFailure;
+    }
+  }
+
+  // Computes the blocks. All but the last one use a local event, which is waited for: this also
+  // guarantees the order of the accumulations along k on out-of-order queues.
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto b_transposed = (b_transpose != Transpose::kNo);
+  const auto event = event_;
+  const auto epilogue = epilogue_;
+  computing_blocks_ = true;
+  auto status = StatusCode::kSuccess;
+  for (auto j = size_t{0}; j < n && !ErrorIn(status); j += n_block) {
+    for (auto i = size_t{0}; i < m && !ErrorIn(status); i += m_block) {
+      for (auto p = size_t{0}; p < k && !ErrorIn(status); p += k_block) {
+        const auto is_last_block = (j + n_block >= n) && (i + m_block >= m) && (p + k_block >= k);
+        auto block_event = Event();
+        event_ = (is_last_block) ? event : block_event.pointer();
+        auto block_epilogue = GemmEpilogueArguments{Bias::kNoBias, nullptr, 0,
+                                                    Activation::kIdentity, nullptr, 0, nullptr, 0};
+        if (epilogue != nullptr && p + k_block >= k) {
+          block_epilogue = *epilogue;
+          block_epilogue.bias_offset += (epilogue->bias == Bias::kRowBias) ? i :
+                                        (epilogue->bias == Bias::kColumnBias) ? j : 0;
+          block_epilogue.row_scale_offset += i;
+          block_epilogue.col_scale_offset += j;
+        }
+        if (epilogue != nullptr) { epilogue_ = &block_epilogue; }
+        status = DoGemm(layout, a_transpose, b_transpose,
+                        std::min(m_block, m - i), std::min(n_block, n - j),
+                        std::min(k_block, k - p),
+                        alpha,
+                        a_buffer, a_offset + ElementOffset(layout, a_transposed, i, p, a_ld), a_ld,
+                        b_buffer, b_offset + ElementOffset(layout, b_transposed, p, j, b_ld), b_ld,
+                        (p == 0) ? beta : ConstantOne<T>(),
+                        c_buffer, c_offset + ElementOffset(layout, false, i, j, c_ld), c_ld);
+        if (!ErrorIn(status) && !is_last_block) { block_event.WaitForCompletion(); }
+      }
+    }
+  }
+  computing_blocks_ = false;
+  event_ = event;
+  epilogue_ = epilogue;
+  return status;
+}
+
+// =================================================================================================
+
+// Finds the number of levels of the Strassen-Winograd recursion. It is only used in the fast
+// accuracy mode, for problems with m, n, and k all at least XGEMM_MIN_STRASSEN_SIZE (from the
+// database), which also need to be even since each level halves them. The depth is limited by the
+// API, and by the temporary memory: the sums and products of all levels together with the temporary
+// matrices of the leaves have to fit in the memory budget or otherwise in half the device memory.
+// These are not included in the workspace size, so it is not used with a workspace.
+template <typename T>
+size_t Xgemm<T>::StrassenDepth(const Layout layout,
+                               const Transpose a_transpose, const Transpose b_transpose,
+                               const size_t m, const size_t n, const size_t k) {
+  const auto max_depth = GetGemmStrassenDepthLimit();
+  if (GetGemmAccuracyMode() != GemmAccuracy::kFast || max_depth == 0) { return 0; }
+  if (epilogue_ != nullptr || workspace_ != nullptr || computing_blocks_ || computing_strassen_) {
+    return 0;
+  }
+  const auto min_size = db_[kXGEMM_MIN_STRASSEN_SIZE];
+  if (min_size == 0) { return 0; }
+  const auto budget = pool::GetMemoryBudget(context_());
+  const auto available = (budget != 0) ? budget : device_.MemorySize() / 2;
+  auto depth = size_t{0};
+  auto temp_bytes = size_t{0};
+  auto m_level = m;
+  auto n_level = n;
+  auto k_level = k;
+  while (depth < max_depth && m_level >= min_size && n_level >= min_size && k_level >= min_size &&
+         m_level % 2 == 0 && n_level % 2 == 0 && k_level % 2 == 0) {
+    m_level /= 2;
+    n_level /= 2;
+    k_level /= 2;
+    temp_bytes += (4*m_level*k_level + 4*k_level*n_level + 7*m_level*n_level) * sizeof(T);
+    const auto leaf_bytes = GemmWorkspaceSize(layout, a_transpose, b_transpose,
+                                              m_level, n_level, k_level);
+    if (temp_bytes + leaf_bytes > available) { break; }
+    depth++;
+  }
+  return depth;
+}
+
+// Computes C with the Strassen-Winograd algorithm, which splits the matrices in quadrants and
+// computes their product with 7 instead of 8 multiplications of the quadrants:
+//   S1 = A21 + A22, S2 = S1 - A11, S3 = A11 - A21, S4 = A12 - S2
+//   T1 = B12 - B11, T2 = B22 - T1, T3 = B22 - B12, T4 = T2 - B21
+//   P1 = A11*B11, P2 = A12*B21, P3 = S4*B22, P4 = A22*T4, P5 = S1*T1, P6 = S2*T2, P7 = S3*T3
+// The quadrants are views into the original buffers, of which the sums are stored in temporary
+// matrices of the same layout and transposes. The products are computed by the next level of the
+// recursion or at the leaves by the regular routine, each with a local event which is waited for:
+// this guarantees their order on out-of-order queues. Finally, a kernel combines them into the
+// quadrants of C, which includes the multiplication with alpha and beta.
+template <typename T>
+StatusCode Xgemm<T>::DoGemmStrassen(const Layout layout,
+                                    const Transpose a_transpose, const Transpose b_transpose,
+                                    const size_t m, const size_t n, const size_t k,
+                                    const T alpha, const MatrixView<T> &a, const MatrixView<T> &b,
+                                    const T beta, const MatrixView<T> &c, const size_t depth) {
+
+  // Loads the separately compiled program of the add and combine kernels
+  auto program = std::shared_ptr<Program>();
+  auto status = SetUpSubProgram("XgemmStrassen", program);
+  if (ErrorIn(status)) { return status; }
+
+  // The sizes of the quadrants, and their first and second dimensions in memory (see 'DoGemm')
+  const auto m2 = m / 2;
+  const auto n2 = n / 2;
+  const auto k2 = k / 2;
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto b_transposed = (b_transpose != Transpose::kNo);
+  const auto a_rotated = (layout == Layout::kColMajor) == a_transposed;
+  const auto b_rotated = (layout == Layout::kColMajor) == b_transposed;
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  const auto a_one = (a_rotated) ? k2 : m2;
+  const auto a_two = (a_rotated) ? m2 : k2;
+  const auto b_one = (b_rotated) ? n2 : k2;
+  const auto b_two = (b_rotated) ? k2 : n2;
+  const auto c_one = (c_rotated) ? n2 : m2;
+  const auto c_two = (c_rotated) ? m2 : n2;
+
+  // The quadrants of the three matrices
+  auto quadrant = [&](const MatrixView<T> &matrix, const bool transposed,
+                      const size_t row, const size_t col) -> MatrixView<T> {
+    return MatrixView<T>{matrix.buffer,
+                         matrix.offset + ElementOffset(layout, transposed, row, col, matrix.ld),
+                         matrix.ld};
+  };
+  const auto a11 = quadrant(a, a_transposed, 0, 0);
+  const auto a12 = quadrant(a, a_transposed, 0, k2);
+  const auto a21 = quadrant(a, a_transposed, m2, 0);
+  const auto a22 = quadrant(a, a_transposed, m2, k2);
+  const auto b11 = quadrant(b, b_transposed, 0, 0);
+  const auto b12 = quadrant(b, b_transposed, 0, n2);
+  const auto b21 = quadrant(b, b_transposed, k2, 0);
+  const auto b22 = quadrant(b, b_transposed, k2, n2);
+
+  // The temporary sums and products: if memory allocation fails, throw an exception
+  try {
+    auto s = std::vector<MatrixView<T>>();
+    auto t = std::vector<MatrixView<T>>();
+    auto p = std::vector<MatrixView<T>>();
+    for (auto i = size_t{0}; i < 4; ++i) {
+      s.push_back(MatrixView<T>{pool::GetBuffer<T>(context_, queue_, a_one*a_two), 0, a_one});
+      t.push_back(MatrixView<T>{pool::GetBuffer<T>(context_, queue_, b_one*b_two), 0, b_one});
+    }
+    for (auto i = size_t{0}; i < 7; ++i) {
+      p.push_back(MatrixView<T>{pool::GetBuffer<T>(context_, queue_, c_one*c_two), 0, c_one});
+    }
+
+    try {
+      const auto local = std::vector<size_t>{db_[kCOPY_DIMX], db_[kCOPY_DIMY]};
+
+      // Adds or subtracts two quadrants (or sums) into a sum, which is waited for
+      auto add = [&](const size_t one, const size_t two, const MatrixView<T> &x,
+                     const MatrixView<T> &y, const bool subtract,
+                     const MatrixView<T> &dest) -> StatusCode {
+        auto kernel = GetKernelFromCache(*program, "XgemmStrassenAdd");
+        kernel.SetArgument(0, static_cast<int>(one));
+        kernel.SetArgument(1, static_cast<int>(two));
+        kernel.SetArgument(2, static_cast<int>(x.ld));
+        kernel.SetArgument(3, static_cast<int>(x.offset));
+        kernel.SetArgument(4, x.buffer());
+        kernel.SetArgument(5, static_cast<int>(y.ld));
+        kernel.SetArgument(6, static_cast<int>(y.offset));
+        kernel.SetArgument(7, y.buffer());
+        kernel.SetArgument(8, static_cast<int>(subtract));
+        kernel.SetArgument(9, dest.buffer());
+        auto global = std::vector<size_t>{Ceil(one, db_[kCOPY_DIMX]), Ceil(two, db_[kCOPY_DIMY])};
+        auto event_add = Event();
+        const auto add_status = RunKernel(kernel, global, local, event_add.pointer());
+        if (!ErrorIn(add_status)) { event_add.WaitForCompletion(); }
+        return add_status;
+      };
+
+      // Multiplies two quadrants (or sums) into a product, which is waited for
+      auto multiply = [&](const MatrixView<T> &x, const MatrixView<T> &y,
+                          const MatrixView<T> &product) -> StatusCode {
+        const auto event = event_;
+        auto event_product = Event();
+        event_ = event_product.pointer();
+        computing_strassen_ = true;
+        const auto product_status = (depth > 1) ?
+          DoGemmStrassen(layout, a_transpose, b_transpose, m2, n2, k2, ConstantOne<T>(),
+                         x, y, ConstantZero<T>(), product, depth - 1) :
+          DoGemm(layout, a_transpose, b_transpose, m2, n2, k2, ConstantOne<T>(),
+                 x.buffer, x.offset, x.ld, y.buffer, y.offset, y.ld,
+                 ConstantZero<T>(), product.buffer, product.offset, product.ld);
+        computing_strassen_ = false;
+        event_ = event;
+        if (!ErrorIn(product_status)) { event_product.WaitForCompletion(); }
+        return product_status;
+      };
+
+      // Computes the sums of the quadrants of A and of B
+      status = add(a_one, a_two, a21, a22, false, s[0]);
+      if (ErrorIn(status)) { return status; }
+      status = add(a_one, a_two, s[0], a11, true, s[1]);
+      if (ErrorIn(status)) { return status; }
+      status = add(a_one, a_two, a11, a21, true, s[2]);
+      if (ErrorIn(status)) { return status; }
+      status = add(a_one, a_two, a12, s[1], true, s[3]);
+      if (ErrorIn(status)) { return status; }
+      status = add(b_one, b_two, b12, b11, true, t[0]);
+      if (ErrorIn(status)) { return status; }
+      status = add(b_one, b_two, b22, t[0], true, t[1]);
+      if (ErrorIn(status)) { return status; }
+      status = add(b_one, b_two, b22, b12, true, t[2]);
+      if (ErrorIn(status)) { return status; }
+      status = add(b_one, b_two, t[1], b21, true, t[3]);
+      if (ErrorIn(status)) { return status; }
+
+      // Computes the seven products
+      status = multiply(a11, b11, p[0]);
+      if (ErrorIn(status)) { return status; }
+      status = multiply(a12, b21, p[1]);
+      if (ErrorIn(status)) { return status; }
+      status = multiply(s[3], b22, p[2]);
+      if (ErrorIn(status)) { return status; }
+      status = multiply(a22, t[3], p[3]);
+      if (ErrorIn(status)) { return status; }
+      status = multiply(s[0], t[0], p[4]);
+      if (ErrorIn(status)) { return status; }
+      status = multiply(s[1], t[1], p[5]);
+      if (ErrorIn(status)) { return status; }
+      status = multiply(s[2], t[2], p[6]);
+      if (ErrorIn(status)) { return status; }
+
+      // Combines the products into the quadrants of C
+      auto kernel = GetKernelFromCache(*program, "XgemmStrassenCombine");
+      kernel.SetArgument(0, static_cast<int>(c_one));
+      kernel.SetArgument(1, static_cast<int>(c_two));
+      kernel.SetArgument(2, static_cast<int>(c.ld));
+      kernel.SetArgument(3, static_cast<int>(quadrant(c, false, 0, 0).offset));
+      kernel.SetArgument(4, static_cast<int>(quadrant(c, false, 0, n2).offset));
+      kernel.SetArgument(5, static_cast<int>(quadrant(c, false, m2, 0).offset));
+      kernel.SetArgument(6, static_cast<int>(quadrant(c, false, m2, n2).offset));
+      kernel.SetArgument(7, alpha);
+      kernel.SetArgument(8, beta);
+      for (auto i = size_t{0}; i < 7; ++i) {
+        kernel.SetArgument(9 + i, p[i].buffer());
+      }
+      kernel.SetArgument(16, c.buffer());
+      auto global = std::vector<size_t>{Ceil(c_one, db_[kCOPY_DIMX]), Ceil(c_two, db_[kCOPY_DIMY])};
+      return RunKernel(kernel, global, local, event_);
+    } catch (...) { return StatusCode::kInvalidKernel; }
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Computes the size of the workspace. All three temporary matrices are counted, even though some of
+// them might not be needed in practice (e.g. when a matrix is already of the padded size), as well
+// as the partial results of split-K. The direct kernel doesn't need any workspace.
+template <typename T>
+size_t Xgemm<T>::GemmWorkspaceSize(const Layout, const Transpose, const Transpose,
+                                   const size_t m, const size_t n, const size_t k) {
+  if (UseDirectKernel(m, n, k)) { return 0; }
+  db_.SelectProblemSize(m, n, k);
+  const auto m_ceiled = Ceil(m, db_[kMWG]);
+  const auto n_ceiled = Ceil(n, db_[kNWG]);
+  const auto num_splits = SplitKCount(m, n, k);
+  const auto k_ceiled = (num_splits > 1) ? Ceil(CeilDiv(k, num_splits), db_[kKWG]) * num_splits :
+                                           Ceil(k, db_[kKWG]);
+  const auto partial_size = (num_splits > 1) ? WorkspaceBytes(num_splits*m_ceiled*n_ceiled) : 0;
+  return WorkspaceBytes(k_ceiled*m_ceiled) + WorkspaceBytes(k_ceiled*n_ceiled) +
+         WorkspaceBytes(m_ceiled*n_ceiled) + partial_size;
+}
+
+// =================================================================================================
+
 // Compiles the templated class
+template class Xgemm<half>;
 template class Xgemm<float>;
 template class Xgemm<double>;
 template class Xgemm<float2>;
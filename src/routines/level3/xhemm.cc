@@ -54,15 +54,19 @@ StatusCode Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle
                    (triangle == Triangle::kLower && layout == Layout::kRowMajor));
   auto kernel_name = (is_upper) ? "HermUpperToSquared" : "HermLowerToSquared";
 
+  // Retrieves the separately compiled program holding the hermitian-to-squared kernels
+  auto program = std::shared_ptr<Program>();
+  status = SetUpSubProgram("Pad", program);
+  if (ErrorIn(status)) { return status; }
+
   // Temporary buffer for a copy of the hermitian matrix
   try {
-    auto temp_herm = Buffer<T>(context_, k*k);
+    auto temp_herm = GetTempBuffer(k*k);
 
     // Creates a general matrix from the hermitian matrix to be able to run the regular Xgemm
     // routine afterwards
     try {
-      const auto program = GetProgramFromCache();
-      auto kernel = Kernel(program, kernel_name);
+      auto kernel = GetKernelFromCache(*program, kernel_name);
 
       // Sets the arguments for the hermitian-to-squared kernel
       kernel.SetArgument(0, static_cast<int>(k));
@@ -76,9 +80,9 @@ StatusCode Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle
 
       // Uses the common padding kernel's thread configuration. This is allowed, since the
       // hermitian-to-squared kernel uses the same parameters.
-      auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                        Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-      auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+      auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_[kPAD_WPTX]), db_[kPAD_DIMX]),
+                                        Ceil(CeilDiv(k, db_[kPAD_WPTY]), db_[kPAD_DIMY])};
+      auto local = std::vector<size_t>{db_[kPAD_DIMX], db_[kPAD_DIMY]};
       auto kernelEvent = Event();
       status = RunKernel(kernel, global, local, kernelEvent.pointer());
       if (ErrorIn(status)) { return status; }
@@ -126,6 +130,17 @@ StatusCode Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle
 
 // =================================================================================================
 
+// Computes the size of the workspace: the squared copy of the hermitian matrix plus the workspace
+// of the Xgemm routine
+template <typename T>
+size_t Xhemm<T>::HemmWorkspaceSize(const Layout layout, const Side side, const Triangle,
+                                   const size_t m, const size_t n) {
+  const auto k = (side == Side::kLeft) ? m : n;
+  return WorkspaceBytes(k*k) + GemmWorkspaceSize(layout, Transpose::kNo, Transpose::kNo, m, n, k);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xhemm<float2>;
 template class Xhemm<double2>;
@@ -30,12 +30,22 @@ template <typename T, typename U>
 Xher2k<T,U>::Xher2k(Queue &queue, EventPointer event, const std::string &name):
     Routine<T>(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm"}, precision_) {
   source_string_ =
+    #include "../../kernels/level3/xgemm_part1.opencl"
+    #include "../../kernels/level3/xgemm_part2.opencl"
+  ;
+
+  // The pre/post-processing kernels are compiled separately and only when they are needed
+  sub_program_sources_["Copy"] =
     #include "../../kernels/level3/copy.opencl"
+  ;
+  sub_program_sources_["Pad"] =
     #include "../../kernels/level3/pad.opencl"
+  ;
+  sub_program_sources_["Transpose"] =
     #include "../../kernels/level3/transpose.opencl"
+  ;
+  sub_program_sources_["Padtranspose"] =
     #include "../../kernels/level3/padtranspose.opencl"
-    #include "../../kernels/level3/xgemm_part1.opencl"
-    #include "../../kernels/level3/xgemm_part2.opencl"
   ;
 }
 
@@ -83,8 +93,8 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
   if (ErrorIn(status)) { return status; }
 
   // Calculates the ceiled versions of n and k
-  auto n_ceiled = Ceil(n, db_["NWG"]);
-  auto k_ceiled = Ceil(k, db_["KWG"]);
+  auto n_ceiled = Ceil(n, db_[kNWG]);
+  auto k_ceiled = Ceil(k, db_[kKWG]);
 
   // Decides which kernel to run: the upper-triangular or lower-triangular version
   auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
@@ -106,11 +116,11 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
                       ab_rotated == false && ab_conjugate == true;
 
     // Creates the temporary matrices
-    auto a1_temp = (a1_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto a2_temp = (a2_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto b1_temp = (b1_no_temp) ? b_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto b2_temp = (b2_no_temp) ? b_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
+    auto a1_temp = (a1_no_temp) ? a_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto a2_temp = (a2_no_temp) ? a_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto b1_temp = (b1_no_temp) ? b_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto b2_temp = (b2_no_temp) ? b_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto c_temp = GetTempBuffer(n_ceiled*n_ceiled);
 
     // Events of all kernels (including pre/post processing kernels)
     auto eventWaitList = std::vector<Event>();
@@ -124,7 +134,7 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
       status = PadCopyTransposeMatrix(eventProcessA1.pointer(), emptyEventList,
                                       ab_one, ab_two, a_ld, a_offset, a_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, a1_temp,
-                                      program, true, ab_rotated, ab_conjugate);
+                                      true, ab_rotated, ab_conjugate);
       eventWaitList.push_back(eventProcessA1);
       if (ErrorIn(status)) { return status; }
     }
@@ -133,7 +143,7 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
       status = PadCopyTransposeMatrix(eventProcessA2.pointer(), emptyEventList,
                                       ab_one, ab_two, a_ld, a_offset, a_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, a2_temp,
-                                      program, true, ab_rotated, !ab_conjugate);
+                                      true, ab_rotated, !ab_conjugate);
       eventWaitList.push_back(eventProcessA2);
       if (ErrorIn(status)) { return status; }
     }
@@ -142,7 +152,7 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
       status = PadCopyTransposeMatrix(eventProcessB1.pointer(), emptyEventList,
                                       ab_one, ab_two, b_ld, b_offset, b_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, b1_temp,
-                                      program, true, ab_rotated, ab_conjugate);
+                                      true, ab_rotated, ab_conjugate);
       eventWaitList.push_back(eventProcessB1);
       if (ErrorIn(status)) { return status; }
     }
@@ -151,7 +161,7 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
       status = PadCopyTransposeMatrix(eventProcessB2.pointer(), emptyEventList,
                                       ab_one, ab_two, b_ld, b_offset, b_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, b2_temp,
-                                      program, true, ab_rotated, !ab_conjugate);
+                                      true, ab_rotated, !ab_conjugate);
       eventWaitList.push_back(eventProcessB2);
       if (ErrorIn(status)) { return status; }
     }
@@ -162,13 +172,13 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
     status = PadCopyTransposeMatrix(eventProcessC.pointer(), emptyEventList,
                                     n, n, c_ld, c_offset, c_buffer,
                                     n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                                    program, true, c_rotated, false);
+                                    true, c_rotated, false);
     eventWaitList.push_back(eventProcessC);
     if (ErrorIn(status)) { return status; }
 
     // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
     try {
-      auto kernel = Kernel(program, kernel_name);
+      auto kernel = GetKernelFromCache(program, kernel_name);
 
       // Sets the kernel arguments
       auto complex_beta = T{beta, static_cast<U>(0.0)};
@@ -182,10 +192,10 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
 
       // Computes the global and local thread sizes
       auto global = std::vector<size_t>{
-        (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-        (n_ceiled * db_["NDIMC"]) / db_["NWG"]
+        (n_ceiled * db_[kMDIMC]) / db_[kMWG],
+        (n_ceiled * db_[kNDIMC]) / db_[kNWG]
       };
-      auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+      auto local = std::vector<size_t>{db_[kMDIMC], db_[kNDIMC]};
 
       // Launches the kernel
       auto eventKernel1 = Event();
@@ -213,7 +223,7 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
       status = PadCopyTransposeMatrix(event_, eventWaitList,
                                       n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
                                       n, n, c_ld, c_offset, c_buffer,
-                                      program, false, c_rotated, false, upper, lower, true);
+                                      false, c_rotated, false, upper, lower, true);
       if (ErrorIn(status)) { return status; }
 
       // Successfully finished the computation
@@ -224,6 +234,17 @@ StatusCode Xher2k<T,U>::DoHer2k(const Layout layout, const Triangle triangle, co
 
 // =================================================================================================
 
+// Computes the size of the workspace, counting all temporary matrices (see 'GemmWorkspaceSize')
+template <typename T, typename U>
+size_t Xher2k<T,U>::Her2kWorkspaceSize(const Layout, const Triangle, const Transpose,
+                                       const size_t n, const size_t k) {
+  const auto n_ceiled = Ceil(n, db_[kNWG]);
+  const auto k_ceiled = Ceil(k, db_[kKWG]);
+  return 4*WorkspaceBytes(k_ceiled*n_ceiled) + WorkspaceBytes(n_ceiled*n_ceiled);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xher2k<float2,float>;
 template class Xher2k<double2,double>;
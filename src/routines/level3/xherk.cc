@@ -30,12 +30,22 @@ template <typename T, typename U>
 Xherk<T,U>::Xherk(Queue &queue, EventPointer event, const std::string &name):
     Routine<T>(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm"}, precision_) {
   source_string_ =
+    #include "../../kernels/level3/xgemm_part1.opencl"
+    #include "../../kernels/level3/xgemm_part2.opencl"
+  ;
+
+  // The pre/post-processing kernels are compiled separately and only when they are needed
+  sub_program_sources_["Copy"] =
     #include "../../kernels/level3/copy.opencl"
+  ;
+  sub_program_sources_["Pad"] =
     #include "../../kernels/level3/pad.opencl"
+  ;
+  sub_program_sources_["Transpose"] =
     #include "../../kernels/level3/transpose.opencl"
+  ;
+  sub_program_sources_["Padtranspose"] =
     #include "../../kernels/level3/padtranspose.opencl"
-    #include "../../kernels/level3/xgemm_part1.opencl"
-    #include "../../kernels/level3/xgemm_part2.opencl"
   ;
 }
 
@@ -80,8 +90,8 @@ StatusCode Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, cons
   if (ErrorIn(status)) { return status; }
 
   // Calculates the ceiled versions of n and k
-  auto n_ceiled = Ceil(n, db_["NWG"]);
-  auto k_ceiled = Ceil(k, db_["KWG"]);
+  auto n_ceiled = Ceil(n, db_[kNWG]);
+  auto k_ceiled = Ceil(k, db_[kKWG]);
 
   // Decides which kernel to run: the upper-triangular or lower-triangular version
   auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
@@ -99,9 +109,9 @@ StatusCode Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, cons
                      a_rotated == false && b_conjugate == false;
 
     // Creates the temporary matrices
-    auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto b_temp = (b_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
+    auto a_temp = (a_no_temp) ? a_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto b_temp = (b_no_temp) ? a_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto c_temp = GetTempBuffer(n_ceiled*n_ceiled);
 
     // Events of all kernels (including pre/post processing kernels)
     auto eventWaitList = std::vector<Event>();
@@ -115,7 +125,7 @@ StatusCode Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, cons
       status = PadCopyTransposeMatrix(eventProcessA.pointer(), emptyEventList,
                                       a_one, a_two, a_ld, a_offset, a_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, a_temp,
-                                      program, true, a_rotated, a_conjugate);
+                                      true, a_rotated, a_conjugate);
       eventWaitList.push_back(eventProcessA);
       if (ErrorIn(status)) { return status; }
     }
@@ -124,7 +134,7 @@ StatusCode Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, cons
       status = PadCopyTransposeMatrix(eventProcessB.pointer(), emptyEventList,
                                       a_one, a_two, a_ld, a_offset, a_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, b_temp,
-                                      program, true, a_rotated, b_conjugate);
+                                      true, a_rotated, b_conjugate);
       eventWaitList.push_back(eventProcessB);
       if (ErrorIn(status)) { return status; }
     }
@@ -135,13 +145,13 @@ StatusCode Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, cons
     status = PadCopyTransposeMatrix(eventProcessC.pointer(), emptyEventList,
                                     n, n, c_ld, c_offset, c_buffer,
                                     n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                                    program, true, c_rotated, false);
+                                    true, c_rotated, false);
     eventWaitList.push_back(eventProcessC);
     if (ErrorIn(status)) { return status; }
 
     // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
     try {
-      auto kernel = Kernel(program, kernel_name);
+      auto kernel = GetKernelFromCache(program, kernel_name);
 
       // Sets the kernel arguments
       auto complex_alpha = T{alpha, static_cast<U>(0.0)};
@@ -156,10 +166,10 @@ StatusCode Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, cons
 
       // Computes the global and local thread sizes
       auto global = std::vector<size_t>{
-        (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-        (n_ceiled * db_["NDIMC"]) / db_["NWG"]
+        (n_ceiled * db_[kMDIMC]) / db_[kMWG],
+        (n_ceiled * db_[kNDIMC]) / db_[kNWG]
       };
-      auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+      auto local = std::vector<size_t>{db_[kMDIMC], db_[kNDIMC]};
 
       // Launches the kernel
       auto eventKernel = Event();
@@ -173,7 +183,7 @@ StatusCode Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, cons
       status = PadCopyTransposeMatrix(event_, eventWaitList,
                                       n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
                                       n, n, c_ld, c_offset, c_buffer,
-                                      program, false, c_rotated, false, upper, lower, true);
+                                      false, c_rotated, false, upper, lower, true);
       if (ErrorIn(status)) { return status; }
 
       // Successfully finished the computation
@@ -184,6 +194,17 @@ StatusCode Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, cons
 
 // =================================================================================================
 
+// Computes the size of the workspace, counting all temporary matrices (see 'GemmWorkspaceSize')
+template <typename T, typename U>
+size_t Xherk<T,U>::HerkWorkspaceSize(const Layout, const Triangle, const Transpose,
+                                     const size_t n, const size_t k) {
+  const auto n_ceiled = Ceil(n, db_[kNWG]);
+  const auto k_ceiled = Ceil(k, db_[kKWG]);
+  return 2*WorkspaceBytes(k_ceiled*n_ceiled) + WorkspaceBytes(n_ceiled*n_ceiled);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xherk<float2,float>;
 template class Xherk<double2,double>;
@@ -54,15 +54,19 @@ StatusCode Xsymm<T>::DoSymm(const Layout layout, const Side side, const Triangle
                    (triangle == Triangle::kLower && layout == Layout::kRowMajor));
   auto kernel_name = (is_upper) ? "SymmUpperToSquared" : "SymmLowerToSquared";
 
+  // Retrieves the separately compiled program holding the symmetric-to-squared kernels
+  auto program = std::shared_ptr<Program>();
+  status = SetUpSubProgram("Pad", program);
+  if (ErrorIn(status)) { return status; }
+
   // Temporary buffer for a copy of the symmetric matrix
   try {
-    auto temp_symm = Buffer<T>(context_, k*k);
+    auto temp_symm = GetTempBuffer(k*k);
 
     // Creates a general matrix from the symmetric matrix to be able to run the regular Xgemm
     // routine afterwards
     try {
-      const auto program = GetProgramFromCache();
-      auto kernel = Kernel(program, kernel_name);
+      auto kernel = GetKernelFromCache(*program, kernel_name);
 
       // Sets the arguments for the symmetric-to-squared kernel
       kernel.SetArgument(0, static_cast<int>(k));
@@ -76,9 +80,9 @@ StatusCode Xsymm<T>::DoSymm(const Layout layout, const Side side, const Triangle
 
       // Uses the common padding kernel's thread configuration. This is allowed, since the
       // symmetric-to-squared kernel uses the same parameters.
-      auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                        Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-      auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+      auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_[kPAD_WPTX]), db_[kPAD_DIMX]),
+                                        Ceil(CeilDiv(k, db_[kPAD_WPTY]), db_[kPAD_DIMY])};
+      auto local = std::vector<size_t>{db_[kPAD_DIMX], db_[kPAD_DIMY]};
       auto kernelEvent = Event();
       status = RunKernel(kernel, global, local, kernelEvent.pointer());
       if (ErrorIn(status)) { return status; }
@@ -126,6 +130,17 @@ StatusCode Xsymm<T>::DoSymm(const Layout layout, const Side side, const Triangle
 
 // =================================================================================================
 
+// Computes the size of the workspace: the squared copy of the symmetric matrix plus the workspace
+// of the Xgemm routine
+template <typename T>
+size_t Xsymm<T>::SymmWorkspaceSize(const Layout layout, const Side side, const Triangle,
+                                   const size_t m, const size_t n) {
+  const auto k = (side == Side::kLeft) ? m : n;
+  return WorkspaceBytes(k*k) + GemmWorkspaceSize(layout, Transpose::kNo, Transpose::kNo, m, n, k);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xsymm<float>;
 template class Xsymm<double>;
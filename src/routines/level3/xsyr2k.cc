@@ -32,12 +32,22 @@ template <typename T>
 Xsyr2k<T>::Xsyr2k(Queue &queue, EventPointer event, const std::string &name):
     Routine<T>(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm"}, precision_) {
   source_string_ =
+    #include "../../kernels/level3/xgemm_part1.opencl"
+    #include "../../kernels/level3/xgemm_part2.opencl"
+  ;
+
+  // The pre/post-processing kernels are compiled separately and only when they are needed
+  sub_program_sources_["Copy"] =
     #include "../../kernels/level3/copy.opencl"
+  ;
+  sub_program_sources_["Pad"] =
     #include "../../kernels/level3/pad.opencl"
+  ;
+  sub_program_sources_["Transpose"] =
     #include "../../kernels/level3/transpose.opencl"
+  ;
+  sub_program_sources_["Padtranspose"] =
     #include "../../kernels/level3/padtranspose.opencl"
-    #include "../../kernels/level3/xgemm_part1.opencl"
-    #include "../../kernels/level3/xgemm_part2.opencl"
   ;
 }
 
@@ -81,8 +91,8 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
   if (ErrorIn(status)) { return status; }
 
   // Calculates the ceiled versions of n and k
-  auto n_ceiled = Ceil(n, db_["NWG"]);
-  auto k_ceiled = Ceil(k, db_["KWG"]);
+  auto n_ceiled = Ceil(n, db_[kNWG]);
+  auto k_ceiled = Ceil(k, db_[kKWG]);
 
   // Decides which kernel to run: the upper-triangular or lower-triangular version
   auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
@@ -100,9 +110,9 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
                      ab_rotated == false;
 
     // Creates the temporary matrices
-    auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
+    auto a_temp = (a_no_temp) ? a_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto b_temp = (b_no_temp) ? b_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto c_temp = GetTempBuffer(n_ceiled*n_ceiled);
 
     // Events of all kernels (including pre/post processing kernels)
     auto eventWaitList = std::vector<Event>();
@@ -116,7 +126,7 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
       status = PadCopyTransposeMatrix(eventProcessA.pointer(), emptyEventList,
                                       ab_one, ab_two, a_ld, a_offset, a_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, a_temp,
-                                      program, true, ab_rotated, false);
+                                      true, ab_rotated, false);
       if (ErrorIn(status)) { return status; }
       eventWaitList.push_back(eventProcessA);
     }
@@ -125,7 +135,7 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
       status = PadCopyTransposeMatrix(eventProcessB.pointer(), emptyEventList,
                                       ab_one, ab_two, b_ld, b_offset, b_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, b_temp,
-                                      program, true, ab_rotated, false);
+                                      true, ab_rotated, false);
       if (ErrorIn(status)) { return status; }
       eventWaitList.push_back(eventProcessB);
     }
@@ -136,13 +146,13 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
     status = PadCopyTransposeMatrix(eventProcessC.pointer(), emptyEventList,
                                     n, n, c_ld, c_offset, c_buffer,
                                     n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                                    program, true, c_rotated, false);
+                                    true, c_rotated, false);
     if (ErrorIn(status)) { return status; }
     eventWaitList.push_back(eventProcessC);
 
     // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
     try {
-      auto kernel = Kernel(program, kernel_name);
+      auto kernel = GetKernelFromCache(program, kernel_name);
 
       // Sets the kernel arguments
       kernel.SetArgument(0, static_cast<int>(n_ceiled));
@@ -155,10 +165,10 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
 
       // Computes the global and local thread sizes
       auto global = std::vector<size_t>{
-        (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-        (n_ceiled * db_["NDIMC"]) / db_["NWG"]
+        (n_ceiled * db_[kMDIMC]) / db_[kMWG],
+        (n_ceiled * db_[kNDIMC]) / db_[kNWG]
       };
-      auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+      auto local = std::vector<size_t>{db_[kMDIMC], db_[kNDIMC]};
 
       // Launches the kernel
       auto eventKernel1 = Event();
@@ -184,7 +194,7 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
       status = PadCopyTransposeMatrix(event_, eventWaitList,
                                       n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
                                       n, n, c_ld, c_offset, c_buffer,
-                                      program, false, c_rotated, false, upper, lower, false);
+                                      false, c_rotated, false, upper, lower, false);
       if (ErrorIn(status)) { return status; }
 
       // Successfully finished the computation
@@ -195,6 +205,17 @@ StatusCode Xsyr2k<T>::DoSyr2k(const Layout layout, const Triangle triangle, cons
 
 // =================================================================================================
 
+// Computes the size of the workspace, counting all temporary matrices (see 'GemmWorkspaceSize')
+template <typename T>
+size_t Xsyr2k<T>::Syr2kWorkspaceSize(const Layout, const Triangle, const Transpose,
+                                     const size_t n, const size_t k) {
+  const auto n_ceiled = Ceil(n, db_[kNWG]);
+  const auto k_ceiled = Ceil(k, db_[kKWG]);
+  return 2*WorkspaceBytes(k_ceiled*n_ceiled) + WorkspaceBytes(n_ceiled*n_ceiled);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xsyr2k<float>;
 template class Xsyr2k<double>;
@@ -32,12 +32,22 @@ template <typename T>
 Xsyrk<T>::Xsyrk(Queue &queue, EventPointer event, const std::string &name):
     Routine<T>(queue, event, name, {"Copy","Pad","Transpose","Padtranspose","Xgemm"}, precision_) {
   source_string_ =
+    #include "../../kernels/level3/xgemm_part1.opencl"
+    #include "../../kernels/level3/xgemm_part2.opencl"
+  ;
+
+  // The pre/post-processing kernels are compiled separately and only when they are needed
+  sub_program_sources_["Copy"] =
     #include "../../kernels/level3/copy.opencl"
+  ;
+  sub_program_sources_["Pad"] =
     #include "../../kernels/level3/pad.opencl"
+  ;
+  sub_program_sources_["Transpose"] =
     #include "../../kernels/level3/transpose.opencl"
+  ;
+  sub_program_sources_["Padtranspose"] =
     #include "../../kernels/level3/padtranspose.opencl"
-    #include "../../kernels/level3/xgemm_part1.opencl"
-    #include "../../kernels/level3/xgemm_part2.opencl"
   ;
 }
 
@@ -77,8 +87,8 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
   if (ErrorIn(status)) { return status; }
 
   // Calculates the ceiled versions of n and k
-  auto n_ceiled = Ceil(n, db_["NWG"]);
-  auto k_ceiled = Ceil(k, db_["KWG"]);
+  auto n_ceiled = Ceil(n, db_[kNWG]);
+  auto k_ceiled = Ceil(k, db_[kKWG]);
 
   // Decides which kernel to run: the upper-triangular or lower-triangular version
   auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
@@ -94,8 +104,8 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
                      a_rotated == false;
 
     // Creates the temporary matrices
-    auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, k_ceiled*n_ceiled);
-    auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
+    auto a_temp = (a_no_temp) ? a_buffer : GetTempBuffer(k_ceiled*n_ceiled);
+    auto c_temp = GetTempBuffer(n_ceiled*n_ceiled);
 
     // Events of all kernels (including pre/post processing kernels)
     auto eventWaitList = std::vector<Event>();
@@ -109,7 +119,7 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
       status = PadCopyTransposeMatrix(eventProcessA.pointer(), emptyEventList,
                                       a_one, a_two, a_ld, a_offset, a_buffer,
                                       n_ceiled, k_ceiled, n_ceiled, 0, a_temp,
-                                      program, true, a_rotated, false);
+                                      true, a_rotated, false);
       if (ErrorIn(status)) { return status; }
       eventWaitList.push_back(eventProcessA);
     }
@@ -120,13 +130,13 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
     status = PadCopyTransposeMatrix(eventProcessC.pointer(), emptyEventList,
                                     n, n, c_ld, c_offset, c_buffer,
                                     n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
-                                    program, true, c_rotated, false);
+                                    true, c_rotated, false);
     if (ErrorIn(status)) { return status; }
     eventWaitList.push_back(eventProcessC);
 
     // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
     try {
-      auto kernel = Kernel(program, kernel_name);
+      auto kernel = GetKernelFromCache(program, kernel_name);
 
       // Sets the kernel arguments
       kernel.SetArgument(0, static_cast<int>(n_ceiled));
@@ -139,10 +149,10 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
 
       // Computes the global and local thread sizes
       auto global = std::vector<size_t>{
-        (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-        (n_ceiled * db_["NDIMC"]) / db_["NWG"]
+        (n_ceiled * db_[kMDIMC]) / db_[kMWG],
+        (n_ceiled * db_[kNDIMC]) / db_[kNWG]
       };
-      auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+      auto local = std::vector<size_t>{db_[kMDIMC], db_[kNDIMC]};
 
       // Launches the kernel
       auto eventKernel = Event();
@@ -156,7 +166,7 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
       status = PadCopyTransposeMatrix(event_, eventWaitList,
                                       n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
                                       n, n, c_ld, c_offset, c_buffer,
-                                      program, false, c_rotated, false, upper, lower, false);
+                                      false, c_rotated, false, upper, lower, false);
       if (ErrorIn(status)) { return status; }
 
 
@@ -168,6 +178,17 @@ StatusCode Xsyrk<T>::DoSyrk(const Layout layout, const Triangle triangle, const
 
 // =================================================================================================
 
+// Computes the size of the workspace, counting all temporary matrices (see 'GemmWorkspaceSize')
+template <typename T>
+size_t Xsyrk<T>::SyrkWorkspaceSize(const Layout, const Triangle, const Transpose,
+                                   const size_t n, const size_t k) {
+  const auto n_ceiled = Ceil(n, db_[kNWG]);
+  const auto k_ceiled = Ceil(k, db_[kKWG]);
+  return WorkspaceBytes(k_ceiled*n_ceiled) + WorkspaceBytes(n_ceiled*n_ceiled);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xsyrk<float>;
 template class Xsyrk<double>;
@@ -0,0 +1,112 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xconvert class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/levelx/xconvert.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The routine uses the single-precision parameters
+// of the level-1 routines.
+Xconvert::Xconvert(Queue &queue, EventPointer event, const std::string &name):
+    Routine<float>(queue, event, name, {"Xaxpy"}, Precision::kSingle) {
+  source_string_ =
+    #include "../../kernels/level1/xconvert.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// Converts from single-precision to half-precision. The validity tests only depend on the sizes of
+// the buffers in bytes, so the half-precision buffer is viewed as a single-precision buffer here.
+StatusCode Xconvert::DoConvertFloatToHalf(const size_t n,
+                                          const Buffer<float> &x_buffer, const size_t x_offset,
+                                          const size_t x_inc,
+                                          const Buffer<half> &y_buffer, const size_t y_offset,
+                                          const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // Tests the vectors for validity
+  auto status = TestVectorX(n, x_buffer, x_offset, x_inc, sizeof(float));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(n, Buffer<float>(y_buffer()), y_offset, y_inc, sizeof(half));
+  if (ErrorIn(status)) { return status; }
+
+  // Runs the conversion
+  return RunConvertKernel("XconvertFloatToHalf", n, x_buffer(), x_offset, x_inc,
+                          y_buffer(), y_offset, y_inc);
+}
+
+// As above, but now from half-precision to single-precision
+StatusCode Xconvert::DoConvertHalfToFloat(const size_t n,
+                                          const Buffer<half> &x_buffer, const size_t x_offset,
+                                          const size_t x_inc,
+                                          const Buffer<float> &y_buffer, const size_t y_offset,
+                                          const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { return StatusCode::kInvalidDimension; }
+
+  // Tests the vectors for validity
+  auto status = TestVectorX(n, Buffer<float>(x_buffer()), x_offset, x_inc, sizeof(half));
+  if (ErrorIn(status)) { return status; }
+  status = TestVectorY(n, y_buffer, y_offset, y_inc, sizeof(float));
+  if (ErrorIn(status)) { return status; }
+
+  // Runs the conversion
+  return RunConvertKernel("XconvertHalfToFloat", n, x_buffer(), x_offset, x_inc,
+                          y_buffer(), y_offset, y_inc);
+}
+
+// =================================================================================================
+
+// Launches one of the two conversion kernels, which have the same arguments
+StatusCode Xconvert::RunConvertKernel(const std::string &kernel_name, const size_t n,
+                                      const cl_mem x_buffer, const size_t x_offset,
+                                      const size_t x_inc,
+                                      const cl_mem y_buffer, const size_t y_offset,
+                                      const size_t y_inc) {
+
+  // Retrieves the kernel from the compiled binary
+  try {
+    const auto program = GetProgramFromCache();
+    auto kernel = GetKernelFromCache(program, kernel_name);
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer);
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, y_buffer);
+    kernel.SetArgument(5, static_cast<int>(y_offset));
+    kernel.SetArgument(6, static_cast<int>(y_inc));
+
+    // Launches the kernel
+    auto n_ceiled = Ceil(n, db_[kWGS]*db_[kWPT]);
+    auto global = std::vector<size_t>{n_ceiled/db_[kWPT]};
+    auto local = std::vector<size_t>{db_[kWGS]};
+    auto status = RunKernel(kernel, global, local, event_);
+    if (ErrorIn(status)) { return status; }
+
+    // Successfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+} // namespace clblast
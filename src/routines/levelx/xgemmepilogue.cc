@@ -0,0 +1,105 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmEpilogue class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/levelx/xgemmepilogue.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The routine's name enables the epilogue in the
+// Xgemm kernel (see 'ROUTINE_GEMMEPILOGUE' in xgemm_part2.opencl).
+template <typename T>
+XgemmEpilogue<T>::XgemmEpilogue(Queue &queue, EventPointer event, const std::string &name):
+    Xgemm<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine. This tests the vectors of the epilogue and then runs the regular GEMM routine,
+// of which the kernel applies the epilogue. Problems which would otherwise be computed by the
+// direct kernel are computed by the regular kernel as well.
+template <typename T>
+StatusCode XgemmEpilogue<T>::DoGemmEpilogue(const Layout layout,
+                                            const Transpose a_transpose,
+                                            const Transpose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const T alpha,
+                                            const Buffer<T> &a_buffer, const size_t a_offset,
+                                            const size_t a_ld,
+                                            const Buffer<T> &b_buffer, const size_t b_offset,
+                                            const size_t b_ld,
+                                            const T beta,
+                                            const Buffer<T> &c_buffer, const size_t c_offset,
+                                            const size_t c_ld,
+                                            const Bias bias, const Buffer<T> &bias_buffer,
+                                            const size_t bias_offset,
+                                            const Activation activation,
+                                            const Buffer<T> &row_scale_buffer,
+                                            const size_t row_scale_offset,
+                                            const Buffer<T> &col_scale_buffer,
+                                            const size_t col_scale_offset) {
+
+  // Tests the vectors of the epilogue for validity. The scale vectors are optional.
+  if (bias != Bias::kNoBias) {
+    const auto bias_size = (bias == Bias::kRowBias) ? m : n;
+    auto status = TestEpilogueVector(bias_size, bias_buffer, bias_offset);
+    if (ErrorIn(status)) { return status; }
+  }
+  if (row_scale_buffer() != nullptr) {
+    auto status = TestEpilogueVector(m, row_scale_buffer, row_scale_offset);
+    if (ErrorIn(status)) { return status; }
+  }
+  if (col_scale_buffer() != nullptr) {
+    auto status = TestEpilogueVector(n, col_scale_buffer, col_scale_offset);
+    if (ErrorIn(status)) { return status; }
+  }
+
+  // Runs the regular routine with the epilogue enabled
+  const auto epilogue = GemmEpilogueArguments{bias, bias_buffer(), bias_offset, activation,
+                                              row_scale_buffer(), row_scale_offset,
+                                              col_scale_buffer(), col_scale_offset};
+  epilogue_ = &epilogue;
+  const auto status = DoGemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                             a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+                             beta, c_buffer, c_offset, c_ld);
+  epilogue_ = nullptr;
+  return status;
+}
+
+// =================================================================================================
+
+// Tests a vector of the epilogue for validity: whether it is a valid OpenCL buffer with sufficient
+// storage space for 'n' values after its offset
+template <typename T>
+StatusCode XgemmEpilogue<T>::TestEpilogueVector(const size_t n, const Buffer<T> &buffer,
+                                                const size_t offset) const {
+  try {
+    if (buffer() == nullptr || buffer.GetSize() < (n + offset)*sizeof(T)) {
+      return StatusCode::kInvalidEpilogueBuffer;
+    }
+  } catch (...) { return StatusCode::kInvalidEpilogueBuffer; }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmEpilogue<half>;
+template class XgemmEpilogue<float>;
+template class XgemmEpilogue<double>;
+
+// =================================================================================================
+} // namespace clblast
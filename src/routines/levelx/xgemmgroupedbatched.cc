@@ -0,0 +1,148 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmGroupedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "internal/routines/levelx/xgemmgroupedbatched.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// The number of integers describing a single problem of the group (see the kernel)
+constexpr auto kGroupedProblemSize = size_t{9};
+
+// The number of workgroups per compute unit of the grouped kernel. These iterate over all tiles of
+// all problems, since the total number of tiles is only known on the device.
+constexpr auto kGroupedWorkGroupsPerComputeUnit = size_t{16};
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision XgemmGroupedBatched<float>::precision_ = Precision::kSingle;
+template <> const Precision XgemmGroupedBatched<double>::precision_ = Precision::kDouble;
+template <> const Precision XgemmGroupedBatched<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision XgemmGroupedBatched<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The grouped kernel uses the parameters of the
+// batched direct kernel, since both compute many small problems.
+template <typename T>
+XgemmGroupedBatched<T>::XgemmGroupedBatched(Queue &queue, EventPointer event,
+                                            const std::string &name):
+    Routine<T>(queue, event, name, {"XgemmDirectBatched"}, precision_) {
+  source_string_ =
+    #include "../../kernels/level3/xgemm_direct.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine. The problems are computed by two kernel launches: the first computes the prefix
+// sum of the number of tiles of each problem, which the second uses to map its workgroups to the
+// tiles of the problems. The matrices are read in place, so there are no temporary matrices nor
+// pre/post-processing kernels. All per-problem arguments stay on the device.
+template <typename T>
+StatusCode XgemmGroupedBatched<T>::DoGemmGroupedBatched(const Layout layout,
+                                                        const Transpose a_transpose,
+                                                        const Transpose b_transpose,
+                                                        const size_t group_count,
+                                                        const Buffer<int> &problems_buffer,
+                                                        const Buffer<T> &alphas_buffer,
+                                                        const Buffer<T> &betas_buffer,
+                                                        const Buffer<T> &a_buffer,
+                                                        const Buffer<T> &b_buffer,
+                                                        const Buffer<T> &c_buffer) {
+
+  // Makes sure the group is not empty
+  if (group_count == 0) { return StatusCode::kInvalidBatchCount; }
+
+  // Tests the buffers of the per-problem arguments for validity. The matrices themselves cannot be
+  // tested, since their sizes are only known on the device.
+  try {
+    if (problems_buffer.GetSize() < group_count*kGroupedProblemSize*sizeof(int) ||
+        alphas_buffer.GetSize() < group_count*sizeof(T) ||
+        betas_buffer.GetSize() < group_count*sizeof(T)) {
+      return StatusCode::kInvalidGroupBuffer;
+    }
+  } catch (...) { return StatusCode::kInvalidGroupBuffer; }
+
+  // Computes whether or not the matrices are transposed in memory (see the Xgemm routine)
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+
+  // Retrieves the proper kernels from the compiled binary
+  try {
+    const auto program = GetProgramFromCache();
+    auto tiles_kernel = GetKernelFromCache(program, "XgemmDirectGroupedTiles");
+    const auto kernel_name = std::string{"XgemmDirectGrouped"} +
+                             ((a_rotated) ? "T" : "N") + ((b_rotated) ? "T" : "N");
+    auto kernel = GetKernelFromCache(program, kernel_name);
+
+    // Creates the temporary buffer holding the prefix sum of the tile counts and their total
+    auto tile_offsets = pool::GetBuffer<int>(context_, queue_, group_count + 1);
+
+    // Computes the prefix sum of the tile counts in a single workgroup
+    tiles_kernel.SetArgument(0, static_cast<int>(group_count));
+    tiles_kernel.SetArgument(1, problems_buffer());
+    tiles_kernel.SetArgument(2, tile_offsets());
+    auto tiles_global = std::vector<size_t>{db_[kMDIMCD] * db_[kNDIMCD]};
+    auto tiles_local = std::vector<size_t>{db_[kMDIMCD] * db_[kNDIMCD]};
+    auto eventTiles = Event();
+    auto status = RunKernel(tiles_kernel, tiles_global, tiles_local, eventTiles.pointer());
+    if (ErrorIn(status)) { return status; }
+
+    // Sets the arguments of the main kernel
+    kernel.SetArgument(0, static_cast<int>(group_count));
+    kernel.SetArgument(1, problems_buffer());
+    kernel.SetArgument(2, alphas_buffer());
+    kernel.SetArgument(3, betas_buffer());
+    kernel.SetArgument(4, tile_offsets());
+    kernel.SetArgument(5, a_buffer());
+    kernel.SetArgument(6, b_buffer());
+    kernel.SetArgument(7, c_buffer());
+    kernel.SetArgument(8, static_cast<int>(c_rotated));
+    kernel.SetArgument(9, static_cast<int>(a_conjugate));
+    kernel.SetArgument(10, static_cast<int>(b_conjugate));
+
+    // Computes the global and local thread sizes: a fixed number of workgroups, since the total
+    // number of tiles is not known on the host
+    const auto num_groups = device_.ComputeUnits() * kGroupedWorkGroupsPerComputeUnit;
+    auto global = std::vector<size_t>{num_groups * db_[kMDIMCD], db_[kNDIMCD]};
+    auto local = std::vector<size_t>{db_[kMDIMCD], db_[kNDIMCD]};
+
+    // Launches the kernel after the prefix sum has been computed
+    auto eventWaitList = std::vector<Event>{eventTiles};
+    status = RunKernel(kernel, global, local, event_, eventWaitList);
+    if (ErrorIn(status)) { return status; }
+
+    // Successfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kTempBufferAllocFailure; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmGroupedBatched<float>;
+template class XgemmGroupedBatched<double>;
+template class XgemmGroupedBatched<float2>;
+template class XgemmGroupedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,120 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmMixed class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "internal/routines/levelx/xgemmmixed.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The routine uses the direct GEMM kernel and its
+// single-precision parameters. The kernel reads A and B as half-precision because of the routine's
+// name (see 'ROUTINE_GEMMMIXED' in common.opencl).
+XgemmMixed::XgemmMixed(Queue &queue, EventPointer event, const std::string &name):
+    Routine<float>(queue, event, name, {"XgemmDirect"}, Precision::kSingle) {
+  source_string_ =
+    #include "../../kernels/level3/xgemm_direct.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine. The matrices are read in place by the direct kernel, which converts the values
+// of A and B to single-precision when loading them. The accumulation is done in registers in
+// single-precision, so there are no temporary matrices nor pre/post-processing kernels.
+StatusCode XgemmMixed::DoGemmMixed(const Layout layout,
+                                   const Transpose a_transpose, const Transpose b_transpose,
+                                   const size_t m, const size_t n, const size_t k,
+                                   const float alpha,
+                                   const Buffer<half> &a_buffer, const size_t a_offset,
+                                   const size_t a_ld,
+                                   const Buffer<half> &b_buffer, const size_t b_offset,
+                                   const size_t b_ld,
+                                   const float beta,
+                                   const Buffer<float> &c_buffer, const size_t c_offset,
+                                   const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { return StatusCode::kInvalidDimension; }
+
+  // Computes whether or not the matrices are transposed in memory (see the Xgemm routine)
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+
+  // Computes the first and second dimensions of the 3 matrices taking into account whether the
+  // matrices are rotated or not
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+
+  // Tests the three matrices for validity. The tests only depend on the sizes of the buffers in
+  // bytes, so the half-precision buffers are viewed as single-precision buffers here.
+  auto status = TestMatrixA(a_one, a_two, Buffer<float>(a_buffer()), a_offset, a_ld, sizeof(half));
+  if (ErrorIn(status)) { return status; }
+  status = TestMatrixB(b_one, b_two, Buffer<float>(b_buffer()), b_offset, b_ld, sizeof(half));
+  if (ErrorIn(status)) { return status; }
+  status = TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld, sizeof(float));
+  if (ErrorIn(status)) { return status; }
+
+  // Retrieves the proper direct kernel from the compiled binary
+  try {
+    const auto program = GetProgramFromCache();
+    const auto kernel_name = std::string{"XgemmDirect"} + ((a_rotated) ? "T" : "N") +
+                                                          ((b_rotated) ? "T" : "N");
+    auto kernel = GetKernelFromCache(program, kernel_name);
+
+    // Sets the kernel arguments. There is no conjugation for real data-types.
+    kernel.SetArgument(0, static_cast<int>(m));
+    kernel.SetArgument(1, static_cast<int>(n));
+    kernel.SetArgument(2, static_cast<int>(k));
+    kernel.SetArgument(3, alpha);
+    kernel.SetArgument(4, beta);
+    kernel.SetArgument(5, a_buffer());
+    kernel.SetArgument(6, static_cast<int>(a_offset));
+    kernel.SetArgument(7, static_cast<int>(a_ld));
+    kernel.SetArgument(8, b_buffer());
+    kernel.SetArgument(9, static_cast<int>(b_offset));
+    kernel.SetArgument(10, static_cast<int>(b_ld));
+    kernel.SetArgument(11, c_buffer());
+    kernel.SetArgument(12, static_cast<int>(c_offset));
+    kernel.SetArgument(13, static_cast<int>(c_ld));
+    kernel.SetArgument(14, static_cast<int>(c_rotated));
+    kernel.SetArgument(15, 0);
+    kernel.SetArgument(16, 0);
+
+    // Computes the global and local thread sizes: one workgroup per WGD * WGD tile of C
+    auto global = std::vector<size_t>{
+      (Ceil(m, db_[kWGD]) * db_[kMDIMCD]) / db_[kWGD],
+      (Ceil(n, db_[kWGD]) * db_[kNDIMCD]) / db_[kWGD]
+    };
+    auto local = std::vector<size_t>{db_[kMDIMCD], db_[kNDIMCD]};
+
+    // Launches the kernel
+    status = RunKernel(kernel, global, local, event_);
+    if (ErrorIn(status)) { return status; }
+
+    // Successfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,151 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "internal/routines/levelx/xgemmstridedbatched.h"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Specific implementations to get the memory-type based on a template argument
+template <> const Precision XgemmStridedBatched<float>::precision_ = Precision::kSingle;
+template <> const Precision XgemmStridedBatched<double>::precision_ = Precision::kDouble;
+template <> const Precision XgemmStridedBatched<float2>::precision_ = Precision::kComplexSingle;
+template <> const Precision XgemmStridedBatched<double2>::precision_ = Precision::kComplexDouble;
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmStridedBatched<T>::XgemmStridedBatched(Queue &queue, EventPointer event,
+                                            const std::string &name):
+    Routine<T>(queue, event, name, {"XgemmDirectBatched"}, precision_) {
+  source_string_ =
+    #include "../../kernels/level3/xgemm_direct.opencl"
+  ;
+}
+
+// =================================================================================================
+
+// The main routine. The whole batch is computed by a single launch of the direct GEMM kernel, of
+// which the third dimension of the NDRange selects the matrices of the batch. The matrices are
+// read in place, so there are no temporary matrices nor pre/post-processing kernels.
+template <typename T>
+StatusCode XgemmStridedBatched<T>::DoGemmStridedBatched(const Layout layout,
+                                                        const Transpose a_transpose,
+                                                        const Transpose b_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const size_t k,
+                                                        const T alpha,
+                                                        const Buffer<T> &a_buffer,
+                                                        const size_t a_offset, const size_t a_ld,
+                                                        const size_t a_stride,
+                                                        const Buffer<T> &b_buffer,
+                                                        const size_t b_offset, const size_t b_ld,
+                                                        const size_t b_stride,
+                                                        const T beta,
+                                                        const Buffer<T> &c_buffer,
+                                                        const size_t c_offset, const size_t c_ld,
+                                                        const size_t c_stride,
+                                                        const size_t batch_count) {
+
+  // Makes sure all dimensions and the batch count are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { return StatusCode::kInvalidDimension; }
+  if (batch_count == 0) { return StatusCode::kInvalidBatchCount; }
+
+  // Computes whether or not the matrices are transposed in memory (see the Xgemm routine)
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+
+  // Computes the first and second dimensions of the 3 matrices
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+
+  // Tests the matrices for validity. The last matrix of each batch is tested for its buffer size,
+  // which implies that all other matrices of the batch fit as well.
+  const auto last = batch_count - 1;
+  auto status = TestMatrixA(a_one, a_two, a_buffer, a_offset + last*a_stride, a_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestMatrixB(b_one, b_two, b_buffer, b_offset + last*b_stride, b_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+  status = TestMatrixC(c_one, c_two, c_buffer, c_offset + last*c_stride, c_ld, sizeof(T));
+  if (ErrorIn(status)) { return status; }
+
+  // Retrieves the proper kernel from the compiled binary
+  try {
+    const auto program = GetProgramFromCache();
+    const auto kernel_name = std::string{"XgemmDirectStridedBatched"} +
+                             ((a_rotated) ? "T" : "N") + ((b_rotated) ? "T" : "N");
+    auto kernel = GetKernelFromCache(program, kernel_name);
+
+    // Sets the kernel arguments
+    kernel.SetArgument(0, static_cast<int>(m));
+    kernel.SetArgument(1, static_cast<int>(n));
+    kernel.SetArgument(2, static_cast<int>(k));
+    kernel.SetArgument(3, alpha);
+    kernel.SetArgument(4, beta);
+    kernel.SetArgument(5, a_buffer());
+    kernel.SetArgument(6, static_cast<int>(a_offset));
+    kernel.SetArgument(7, static_cast<int>(a_ld));
+    kernel.SetArgument(8, static_cast<int>(a_stride));
+    kernel.SetArgument(9, b_buffer());
+    kernel.SetArgument(10, static_cast<int>(b_offset));
+    kernel.SetArgument(11, static_cast<int>(b_ld));
+    kernel.SetArgument(12, static_cast<int>(b_stride));
+    kernel.SetArgument(13, c_buffer());
+    kernel.SetArgument(14, static_cast<int>(c_offset));
+    kernel.SetArgument(15, static_cast<int>(c_ld));
+    kernel.SetArgument(16, static_cast<int>(c_stride));
+    kernel.SetArgument(17, static_cast<int>(c_rotated));
+    kernel.SetArgument(18, static_cast<int>(a_conjugate));
+    kernel.SetArgument(19, static_cast<int>(b_conjugate));
+
+    // Computes the global and local thread sizes: one workgroup per WGD * WGD tile of each C matrix
+    auto global = std::vector<size_t>{
+      (Ceil(m, db_[kWGD]) * db_[kMDIMCD]) / db_[kWGD],
+      (Ceil(n, db_[kWGD]) * db_[kNDIMCD]) / db_[kWGD],
+      batch_count
+    };
+    auto local = std::vector<size_t>{db_[kMDIMCD], db_[kNDIMCD], 1};
+
+    // Launches the kernel
+    status = RunKernel(kernel, global, local, event_);
+    if (ErrorIn(status)) { return status; }
+
+    // Successfully finished the computation
+    return StatusCode::kSuccess;
+  } catch (...) { return StatusCode::kInvalidKernel; }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmStridedBatched<float>;
+template class XgemmStridedBatched<double>;
+template class XgemmStridedBatched<float2>;
+template class XgemmStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -49,6 +49,7 @@ class TuneXgemm {
   static size_t DefaultN() { return 1024; }
   static size_t DefaultK() { return 1024; }
   static double DefaultFraction() { return 2048.0; }
+  static size_t DefaultBatchCount() { return 1; } // N/A for this kernel
 
   // Describes how to obtain the sizes of the buffers
   static size_t GetSizeX(const Arguments<T> &) { return 1; } // N/A for this kernel
@@ -74,6 +75,7 @@ class TuneXgemm {
     tuner.AddParameter(id, "STRN", {0, 1});
     tuner.AddParameter(id, "SA", {0, 1});
     tuner.AddParameter(id, "SB", {0, 1});
+    tuner.AddParameter(id, "DBUF", {0, 1});
   }
 
   // Sets the constraints
@@ -92,15 +94,20 @@ class TuneXgemm {
     // KWG has to be a multiple of KDIMA = ((MDIMC*NDIMC)/(MDIMA)) and KDIMB = (...)
     tuner.AddConstraint(id, MultipleOfXMulYDivZ, {"KWG", "MDIMC", "NDIMC", "MDIMA"});
     tuner.AddConstraint(id, MultipleOfXMulYDivZ, {"KWG", "MDIMC", "NDIMC", "NDIMB"});
+    // Double-buffering only applies to matrices cached in local memory
+    auto UsesLocalMemory = [] (std::vector<size_t> v) {
+      return v[0] == 0 || v[1] == 1 || v[2] == 1;
+    };
+    tuner.AddConstraint(id, UsesLocalMemory, {"DBUF", "SA", "SB"});
   }
 
-  // Sets the local memory size
+  // Sets the local memory size, which is doubled in case of double-buffering
   static void SetLocalMemorySize(cltune::Tuner &tuner, const size_t id, const Arguments<T> &args) {
     auto LocalMemorySize = [args] (std::vector<size_t> v) {
-      return (((v[0]*v[1]*v[2]/v[3]) + (v[4]*v[5]*v[6]/v[7]))*GetBytes(args.precision));
+      return (((v[0]*v[1]*v[2]/v[3]) + (v[4]*v[5]*v[6]/v[7]))*(v[8] + 1)*GetBytes(args.precision));
     };
     tuner.SetLocalMemoryUsage(id, LocalMemorySize, {"SA", "KWG", "MWG", "VWM",
-                                                    "SB", "KWG", "NWG", "VWN"});
+                                                    "SB", "KWG", "NWG", "VWN", "DBUF"});
   }
 
   // Sets the base thread configuration
@@ -148,7 +155,7 @@ using double2 = clblast::double2;
 // Main function (not within the clblast namespace)
 int main(int argc, char *argv[]) {
   switch(clblast::GetPrecision(argc, argv)) {
-    case clblast::Precision::kHalf: throw std::runtime_error("Unsupported precision mode");
+    case clblast::Precision::kHalf: clblast::Tuner<clblast::TuneXgemm<half>, half>(argc, argv); break;
     case clblast::Precision::kSingle: clblast::Tuner<clblast::TuneXgemm<float>, float>(argc, argv); break;
     case clblast::Precision::kDouble: clblast::Tuner<clblast::TuneXgemm<double>, double>(argc, argv); break;
     case clblast::Precision::kComplexSingle: clblast::Tuner<clblast::TuneXgemm<float2>, float2>(argc, argv); break;
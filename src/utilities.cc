@@ -22,6 +22,24 @@
 namespace clblast {
 // =================================================================================================
 
+// Returns the scalars zero and one
+template <typename T> T ConstantZero() { return static_cast<T>(0.0); }
+template <typename T> T ConstantOne() { return static_cast<T>(1.0); }
+template float ConstantZero<float>();
+template double ConstantZero<double>();
+template float2 ConstantZero<float2>();
+template double2 ConstantZero<double2>();
+template float ConstantOne<float>();
+template double ConstantOne<double>();
+template float2 ConstantOne<float2>();
+template double2 ConstantOne<double2>();
+
+// Specialized versions of the above for half-precision
+template <> half ConstantZero() { return FloatToHalf(0.0f); }
+template <> half ConstantOne() { return FloatToHalf(1.0f); }
+
+// =================================================================================================
+
 // Implements the string conversion using std::to_string if possible
 template <typename T>
 std::string ToString(T value) {
@@ -48,6 +66,12 @@ std::string ToString(double2 value) {
   return real.str()+"+"+imag.str()+"i";
 }
 
+// If not possible directly: special case for half-precision
+template <>
+std::string ToString(half value) {
+  return std::to_string(HalfToFloat(value));
+}
+
 // If not possible directly: special cases for CLBlast data-types
 template <>
 std::string ToString(Layout value) {
@@ -86,6 +110,22 @@ std::string ToString(Diagonal value) {
   }
 }
 template <>
+std::string ToString(Bias value) {
+  switch(value) {
+    case Bias::kNoBias: return ToString(static_cast<int>(value))+" (none)";
+    case Bias::kRowBias: return ToString(static_cast<int>(value))+" (per-row)";
+    case Bias::kColumnBias: return ToString(static_cast<int>(value))+" (per-column)";
+  }
+}
+template <>
+std::string ToString(Activation value) {
+  switch(value) {
+    case Activation::kIdentity: return ToString(static_cast<int>(value))+" (identity)";
+    case Activation::kRelu: return ToString(static_cast<int>(value))+" (relu)";
+    case Activation::kGelu: return ToString(static_cast<int>(value))+" (gelu)";
+  }
+}
+template <>
 std::string ToString(Precision value) {
   switch(value) {
     case Precision::kHalf: return ToString(static_cast<int>(value))+" (half)";
@@ -111,6 +151,9 @@ template <> float ConvertArgument(const char* value) {
 template <> double ConvertArgument(const char* value) {
   return static_cast<double>(std::stod(value));
 }
+template <> half ConvertArgument(const char* value) {
+  return FloatToHalf(static_cast<float>(std::stod(value)));
+}
 template <> float2 ConvertArgument(const char* value) {
   auto val = static_cast<float>(std::stod(value));
   return float2{val, val};
@@ -149,6 +192,7 @@ template int GetArgument<int>(const int, char **, std::string&, const std::strin
 template size_t GetArgument<size_t>(const int, char **, std::string&, const std::string&, const size_t);
 template float GetArgument<float>(const int, char **, std::string&, const std::string&, const float);
 template double GetArgument<double>(const int, char **, std::string&, const std::string&, const double);
+template half GetArgument<half>(const int, char **, std::string&, const std::string&, const half);
 template float2 GetArgument<float2>(const int, char **, std::string&, const std::string&, const float2);
 template double2 GetArgument<double2>(const int, char **, std::string&, const std::string&, const double2);
 template Layout GetArgument<Layout>(const int, char **, std::string&, const std::string&, const Layout);
@@ -156,6 +200,8 @@ template Transpose GetArgument<Transpose>(const int, char **, std::string&, cons
 template Side GetArgument<Side>(const int, char **, std::string&, const std::string&, const Side);
 template Triangle GetArgument<Triangle>(const int, char **, std::string&, const std::string&, const Triangle);
 template Diagonal GetArgument<Diagonal>(const int, char **, std::string&, const std::string&, const Diagonal);
+template Bias GetArgument<Bias>(const int, char **, std::string&, const std::string&, const Bias);
+template Activation GetArgument<Activation>(const int, char **, std::string&, const std::string&, const Activation);
 template Precision GetArgument<Precision>(const int, char **, std::string&, const std::string&, const Precision);
 
 // =================================================================================================
@@ -227,6 +273,16 @@ void PopulateVector(std::vector<double2> &vector) {
   for (auto &element: vector) { element.real(dist(mt)); element.imag(dist(mt)); }
 }
 
+// Specialized versions of the above for half-precision: samples are drawn in single-precision
+template <>
+void PopulateVector(std::vector<half> &vector) {
+  auto lower_limit = static_cast<float>(kTestDataLowerLimit);
+  auto upper_limit = static_cast<float>(kTestDataUpperLimit);
+  std::mt19937 mt(GetRandomSeed());
+  std::uniform_real_distribution<float> dist(lower_limit, upper_limit);
+  for (auto &element: vector) { element = FloatToHalf(dist(mt)); }
+}
+
 // =================================================================================================
 
 // Returns a scalar with a default value
@@ -247,6 +303,12 @@ double2 GetScalar() {
   return {2.0, 0.5};
 }
 
+// Specialized version of the above for half-precision
+template <>
+half GetScalar() {
+  return FloatToHalf(2.0f);
+}
+
 // =================================================================================================
 
 // Rounding functions performing ceiling and division operations
@@ -288,6 +350,10 @@ template <> bool PrecisionSupported<double2>(const Device &device) {
   auto extensions = device.Capabilities();
   return (extensions.find(kKhronosDoublePrecision) == std::string::npos) ? false : true;
 }
+template <> bool PrecisionSupported<half>(const Device &device) {
+  auto extensions = device.Capabilities();
+  return (extensions.find(kKhronosHalfPrecision) == std::string::npos) ? false : true;
+}
 
 // =================================================================================================
 } // namespace clblast
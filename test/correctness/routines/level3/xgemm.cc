@@ -15,6 +15,104 @@
 // Shortcuts to the clblast namespace
 using float2 = clblast::float2;
 using double2 = clblast::double2;
+using Precision = clblast::Precision;
+
+// The parameters of the GEMM routine itself (see 'database/gemm_routine.h'). Their size thresholds
+// are overridden to test code paths which would otherwise not be used for the small test sizes.
+using GemmRoutineParameters = std::vector<std::pair<std::string,size_t>>;
+GemmRoutineParameters GemmRoutine(const size_t min_indirect_size, const size_t splitk_min_k,
+                                  const size_t splitk_ratio, const size_t min_3m_size,
+                                  const size_t min_strassen_size) {
+  return {{"XGEMM_MIN_INDIRECT_SIZE", min_indirect_size}, {"XGEMM_SPLITK_MIN_K", splitk_min_k},
+          {"XGEMM_SPLITK_RATIO", splitk_ratio}, {"XGEMM_MIN_3M_SIZE", min_3m_size},
+          {"XGEMM_MIN_STRASSEN_SIZE", min_strassen_size}};
+}
+
+// Runs the tests of a single precision with overridden parameters of the GEMM routine. Optionally,
+// extra command-line arguments are appended, e.g. to test a specific problem size.
+template <typename T>
+void RunGemmRoutineTests(int argc, char *argv[], const std::string &name,
+                         const Precision precision, const GemmRoutineParameters &parameters,
+                         const std::vector<std::string> &arguments = {}) {
+  clblast::OverrideTuningParameters(argc, argv, "gemm_routine", precision, parameters);
+  clblast::RunTests<clblast::TestXgemm<T>, T, T>(argc, argv, true, name, arguments);
+  clblast::ResetTuningParameters();
+}
+
+// Runs the split-K tests of a single precision: column-major with a large k and small m and n, both
+// with a C matrix which can be used directly (a multiple of the tile sizes) and one which is padded
+template <typename T>
+void RunGemmSplitKTests(int argc, char *argv[], const std::string &name,
+                        const Precision precision) {
+  const auto split_k = GemmRoutine(0, 1024, 4, 0, 0);
+  for (const auto &beta: std::vector<std::vector<std::string>>{{}, {"-beta", "0"}}) {
+    for (const auto &size: std::vector<std::string>{"64", "7"}) {
+      auto arguments = std::vector<std::string>{"-layout", "102", "-transA", "111",
+                                                "-transB", "111", "-m", size, "-n", size,
+                                                "-k", "2053", "-lda", size, "-ldb", "2053",
+                                                "-ldc", size};
+      arguments.insert(arguments.end(), beta.begin(), beta.end());
+      RunGemmRoutineTests<T>(argc, argv, name, precision, split_k, arguments);
+    }
+  }
+}
+
+// Runs the tests of a single precision with a memory budget of the context smaller than a single
+// padded matrix, such that the problem is computed in blocks. The sizes are chosen to require
+// padding, since otherwise no temporary matrices are needed at all in some cases.
+template <typename T>
+void RunGemmBlocksTests(int argc, char *argv[], const std::string &name,
+                        const Precision precision) {
+  const auto budget = std::to_string(32768 * sizeof(T));
+  RunGemmRoutineTests<T>(argc, argv, name, precision, GemmRoutine(0, 1024, 4, 0, 0),
+                         {"-m", "250", "-n", "260", "-k", "270", "-lda", "270", "-ldb", "270",
+                          "-ldc", "270", "-membudget", budget});
+}
+
+// Runs the tests of a complex precision with the 3M algorithm of the fast accuracy mode, which is
+// used for all sizes by lowering its threshold. Since the 3M algorithm is less accurate, the
+// results are compared with larger error margins.
+template <typename T>
+void RunGemm3MTests(int argc, char *argv[], const std::string &name, const Precision precision) {
+  clblast::SetGemmAccuracy(clblast::GemmAccuracy::kFast);
+  clblast::SetErrorMarginFactor(10.0);
+  RunGemmRoutineTests<T>(argc, argv, name, precision, GemmRoutine(384, 1024, 4, 1, 0));
+  clblast::SetErrorMarginFactor(1.0);
+  clblast::SetGemmAccuracy(clblast::GemmAccuracy::kPrecise);
+}
+
+// Runs the tests of a single precision with the Strassen-Winograd recursion of the fast accuracy
+// mode up to the given depth, which is used for the even sizes by lowering its threshold. The odd
+// sizes can't be split, and thus test skipping the recursion.
+template <typename T>
+void RunGemmStrassenTests(int argc, char *argv[], const std::string &name,
+                          const Precision precision, const size_t depth) {
+  clblast::SetGemmAccuracy(clblast::GemmAccuracy::kFast);
+  clblast::SetGemmStrassenDepth(depth);
+  clblast::SetErrorMarginFactor(10.0);
+  RunGemmRoutineTests<T>(argc, argv, name, precision, GemmRoutine(384, 1024, 4, 0, 4));
+  clblast::SetErrorMarginFactor(1.0);
+  clblast::SetGemmStrassenDepth(2);
+  clblast::SetGemmAccuracy(clblast::GemmAccuracy::kPrecise);
+}
+
+// Runs the tests of a single precision with overridden parameters of the Xgemm kernel, e.g. to test
+// its double-buffered local memory. Since only a single kernel family can be overridden at a time,
+// the problem is made just large enough to use the indirect kernel with the default thresholds.
+template <typename T>
+void RunGemmKernelTests(int argc, char *argv[], const std::string &name,
+                        const Precision precision, const size_t dbuf, const size_t sa,
+                        const size_t sb) {
+  const auto parameters = std::vector<std::pair<std::string,size_t>>{
+    {"DBUF", dbuf}, {"KWG", 16}, {"KWI", 2}, {"MDIMA", 8}, {"MDIMC", 8}, {"MWG", 16},
+    {"NDIMB", 8}, {"NDIMC", 8}, {"NWG", 16}, {"SA", sa}, {"SB", sb}, {"STRM", 0}, {"STRN", 0},
+    {"VWM", 1}, {"VWN", 1}};
+  clblast::OverrideTuningParameters(argc, argv, "xgemm", precision, parameters);
+  clblast::RunTests<clblast::TestXgemm<T>, T, T>(argc, argv, true, name,
+                                                 {"-m", "385", "-n", "390", "-k", "395",
+                                                  "-lda", "395", "-ldb", "395", "-ldc", "395"});
+  clblast::ResetTuningParameters();
+}
 
 // Main function (not within the clblast namespace)
 int main(int argc, char *argv[]) {
@@ -22,6 +120,57 @@ int main(int argc, char *argv[]) {
   clblast::RunTests<clblast::TestXgemm<double>, double, double>(argc, argv, true, "DGEMM");
   clblast::RunTests<clblast::TestXgemm<float2>, float2, float2>(argc, argv, true, "CGEMM");
   clblast::RunTests<clblast::TestXgemm<double2>, double2, double2>(argc, argv, true, "ZGEMM");
+  clblast::RunTests<clblast::TestXgemm<half>, half, half>(argc, argv, true, "HGEMM");
+
+  // The regular (indirect) kernel with its pre/post-processing kernels: the test sizes are all
+  // below the default threshold of the direct kernel
+  const auto indirect = GemmRoutine(0, 1024, 4, 0, 0);
+  RunGemmRoutineTests<float>(argc, argv, "SGEMM (indirect)", Precision::kSingle, indirect);
+  RunGemmRoutineTests<double>(argc, argv, "DGEMM (indirect)", Precision::kDouble, indirect);
+  RunGemmRoutineTests<float2>(argc, argv, "CGEMM (indirect)", Precision::kComplexSingle, indirect);
+  RunGemmRoutineTests<double2>(argc, argv, "ZGEMM (indirect)", Precision::kComplexDouble,
+                               indirect);
+  RunGemmRoutineTests<half>(argc, argv, "HGEMM (indirect)", Precision::kHalf, indirect);
+
+  // The double-buffered local memory of the Xgemm kernel, with both and with only one of the
+  // matrices cached in local memory
+  for (const auto &caching: std::vector<std::pair<size_t,size_t>>{{1, 1}, {1, 0}}) {
+    const auto suffix = std::string{" (double-buffered, SA "} + std::to_string(caching.first) +
+                        ", SB " + std::to_string(caching.second) + ")";
+    const auto sa = caching.first;
+    const auto sb = caching.second;
+    RunGemmKernelTests<float>(argc, argv, "SGEMM" + suffix, Precision::kSingle, 1, sa, sb);
+    RunGemmKernelTests<double>(argc, argv, "DGEMM" + suffix, Precision::kDouble, 1, sa, sb);
+    RunGemmKernelTests<float2>(argc, argv, "CGEMM" + suffix, Precision::kComplexSingle, 1, sa, sb);
+    RunGemmKernelTests<double2>(argc, argv, "ZGEMM" + suffix, Precision::kComplexDouble, 1, sa,
+                                sb);
+  }
+
+  // The split-K variant of the indirect kernel, which requires a large k (at least twice the
+  // minimum part size of 1024) and a device with more compute units than work-groups
+  RunGemmSplitKTests<float>(argc, argv, "SGEMM (split-K)", Precision::kSingle);
+  RunGemmSplitKTests<double>(argc, argv, "DGEMM (split-K)", Precision::kDouble);
+  RunGemmSplitKTests<float2>(argc, argv, "CGEMM (split-K)", Precision::kComplexSingle);
+  RunGemmSplitKTests<double2>(argc, argv, "ZGEMM (split-K)", Precision::kComplexDouble);
+
+  // The computation in blocks in case of a memory budget
+  RunGemmBlocksTests<float>(argc, argv, "SGEMM (blocks)", Precision::kSingle);
+  RunGemmBlocksTests<double>(argc, argv, "DGEMM (blocks)", Precision::kDouble);
+  RunGemmBlocksTests<float2>(argc, argv, "CGEMM (blocks)", Precision::kComplexSingle);
+  RunGemmBlocksTests<double2>(argc, argv, "ZGEMM (blocks)", Precision::kComplexDouble);
+
+  // The 3M algorithm for complex GEMMs
+  RunGemm3MTests<float2>(argc, argv, "CGEMM (3M)", Precision::kComplexSingle);
+  RunGemm3MTests<double2>(argc, argv, "ZGEMM (3M)", Precision::kComplexDouble);
+
+  // The Strassen-Winograd recursion with one and with two levels
+  for (const auto depth: {size_t{1}, size_t{2}}) {
+    const auto suffix = " (Strassen, depth " + std::to_string(depth) + ")";
+    RunGemmStrassenTests<float>(argc, argv, "SGEMM" + suffix, Precision::kSingle, depth);
+    RunGemmStrassenTests<double>(argc, argv, "DGEMM" + suffix, Precision::kDouble, depth);
+    RunGemmStrassenTests<float2>(argc, argv, "CGEMM" + suffix, Precision::kComplexSingle, depth);
+    RunGemmStrassenTests<double2>(argc, argv, "ZGEMM" + suffix, Precision::kComplexDouble, depth);
+  }
   return 0;
 }
 
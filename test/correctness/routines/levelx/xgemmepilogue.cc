@@ -0,0 +1,35 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "correctness/testblas.h"
+#include "routines/levelx/xgemmepilogue.h"
+
+// Runs the tests of a single precision with a memory budget of the context smaller than a single
+// padded matrix, such that the problem is computed in blocks, each with its part of the epilogue
+template <typename T>
+void RunBlocksTests(int argc, char *argv[], const std::string &name) {
+  const auto budget = std::to_string(32768 * sizeof(T));
+  clblast::RunTests<clblast::TestXgemmEpilogue<T>, T, T>(argc, argv, true, name,
+      {"-m", "250", "-n", "260", "-k", "270", "-lda", "270", "-ldb", "270", "-ldc", "270",
+       "-membudget", budget});
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunTests<clblast::TestXgemmEpilogue<float>, float, float>(argc, argv, false, "SGEMMEPILOGUE");
+  clblast::RunTests<clblast::TestXgemmEpilogue<double>, double, double>(argc, argv, true, "DGEMMEPILOGUE");
+  clblast::RunTests<clblast::TestXgemmEpilogue<half>, half, half>(argc, argv, true, "HGEMMEPILOGUE");
+  RunBlocksTests<float>(argc, argv, "SGEMMEPILOGUE (blocks)");
+  RunBlocksTests<double>(argc, argv, "DGEMMEPILOGUE (blocks)");
+  return 0;
+}
+
+// =================================================================================================
@@ -20,6 +20,7 @@ namespace clblast {
 // =================================================================================================
 
 // The transpose-options to test with (data-type dependent)
+template <> const std::vector<Transpose> TestBlas<half,half>::kTransposes = {Transpose::kNo, Transpose::kYes};
 template <> const std::vector<Transpose> TestBlas<float,float>::kTransposes = {Transpose::kNo, Transpose::kYes};
 template <> const std::vector<Transpose> TestBlas<double,double>::kTransposes = {Transpose::kNo, Transpose::kYes};
 template <> const std::vector<Transpose> TestBlas<float2,float2>::kTransposes = {Transpose::kNo, Transpose::kYes, Transpose::kConjugate};
@@ -56,13 +57,15 @@ TestBlas<T,U>::TestBlas(int argc, char *argv[], const bool silent,
   auto max_ld = *std::max_element(kMatrixDims.begin(), kMatrixDims.end());
   auto max_matvec = *std::max_element(kMatrixVectorDims.begin(), kMatrixVectorDims.end());
   auto max_offset = *std::max_element(kOffsets.begin(), kOffsets.end());
+  auto max_batch_count = *std::max_element(kBatchCounts.begin(), kBatchCounts.end());
+  auto max_mat_size = std::max(max_mat, max_matvec)*std::max(max_ld, max_matvec);
 
   // Creates test input data
   x_source_.resize(std::max(max_vec, max_matvec)*max_inc + max_offset);
   y_source_.resize(std::max(max_vec, max_matvec)*max_inc + max_offset);
-  a_source_.resize(std::max(max_mat, max_matvec)*std::max(max_ld, max_matvec) + max_offset);
-  b_source_.resize(std::max(max_mat, max_matvec)*std::max(max_ld, max_matvec) + max_offset);
-  c_source_.resize(std::max(max_mat, max_matvec)*std::max(max_ld, max_matvec) + max_offset);
+  a_source_.resize(max_mat_size*max_batch_count + max_offset);
+  b_source_.resize(max_mat_size*max_batch_count + max_offset);
+  c_source_.resize(max_mat_size*max_batch_count + max_offset);
   ap_source_.resize(std::max(max_mat, max_matvec)*std::max(max_mat, max_matvec) + max_offset);
   scalar_source_.resize(std::max(max_mat, max_matvec) + max_offset);
   PopulateVector(x_source_);
@@ -76,6 +79,14 @@ TestBlas<T,U>::TestBlas(int argc, char *argv[], const bool silent,
 
 // ===============================================================================================
 
+// Resizes the input data to (at least) the given size, re-populating it with random values
+template <typename T>
+void ExtendSourceData(std::vector<T> &source, const size_t size) {
+  if (source.size() >= size) { return; }
+  source.resize(size);
+  PopulateVector(source);
+}
+
 // Tests the routine for a wide variety of parameters
 template <typename T, typename U>
 void TestBlas<T,U>::TestRegular(std::vector<Arguments<U>> &test_vector, const std::string &name) {
@@ -85,6 +96,14 @@ void TestBlas<T,U>::TestRegular(std::vector<Arguments<U>> &test_vector, const st
   // Iterates over all the to-be-tested combinations of arguments
   for (auto &args: test_vector) {
 
+    // Extends the input data in case of sizes beyond the test settings (given on the command-line)
+    ExtendSourceData(x_source_, args.x_size);
+    ExtendSourceData(y_source_, args.y_size);
+    ExtendSourceData(a_source_, args.a_size);
+    ExtendSourceData(b_source_, args.b_size);
+    ExtendSourceData(c_source_, args.c_size);
+    ExtendSourceData(ap_source_, args.ap_size);
+
     // Runs the CLBlast code
     auto x_vec2 = Buffer<T>(context_, args.x_size);
     auto y_vec2 = Buffer<T>(context_, args.y_size);
@@ -222,6 +241,7 @@ void TestBlas<T,U>::TestInvalid(std::vector<Arguments<U>> &test_vector, const st
 // =================================================================================================
 
 // Compiles the templated class
+template class TestBlas<half, half>;
 template class TestBlas<float, float>;
 template class TestBlas<double, double>;
 template class TestBlas<float2, float2>;
@@ -56,6 +56,11 @@ class TestBlas: public Tester<T,U> {
   const std::vector<size_t> kOffsets = GetOffsets();
   const std::vector<U> kAlphaValues = GetExampleScalars<U>(full_test_);
   const std::vector<U> kBetaValues = GetExampleScalars<U>(full_test_);
+  const std::vector<size_t> kBatchCounts = { 1, 3 };
+  const std::vector<Bias> kBiases = {Bias::kNoBias, Bias::kRowBias, Bias::kColumnBias};
+  const std::vector<Activation> kActivations = {Activation::kIdentity, Activation::kRelu,
+                                                Activation::kGelu};
+  const std::vector<size_t> kWorkspaces = {0, 1};
 
   // Test settings for the invalid tests
   const std::vector<size_t> kInvalidIncrements = { 0, 1 };
@@ -166,6 +171,10 @@ void RunTests(int argc, char *argv[], const bool silent, const std::string &name
   auto imax_offsets = std::vector<size_t>{args.imax_offset};
   auto alphas = std::vector<U>{args.alpha};
   auto betas = std::vector<U>{args.beta};
+  auto batch_counts = std::vector<size_t>{args.batch_count};
+  auto biases = std::vector<Bias>{args.bias};
+  auto activations = std::vector<Activation>{args.activation};
+  auto workspaces = std::vector<size_t>{args.workspace};
   auto x_sizes = std::vector<size_t>{args.x_size};
   auto y_sizes = std::vector<size_t>{args.y_size};
   auto a_sizes = std::vector<size_t>{args.a_size};
@@ -208,6 +217,10 @@ void RunTests(int argc, char *argv[], const bool silent, const std::string &name
     if (option == kArgImaxOffset) { imax_offsets = tester.kOffsets; }
     if (option == kArgAlpha) { alphas = tester.kAlphaValues; }
     if (option == kArgBeta) { betas = tester.kBetaValues; }
+    if (option == kArgBatchCount) { batch_counts = tester.kBatchCounts; }
+    if (option == kArgBias) { biases = tester.kBiases; }
+    if (option == kArgActivation) { activations = tester.kActivations; }
+    if (option == kArgWorkspace) { workspaces = tester.kWorkspaces; }
 
     if (option == kArgXOffset) { x_sizes = tester.kVecSizes; }
     if (option == kArgYOffset) { y_sizes = tester.kVecSizes; }
@@ -217,6 +230,20 @@ void RunTests(int argc, char *argv[], const bool silent, const std::string &name
     if (option == kArgAPOffset) { ap_sizes = tester.kMatSizes; }
   }
 
+  // The sizes, layouts, and scalars given on the command-line (if any) replace the above lists,
+  // e.g. to test a specific (larger) problem size
+  ms = GetArgumentOrDefaults(argc, argv, kArgM, ms);
+  ns = GetArgumentOrDefaults(argc, argv, kArgN, ns);
+  ks = GetArgumentOrDefaults(argc, argv, kArgK, ks);
+  layouts = GetArgumentOrDefaults(argc, argv, kArgLayout, layouts);
+  a_transposes = GetArgumentOrDefaults(argc, argv, kArgATransp, a_transposes);
+  b_transposes = GetArgumentOrDefaults(argc, argv, kArgBTransp, b_transposes);
+  a_lds = GetArgumentOrDefaults(argc, argv, kArgALeadDim, a_lds);
+  b_lds = GetArgumentOrDefaults(argc, argv, kArgBLeadDim, b_lds);
+  c_lds = GetArgumentOrDefaults(argc, argv, kArgCLeadDim, c_lds);
+  alphas = GetArgumentOrDefaults(argc, argv, kArgAlpha, alphas);
+  betas = GetArgumentOrDefaults(argc, argv, kArgBeta, betas);
+
   // Loops over the test-cases from a data-layout point of view
   for (auto &layout: layouts) { args.layout = layout;
     for (auto &a_transpose: a_transposes) { args.a_transpose = a_transpose;
@@ -250,8 +277,16 @@ void RunTests(int argc, char *argv[], const bool silent, const std::string &name
                                                     for (auto &imax_offset: imax_offsets) { r_args.imax_offset = imax_offset;
                                                       for (auto &alpha: alphas) { r_args.alpha = alpha;
                                                         for (auto &beta: betas) { r_args.beta = beta;
-                                                          C::SetSizes(r_args);
-                                                          regular_test_vector.push_back(r_args);
+                                                          for (auto &batch_count: batch_counts) { r_args.batch_count = batch_count;
+                                                            for (auto &bias: biases) { r_args.bias = bias;
+                                                              for (auto &activation: activations) { r_args.activation = activation;
+                                                                for (auto &workspace: workspaces) { r_args.workspace = workspace;
+                                                                  C::SetSizes(r_args);
+                                                                  regular_test_vector.push_back(r_args);
+                                                                }
+                                                              }
+                                                            }
+                                                          }
                                                         }
                                                       }
                                                     }
@@ -326,6 +361,17 @@ void RunTests(int argc, char *argv[], const bool silent, const std::string &name
   }
 }
 
+// As above, but with extra command-line arguments appended, e.g. to test a specific problem size
+template <typename C, typename T, typename U>
+void RunTests(int argc, char *argv[], const bool silent, const std::string &name,
+              std::vector<std::string> arguments) {
+  auto extended_argv = std::vector<char*>(argv, argv + argc);
+  for (auto &argument: arguments) { extended_argv.push_back(&argument[0]); }
+  const auto extended_argc = static_cast<int>(extended_argv.size());
+  extended_argv.push_back(nullptr);
+  RunTests<C,T,U>(extended_argc, extended_argv.data(), silent, name);
+}
+
 // =================================================================================================
 } // namespace clblast
 
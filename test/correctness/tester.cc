@@ -16,6 +16,9 @@
 #include <string>
 #include <vector>
 #include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
 #include <cmath>
 
 namespace clblast {
@@ -33,6 +36,7 @@ Tester<T,U>::Tester(int argc, char *argv[], const bool silent,
     queue_(Queue(context_, device_)),
     full_test_(CheckArgument(argc, argv, help_, kArgFullTest)),
     verbose_(CheckArgument(argc, argv, help_, kArgVerbose)),
+    memory_budget_(GetArgument(argc, argv, help_, kArgMemoryBudget, size_t{0})),
     error_log_{},
     num_passed_{0},
     num_skipped_{0},
@@ -69,6 +73,9 @@ Tester<T,U>::Tester(int argc, char *argv[], const bool silent,
     throw std::runtime_error("Choose one reference (clBLAS or CBLAS) to test against using the -cblas and -clblas arguments");
   }
 
+  // Limits the temporary memory of the routines (if requested)
+  if (memory_budget_ != 0) { SetMemoryBudget(context_(), memory_budget_); }
+
   // Prints the header
   fprintf(stdout, "* Running on OpenCL device '%s'.\n", device_.Name().c_str());
   fprintf(stdout, "* Starting tests for the %s'%s'%s routine.",
@@ -124,6 +131,9 @@ Tester<T,U>::~Tester() {
       clblasTeardown();
     }
   #endif
+
+  // Removes the memory budget, since a later context might get the same handle
+  if (memory_budget_ != 0) { SetMemoryBudget(context_(), 0); }
 }
 
 // =================================================================================================
@@ -316,6 +326,12 @@ void Tester<T,U>::PrintErrorLog(const std::vector<ErrorLogEntry> &error_log) {
       if (o == kArgCOffset)  { fprintf(stdout, "%s=%zu ", kArgCOffset, entry.args.c_offset);}
       if (o == kArgAPOffset) { fprintf(stdout, "%s=%zu ", kArgAPOffset, entry.args.ap_offset);}
       if (o == kArgDotOffset){ fprintf(stdout, "%s=%zu ", kArgDotOffset, entry.args.dot_offset);}
+      if (o == kArgBatchCount){ fprintf(stdout, "%s=%zu ", kArgBatchCount, entry.args.batch_count);}
+      if (o == kArgBias)     { fprintf(stdout, "%s=%d ", kArgBias,
+                                       static_cast<int>(entry.args.bias));}
+      if (o == kArgActivation){ fprintf(stdout, "%s=%d ", kArgActivation,
+                                        static_cast<int>(entry.args.activation));}
+      if (o == kArgWorkspace){ fprintf(stdout, "%s=%zu ", kArgWorkspace, entry.args.workspace);}
     }
     fprintf(stdout, "\n");
   }
@@ -326,6 +342,10 @@ void Tester<T,U>::PrintErrorLog(const std::vector<ErrorLogEntry> &error_log) {
 // template specialization)
 // =================================================================================================
 
+// The scaling factor of the error margins below
+static double error_margin_factor = 1.0;
+void SetErrorMarginFactor(const double factor) { error_margin_factor = factor; }
+
 // Compares two floating point values and returns whether they are within an acceptable error
 // margin. This replaces GTest's EXPECT_NEAR().
 template <typename T>
@@ -333,8 +353,8 @@ bool TestSimilarity(const T val1, const T val2) {
   const auto difference = std::fabs(val1 - val2);
 
   // Set the allowed error margin for floating-point comparisons
-  constexpr auto kErrorMarginRelative = T(0.025);
-  constexpr auto kErrorMarginAbsolute = T(1.0e-3);
+  const auto kErrorMarginRelative = static_cast<T>(0.025 * error_margin_factor);
+  const auto kErrorMarginAbsolute = static_cast<T>(1.0e-3 * error_margin_factor);
 
   // Shortcut, handles infinities
   if (val1 == val2) {
@@ -369,6 +389,33 @@ bool TestSimilarity(const double2 val1, const double2 val2) {
   return (real && imag);
 }
 
+// Specialisation for half-precision: compares in single-precision with larger error margins, since
+// half-precision has only 11 bits of precision and accumulates rounding errors faster
+template <>
+bool TestSimilarity(const half val1, const half val2) {
+  const auto val1_float = HalfToFloat(val1);
+  const auto val2_float = HalfToFloat(val2);
+  const auto difference = std::fabs(val1_float - val2_float);
+
+  // Set the allowed error margin for floating-point comparisons
+  const auto kErrorMarginRelative = static_cast<float>(0.080 * error_margin_factor);
+  const auto kErrorMarginAbsolute = static_cast<float>(0.15 * error_margin_factor);
+
+  // Shortcut, handles infinities
+  if (val1_float == val2_float) {
+    return true;
+  }
+  // The values are zero or very small: the relative error is less meaningful
+  else if (val1_float == 0 || val2_float == 0 || difference < kErrorMarginAbsolute) {
+    return (difference < kErrorMarginAbsolute);
+  }
+  // Use relative error
+  else {
+    const auto absolute_sum = std::fabs(val1_float) + std::fabs(val2_float);
+    return (difference / absolute_sum) < kErrorMarginRelative;
+  }
+}
+
 // =================================================================================================
 
 // Retrieves a list of example scalar values, used for the alpha and beta arguments for the various
@@ -381,6 +428,10 @@ template <> const std::vector<double> GetExampleScalars(const bool full_test) {
   if (full_test) { return {0.0, 1.0, 3.14}; }
   else { return {3.14}; }
 }
+template <> const std::vector<half> GetExampleScalars(const bool full_test) {
+  if (full_test) { return {FloatToHalf(0.0f), FloatToHalf(1.0f), FloatToHalf(3.14f)}; }
+  else { return {FloatToHalf(3.14f)}; }
+}
 template <> const std::vector<float2> GetExampleScalars(const bool full_test) {
   if (full_test) { return {{0.0f, 0.0f}, {1.0f, 1.3f}, {2.42f, 3.14f}}; }
   else { return {{2.42f, 3.14f}}; }
@@ -392,7 +443,74 @@ template <> const std::vector<double2> GetExampleScalars(const bool full_test) {
 
 // =================================================================================================
 
+// The file holding the overridden tuning parameters, in the current working directory
+static const std::string kOverridesFile = "clblast_test_overrides.json";
+
+// Writes the parameters in the format of the tuner output, for the device selected on the command-
+// line. The device name is escaped, since it becomes a JSON string.
+void OverrideTuningParameters(int argc, char *argv[], const std::string &kernel_family,
+                              const Precision precision,
+                              const std::vector<std::pair<std::string,size_t>> &parameters) {
+  auto dummy = std::string{};
+  const auto platform = Platform(GetArgument(argc, argv, dummy, kArgPlatform, size_t{0}));
+  const auto device = Device(platform, GetArgument(argc, argv, dummy, kArgDevice, size_t{0}));
+  auto device_name = std::string{};
+  for (const auto character: device.Name()) {
+    if (character == '"' || character == '\\') { device_name += '\\'; }
+    device_name += character;
+  }
+  std::ofstream file(kOverridesFile);
+  file << "{\n";
+  file << "  \"kernel_family\": \"" << kernel_family << "\",\n";
+  file << "  \"precision\": \"" << static_cast<int>(precision) << "\",\n";
+  file << "  \"device\": \"" << device_name << "\",\n";
+  file << "  \"results\": [\n";
+  file << "    {\n";
+  file << "      \"time\": 1.0,\n";
+  file << "      \"parameters\": {";
+  for (auto i = size_t{0}; i < parameters.size(); ++i) {
+    file << ((i == 0) ? "" : ",") << "\"" << parameters[i].first << "\": " << parameters[i].second;
+  }
+  file << "}\n";
+  file << "    }\n";
+  file << "  ]\n";
+  file << "}\n";
+  file.close();
+  SetTuningParametersPath(kOverridesFile.c_str());
+}
+
+// Restores the overrides of the environmental variable (if any) and removes the file
+void ResetTuningParameters() {
+  const auto environment = std::getenv("CLBLAST_TUNING_PATH");
+  SetTuningParametersPath((environment != nullptr) ? environment : "");
+  std::remove(kOverridesFile.c_str());
+}
+
+// =================================================================================================
+
+// Checks for the option first, since the default values can't be passed to 'GetArgument'
+template <typename T>
+std::vector<T> GetArgumentOrDefaults(int argc, char *argv[], const std::string &option,
+                                     const std::vector<T> &defaults) {
+  auto dummy = std::string{};
+  if (!CheckArgument(argc, argv, dummy, option)) { return defaults; }
+  return {GetArgument(argc, argv, dummy, option, T{})};
+}
+
+// Compiles the above function
+template std::vector<size_t> GetArgumentOrDefaults(int, char **, const std::string&, const std::vector<size_t>&);
+template std::vector<Layout> GetArgumentOrDefaults(int, char **, const std::string&, const std::vector<Layout>&);
+template std::vector<Transpose> GetArgumentOrDefaults(int, char **, const std::string&, const std::vector<Transpose>&);
+template std::vector<half> GetArgumentOrDefaults(int, char **, const std::string&, const std::vector<half>&);
+template std::vector<float> GetArgumentOrDefaults(int, char **, const std::string&, const std::vector<float>&);
+template std::vector<double> GetArgumentOrDefaults(int, char **, const std::string&, const std::vector<double>&);
+template std::vector<float2> GetArgumentOrDefaults(int, char **, const std::string&, const std::vector<float2>&);
+template std::vector<double2> GetArgumentOrDefaults(int, char **, const std::string&, const std::vector<double2>&);
+
+// =================================================================================================
+
 // Compiles the templated class
+template class Tester<half, half>;
 template class Tester<float, float>;
 template class Tester<double, double>;
 template class Tester<float2, float2>;
@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
 
 // The libraries
 #ifdef CLBLAST_REF_CLBLAS
@@ -100,6 +101,9 @@ class Tester {
   // Whether or not to print extra information when testing
   const bool verbose_;
 
+  // The memory budget of the context in bytes (zero for none), to test the routines' fall-backs
+  const size_t memory_budget_;
+
   // Retrieves the offset values to test with
   const std::vector<size_t> GetOffsets() const;
 
@@ -148,11 +152,31 @@ class Tester {
 template <typename T>
 bool TestSimilarity(const T val1, const T val2);
 
+// Scales the error margins of the above comparison, e.g. for less accurate algorithms. A factor of
+// 1.0 restores the default margins.
+void SetErrorMarginFactor(const double factor);
+
 // Retrieves a list of example scalar values, used for the alpha and beta arguments for the various
 // routines. This function is specialised for the different data-types.
 template <typename T>
 const std::vector<T> GetExampleScalars(const bool full_test);
 
+// Overrides the tuning parameters of a kernel family (e.g. 'xgemm' or 'gemm_routine') for the
+// device under test, by writing them as tuner output and loading them as run-time overrides (see
+// 'SetTuningParametersPath'). This allows testing code paths which depend on these parameters,
+// e.g. on size thresholds. The parameters must be complete, otherwise they are ignored.
+// They apply until 'ResetTuningParameters' is called.
+void OverrideTuningParameters(int argc, char *argv[], const std::string &kernel_family,
+                              const Precision precision,
+                              const std::vector<std::pair<std::string,size_t>> &parameters);
+void ResetTuningParameters();
+
+// Returns the value of an option given on the command-line as a single-element list, or otherwise
+// the list of default values. This allows testing specific cases, e.g. a larger problem size.
+template <typename T>
+std::vector<T> GetArgumentOrDefaults(int argc, char *argv[], const std::string &option,
+                                     const std::vector<T> &defaults);
+
 // =================================================================================================
 } // namespace clblast
 
@@ -0,0 +1,104 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a multi-threaded micro-benchmark of the program cache. It measures the
+// latency of the cache look-ups which are performed on every routine call, for an increasing number
+// of host threads performing such look-ups concurrently.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+
+#include "internal/cache.h"
+#include "internal/utilities.h"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs the benchmark: fills the cache and measures the look-up latency with 1, 2, 4, ... threads
+void RunBenchmark(int argc, char *argv[]) {
+
+  // Retrieves the arguments
+  auto help = std::string{"\n* Options given/available:\n"};
+  const auto platform_id = GetArgument(argc, argv, help, kArgPlatform, size_t{0});
+  const auto device_id = GetArgument(argc, argv, help, kArgDevice, size_t{0});
+  const auto max_threads = GetArgument(argc, argv, help, "threads", size_t{16});
+  const auto num_lookups = GetArgument(argc, argv, help, "lookups", size_t{100000});
+  fprintf(stdout, "%s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+
+  // Fills the cache with (non-compiled) programs for all routines and precisions. Each routine call
+  // creates its own 'Context' object, so the look-ups are performed using a fresh copy.
+  const auto routines = std::vector<std::string>{
+    "SWAP", "SCAL", "COPY", "AXPY", "DOT", "DOTU", "DOTC", "NRM2", "ASUM", "SUM", "AMAX", "MAX",
+    "MIN", "GEMV", "GBMV", "HEMV", "HBMV", "HPMV", "SYMV", "SBMV", "SPMV", "TRMV", "TBMV", "TPMV",
+    "GER", "GERU", "GERC", "HER", "HPR", "HER2", "HPR2", "SYR", "SPR", "SYR2", "SPR2", "GEMM",
+    "SYMM", "HEMM", "SYRK", "HERK", "SYR2K", "HER2K", "TRMM"
+  };
+  const auto precisions = std::vector<Precision>{Precision::kSingle, Precision::kDouble,
+                                                 Precision::kComplexSingle,
+                                                 Precision::kComplexDouble};
+  for (auto &routine: routines) {
+    for (auto &precision: precisions) {
+      auto program = Program(context, "__kernel void Dummy() { }");
+      cache::StoreProgramToCache(program, context, precision, routine);
+    }
+  }
+
+  // Runs the benchmark for an increasing number of threads
+  fprintf(stdout, "| %8s | %16s | %18s |\n", "threads", "ns per look-up", "look-ups per second");
+  for (auto num_threads = size_t{1}; num_threads <= max_threads; num_threads *= 2) {
+    auto elapsed_times = std::vector<double>(num_threads);
+    auto threads = std::vector<std::thread>();
+    for (auto t = size_t{0}; t < num_threads; ++t) {
+      threads.push_back(std::thread([&, t]() {
+        const auto context_copy = Context(context());
+        const auto start_time = std::chrono::steady_clock::now();
+        for (auto i = size_t{0}; i < num_lookups; ++i) {
+          const auto &routine = routines[(i + t) % routines.size()];
+          const auto &precision = precisions[i % precisions.size()];
+          auto program = std::shared_ptr<Program>();
+          if (!cache::FindProgramInCache(context_copy, precision, routine, program)) {
+            throw std::runtime_error("Program unexpectedly not found in cache");
+          }
+        }
+        const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+        elapsed_times[t] = std::chrono::duration<double,std::nano>(elapsed_time).count();
+      }));
+    }
+    for (auto &thread: threads) { thread.join(); }
+
+    // Reports the average latency per look-up and the aggregated throughput
+    auto total_time = 0.0;
+    for (auto &elapsed_time: elapsed_times) { total_time += elapsed_time; }
+    const auto latency = total_time / static_cast<double>(num_threads * num_lookups);
+    const auto throughput = 1.0e9 * static_cast<double>(num_threads) / latency;
+    fprintf(stdout, "| %8zu | %16.1lf | %18.0lf |\n", num_threads, latency, throughput);
+  }
+  cache::ClearCache();
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  clblast::RunBenchmark(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
@@ -89,6 +89,16 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const GetMetric
     // Scalar values 
     if (o == kArgAlpha) { args.alpha = GetArgument(argc, argv, help, kArgAlpha, GetScalar<U>()); }
     if (o == kArgBeta)  { args.beta  = GetArgument(argc, argv, help, kArgBeta, GetScalar<U>()); }
+
+    // Batch arguments
+    if (o == kArgBatchCount) { args.batch_count = GetArgument(argc, argv, help, kArgBatchCount, size_t{8}); }
+
+    // Epilogue arguments
+    if (o == kArgBias)       { args.bias       = GetArgument(argc, argv, help, kArgBias, Bias::kRowBias); }
+    if (o == kArgActivation) { args.activation = GetArgument(argc, argv, help, kArgActivation, Activation::kRelu); }
+
+    // Workspace arguments
+    if (o == kArgWorkspace) { args.workspace = GetArgument(argc, argv, help, kArgWorkspace, size_t{0}); }
   }
 
   // These are the options common to all routines
@@ -297,6 +307,10 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args,
     else if (o == kArgNrm2Offset){integers.push_back(args.nrm2_offset); }
     else if (o == kArgAsumOffset){integers.push_back(args.asum_offset); }
     else if (o == kArgImaxOffset){integers.push_back(args.imax_offset); }
+    else if (o == kArgBatchCount){integers.push_back(args.batch_count); }
+    else if (o == kArgBias) {     integers.push_back(static_cast<size_t>(args.bias)); }
+    else if (o == kArgActivation){integers.push_back(static_cast<size_t>(args.activation)); }
+    else if (o == kArgWorkspace){ integers.push_back(args.workspace); }
   }
   auto strings = std::vector<std::string>{};
   for (auto &o: options_) {
@@ -339,6 +353,7 @@ void Client<T,U>::PrintTableRow(const Arguments<U>& args,
 // =================================================================================================
 
 // Compiles the templated class
+template class Client<half,half>;
 template class Client<float,float>;
 template class Client<double,double>;
 template class Client<float2,float2>;
@@ -43,7 +43,8 @@ class TestXher2k {
             kArgLayout, kArgTriangle, kArgATransp,
             kArgALeadDim, kArgBLeadDim, kArgCLeadDim,
             kArgAOffset, kArgBOffset, kArgCOffset,
-            kArgAlpha, kArgBeta};
+            kArgAlpha, kArgBeta,
+            kArgWorkspace};
   }
 
   // Describes how to obtain the sizes of the buffers
@@ -85,6 +86,22 @@ class TestXher2k {
     auto queue_plain = queue();
     auto event = cl_event{};
     auto alpha2 = T{args.alpha, args.alpha};
+    if (args.workspace != 0) {
+      return RunWithWorkspace(queue, [&](size_t* workspace_size) {
+        return Her2kWorkspaceSize<T,U>(args.layout, args.triangle, args.a_transpose,
+                                       args.n, args.k,
+                                       &queue_plain, workspace_size);
+      }, [&](const cl_mem workspace, const size_t workspace_size) {
+        const auto status = Her2k(args.layout, args.triangle, args.a_transpose,
+                                  args.n, args.k, alpha2,
+                                  buffers.a_mat(), args.a_offset, args.a_ld,
+                                  buffers.b_mat(), args.b_offset, args.b_ld, args.beta,
+                                  buffers.c_mat(), args.c_offset, args.c_ld,
+                                  workspace, workspace_size, &queue_plain, &event);
+        clWaitForEvents(1, &event);
+        return status;
+      });
+    }
     auto status = Her2k(args.layout, args.triangle, args.a_transpose,
                         args.n, args.k, alpha2,
                         buffers.a_mat(), args.a_offset, args.a_ld,
@@ -43,7 +43,8 @@ class TestXsymm {
             kArgLayout, kArgSide, kArgTriangle,
             kArgALeadDim, kArgBLeadDim, kArgCLeadDim,
             kArgAOffset, kArgBOffset, kArgCOffset,
-            kArgAlpha, kArgBeta};
+            kArgAlpha, kArgBeta,
+            kArgWorkspace};
   }
 
   // Describes how to obtain the sizes of the buffers
@@ -86,6 +87,22 @@ class TestXsymm {
   static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
     auto queue_plain = queue();
     auto event = cl_event{};
+    if (args.workspace != 0) {
+      return RunWithWorkspace(queue, [&](size_t* workspace_size) {
+        return SymmWorkspaceSize<T>(args.layout, args.side, args.triangle,
+                                    args.m, args.n,
+                                    &queue_plain, workspace_size);
+      }, [&](const cl_mem workspace, const size_t workspace_size) {
+        const auto status = Symm(args.layout, args.side, args.triangle,
+                                 args.m, args.n, args.alpha,
+                                 buffers.a_mat(), args.a_offset, args.a_ld,
+                                 buffers.b_mat(), args.b_offset, args.b_ld, args.beta,
+                                 buffers.c_mat(), args.c_offset, args.c_ld,
+                                 workspace, workspace_size, &queue_plain, &event);
+        clWaitForEvents(1, &event);
+        return status;
+      });
+    }
     auto status = Symm(args.layout, args.side, args.triangle,
                        args.m, args.n, args.alpha,
                        buffers.a_mat(), args.a_offset, args.a_ld,
@@ -43,7 +43,8 @@ class TestXtrmm {
             kArgLayout, kArgSide, kArgTriangle, kArgATransp, kArgDiagonal,
             kArgALeadDim, kArgBLeadDim,
             kArgAOffset, kArgBOffset,
-            kArgAlpha};
+            kArgAlpha,
+            kArgWorkspace};
   }
 
   // Describes how to obtain the sizes of the buffers
@@ -77,6 +78,21 @@ class TestXtrmm {
   static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
     auto queue_plain = queue();
     auto event = cl_event{};
+    if (args.workspace != 0) {
+      return RunWithWorkspace(queue, [&](size_t* workspace_size) {
+        return TrmmWorkspaceSize<T>(args.layout, args.side, args.triangle,
+                                    args.a_transpose, args.diagonal, args.m, args.n,
+                                    &queue_plain, workspace_size);
+      }, [&](const cl_mem workspace, const size_t workspace_size) {
+        const auto status = Trmm(args.layout, args.side, args.triangle,
+                                 args.a_transpose, args.diagonal, args.m, args.n, args.alpha,
+                                 buffers.a_mat(), args.a_offset, args.a_ld,
+                                 buffers.b_mat(), args.b_offset, args.b_ld,
+                                 workspace, workspace_size, &queue_plain, &event);
+        clWaitForEvents(1, &event);
+        return status;
+      });
+    }
     auto status = Trmm(args.layout, args.side, args.triangle, args.a_transpose, args.diagonal,
                        args.m, args.n, args.alpha,
                        buffers.a_mat(), args.a_offset, args.a_ld,
@@ -0,0 +1,253 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XgemmEpilogue routine. Examples
+// of such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+// The bias and scale vectors are generated from their indices. The scale vectors are only used if
+// there is a bias or an activation, such that the case without them is tested as well. The
+// reference libraries compute a regular GEMM, after which the epilogue is applied on the host.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGEMMEPILOGUE_H_
+#define CLBLAST_TEST_ROUTINES_XGEMMEPILOGUE_H_
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cmath>
+
+#ifdef CLBLAST_REF_CLBLAS
+  #include "wrapper_clblas.h"
+#endif
+#ifdef CLBLAST_REF_CBLAS
+  #include "wrapper_cblas.h"
+#endif
+
+namespace clblast {
+// =================================================================================================
+
+// Conversions of the host data-types from and to double-precision, in which the epilogue is
+// computed on the host. These are specialised for half-precision (see 'clblast_half.h').
+template <typename T> double EpilogueToDouble(const T value) { return static_cast<double>(value); }
+template <> inline double EpilogueToDouble(const half value) { return HalfToFloat(value); }
+template <typename T> T EpilogueFromDouble(const double value) { return static_cast<T>(value); }
+template <> inline half EpilogueFromDouble(const double value) {
+  return FloatToHalf(static_cast<float>(value));
+}
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgemmEpilogue {
+ public:
+
+  // The BLAS level: 1, 2, or 3
+  static size_t BLASLevel() { return 3; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN, kArgK,
+            kArgLayout, kArgATransp, kArgBTransp,
+            kArgALeadDim, kArgBLeadDim, kArgCLeadDim,
+            kArgAOffset, kArgBOffset, kArgCOffset,
+            kArgAlpha, kArgBeta,
+            kArgBias, kArgActivation};
+  }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    auto a_rotated = (args.layout == Layout::kColMajor && args.a_transpose != Transpose::kNo) ||
+                     (args.layout == Layout::kRowMajor && args.a_transpose == Transpose::kNo);
+    auto a_two = (a_rotated) ? args.m : args.k;
+    return a_two * args.a_ld + args.a_offset;
+  }
+  static size_t GetSizeB(const Arguments<T> &args) {
+    auto b_rotated = (args.layout == Layout::kColMajor && args.b_transpose != Transpose::kNo) ||
+                     (args.layout == Layout::kRowMajor && args.b_transpose == Transpose::kNo);
+    auto b_two = (b_rotated) ? args.k : args.n;
+    return b_two * args.b_ld + args.b_offset;
+  }
+  static size_t GetSizeC(const Arguments<T> &args) {
+    auto c_rotated = (args.layout == Layout::kRowMajor);
+    auto c_two = (c_rotated) ? args.m : args.n;
+    return c_two * args.c_ld + args.c_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+    args.c_size = GetSizeC(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.k; }
+  static size_t DefaultLDB(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDC(const Arguments<T> &args) { return args.n; }
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &all) { return all; }
+  static Transposes GetBTransposes(const Transposes &all) { return all; }
+
+  // Describes the vectors of the epilogue: the bias holds one value per row or column of C, the
+  // scale vectors hold one value per row and per column respectively
+  static bool UsesScaling(const Arguments<T> &args) {
+    return args.bias != Bias::kNoBias || args.activation != Activation::kIdentity;
+  }
+  static std::vector<T> GetBias(const Arguments<T> &args) {
+    const auto size = (args.bias == Bias::kColumnBias) ? args.n : args.m;
+    auto bias = std::vector<T>(std::max(size, size_t{1}));
+    for (auto i = size_t{0}; i < bias.size(); ++i) {
+      bias[i] = EpilogueFromDouble<T>(0.25 * static_cast<double>(i % 7) - 0.75);
+    }
+    return bias;
+  }
+  static std::vector<T> GetRowScales(const Arguments<T> &args) {
+    auto row_scales = std::vector<T>(std::max(args.m, size_t{1}));
+    for (auto i = size_t{0}; i < row_scales.size(); ++i) {
+      row_scales[i] = EpilogueFromDouble<T>(0.5 + 0.25 * static_cast<double>(i % 5));
+    }
+    return row_scales;
+  }
+  static std::vector<T> GetColScales(const Arguments<T> &args) {
+    auto col_scales = std::vector<T>(std::max(args.n, size_t{1}));
+    for (auto j = size_t{0}; j < col_scales.size(); ++j) {
+      col_scales[j] = EpilogueFromDouble<T>(1.5 - 0.25 * static_cast<double>(j % 3));
+    }
+    return col_scales;
+  }
+
+  // Applies the epilogue on the host to the result of a regular GEMM (for the references)
+  static void ApplyEpilogue(const Arguments<T> &args, std::vector<T> &c_mat_cpu) {
+    const auto bias = GetBias(args);
+    const auto row_scales = GetRowScales(args);
+    const auto col_scales = GetColScales(args);
+    for (auto i = size_t{0}; i < args.m; ++i) {
+      for (auto j = size_t{0}; j < args.n; ++j) {
+        const auto index = GetResultIndex(args, i, j);
+        auto value = EpilogueToDouble(c_mat_cpu[index]);
+        if (args.bias == Bias::kRowBias) { value += EpilogueToDouble(bias[i]); }
+        if (args.bias == Bias::kColumnBias) { value += EpilogueToDouble(bias[j]); }
+        if (args.activation == Activation::kRelu) { value = std::max(value, 0.0); }
+        if (args.activation == Activation::kGelu) {
+          const auto sqrt_2_over_pi = 0.7978845608028654;
+          const auto inner = sqrt_2_over_pi * (value + 0.044715 * value * value * value);
+          value = 0.5 * value * (1.0 + std::tanh(inner));
+        }
+        if (UsesScaling(args)) {
+          value *= EpilogueToDouble(row_scales[i]) * EpilogueToDouble(col_scales[j]);
+        }
+        c_mat_cpu[index] = EpilogueFromDouble<T>(value);
+      }
+    }
+  }
+
+  // Describes how to run the CLBlast routine. The vectors of the epilogue are uploaded first.
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    const auto context = queue.GetContext();
+    const auto bias = GetBias(args);
+    const auto row_scales = GetRowScales(args);
+    const auto col_scales = GetColScales(args);
+    auto bias_buffer = Buffer<T>(context, queue, bias.begin(), bias.end());
+    auto row_scales_buffer = Buffer<T>(context, queue, row_scales.begin(), row_scales.end());
+    auto col_scales_buffer = Buffer<T>(context, queue, col_scales.begin(), col_scales.end());
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = GemmEpilogue(args.layout, args.a_transpose, args.b_transpose,
+                               args.m, args.n, args.k, args.alpha,
+                               buffers.a_mat(), args.a_offset, args.a_ld,
+                               buffers.b_mat(), args.b_offset, args.b_ld, args.beta,
+                               buffers.c_mat(), args.c_offset, args.c_ld,
+                               args.bias, bias_buffer(), 0, args.activation,
+                               (UsesScaling(args)) ? row_scales_buffer() : nullptr, 0,
+                               (UsesScaling(args)) ? col_scales_buffer() : nullptr, 0,
+                               &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); }
+    return status;
+  }
+
+  // Describes how to run the clBLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CLBLAS
+    static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = clblasXgemm(convertToCLBLAS(args.layout),
+                                convertToCLBLAS(args.a_transpose),
+                                convertToCLBLAS(args.b_transpose),
+                                args.m, args.n, args.k, args.alpha,
+                                buffers.a_mat(), args.a_offset, args.a_ld,
+                                buffers.b_mat(), args.b_offset, args.b_ld, args.beta,
+                                buffers.c_mat(), args.c_offset, args.c_ld,
+                                1, &queue_plain, 0, nullptr, &event);
+      if (static_cast<StatusCode>(status) != StatusCode::kSuccess) {
+        return static_cast<StatusCode>(status);
+      }
+      clWaitForEvents(1, &event);
+      std::vector<T> c_mat_cpu(args.c_size, static_cast<T>(0));
+      buffers.c_mat.Read(queue, args.c_size, c_mat_cpu);
+      ApplyEpilogue(args, c_mat_cpu);
+      buffers.c_mat.Write(queue, args.c_size, c_mat_cpu);
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CBLAS
+    static StatusCode RunReference2(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+      std::vector<T> a_mat_cpu(args.a_size, static_cast<T>(0));
+      std::vector<T> b_mat_cpu(args.b_size, static_cast<T>(0));
+      std::vector<T> c_mat_cpu(args.c_size, static_cast<T>(0));
+      buffers.a_mat.Read(queue, args.a_size, a_mat_cpu);
+      buffers.b_mat.Read(queue, args.b_size, b_mat_cpu);
+      buffers.c_mat.Read(queue, args.c_size, c_mat_cpu);
+      cblasXgemm(convertToCBLAS(args.layout),
+                 convertToCBLAS(args.a_transpose),
+                 convertToCBLAS(args.b_transpose),
+                 args.m, args.n, args.k, args.alpha,
+                 a_mat_cpu, args.a_offset, args.a_ld,
+                 b_mat_cpu, args.b_offset, args.b_ld, args.beta,
+                 c_mat_cpu, args.c_offset, args.c_ld);
+      ApplyEpilogue(args, c_mat_cpu);
+      buffers.c_mat.Write(queue, args.c_size, c_mat_cpu);
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.c_size, static_cast<T>(0));
+    buffers.c_mat.Read(queue, args.c_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.m; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return (args.layout == Layout::kRowMajor) ?
+           id1*args.c_ld + id2 + args.c_offset:
+           id2*args.c_ld + id1 + args.c_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return 2 * args.m * args.n * args.k;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return (args.m*args.k + args.k*args.n + 2*args.m*args.n) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGEMMEPILOGUE_H_
+#endif
@@ -0,0 +1,253 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the XgemmGroupedBatched routine.
+// Examples of such 'descriptions' are how to calculate the size a of buffer or how to run the
+// routine. These static methods are used by the correctness tester and the performance tester.
+// The group consists of 'batch_count' problems of different sizes, derived from m, n, and k: the
+// problems grow in m and k and shrink in n. Their matrices are stored one after the other, each
+// with the leading dimension and the size of the largest matrix. The scalars alternate between
+// problems. The reference libraries have no grouped routines, so they compute the group one-by-one.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGEMMGROUPEDBATCHED_H_
+#define CLBLAST_TEST_ROUTINES_XGEMMGROUPEDBATCHED_H_
+
+#include <vector>
+#include <string>
+
+#ifdef CLBLAST_REF_CLBLAS
+  #include "wrapper_clblas.h"
+#endif
+#ifdef CLBLAST_REF_CBLAS
+  #include "wrapper_cblas.h"
+#endif
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXgemmGroupedBatched {
+ public:
+
+  // The BLAS level: 1, 2, or 3
+  static size_t BLASLevel() { return 3; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN, kArgK,
+            kArgLayout, kArgATransp, kArgBTransp,
+            kArgAOffset, kArgBOffset, kArgCOffset,
+            kArgBatchCount,
+            kArgAlpha, kArgBeta};
+  }
+
+  // Describes the sizes and scalars of a single problem of the group
+  static size_t ProblemSize(const size_t size, const size_t id, const size_t count) {
+    return (size * (id + 1) + count - 1) / count;
+  }
+  static size_t GetM(const Arguments<T> &args, const size_t id) {
+    return ProblemSize(args.m, id, args.batch_count);
+  }
+  static size_t GetN(const Arguments<T> &args, const size_t id) {
+    return ProblemSize(args.n, args.batch_count - 1 - id, args.batch_count);
+  }
+  static size_t GetK(const Arguments<T> &args, const size_t id) {
+    return ProblemSize(args.k, (id + 1) % args.batch_count, args.batch_count);
+  }
+  static T GetAlpha(const Arguments<T> &args, const size_t id) {
+    return (id % 2 == 0) ? args.alpha : args.beta;
+  }
+  static T GetBeta(const Arguments<T> &args, const size_t id) {
+    return (id % 2 == 0) ? args.beta : args.alpha;
+  }
+
+  // Describes the leading dimensions and the strides between the matrices of the group: those of
+  // the largest matrices
+  static size_t GetLDA(const Arguments<T> &args) {
+    auto a_rotated = (args.layout == Layout::kColMajor && args.a_transpose != Transpose::kNo) ||
+                     (args.layout == Layout::kRowMajor && args.a_transpose == Transpose::kNo);
+    return (a_rotated) ? args.k : args.m;
+  }
+  static size_t GetLDB(const Arguments<T> &args) {
+    auto b_rotated = (args.layout == Layout::kColMajor && args.b_transpose != Transpose::kNo) ||
+                     (args.layout == Layout::kRowMajor && args.b_transpose == Transpose::kNo);
+    return (b_rotated) ? args.n : args.k;
+  }
+  static size_t GetLDC(const Arguments<T> &args) {
+    auto c_rotated = (args.layout == Layout::kRowMajor);
+    return (c_rotated) ? args.n : args.m;
+  }
+  static size_t GetStrideA(const Arguments<T> &args) { return args.m * args.k; }
+  static size_t GetStrideB(const Arguments<T> &args) { return args.k * args.n; }
+  static size_t GetStrideC(const Arguments<T> &args) { return args.m * args.n; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    return GetStrideA(args) * args.batch_count + args.a_offset;
+  }
+  static size_t GetSizeB(const Arguments<T> &args) {
+    return GetStrideB(args) * args.batch_count + args.b_offset;
+  }
+  static size_t GetSizeC(const Arguments<T> &args) {
+    return GetStrideC(args) * args.batch_count + args.c_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+    args.c_size = GetSizeC(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.k; }
+  static size_t DefaultLDB(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDC(const Arguments<T> &args) { return args.n; }
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &all) { return all; }
+  static Transposes GetBTransposes(const Transposes &all) { return all; }
+
+  // Describes how to run the CLBlast routine. The per-problem arguments are uploaded first. Note
+  // that the routine can't test the matrices for validity, so the tests with too small buffers
+  // are skipped.
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    if (args.a_size < GetSizeA(args) || args.b_size < GetSizeB(args) ||
+        args.c_size < GetSizeC(args)) {
+      return StatusCode::kNotImplemented;
+    }
+    auto problems = std::vector<int>();
+    auto alphas = std::vector<T>();
+    auto betas = std::vector<T>();
+    for (auto id = size_t{0}; id < args.batch_count; ++id) {
+      const auto problem = std::vector<size_t>{
+        GetM(args, id), GetN(args, id), GetK(args, id),
+        args.a_offset + id*GetStrideA(args), GetLDA(args),
+        args.b_offset + id*GetStrideB(args), GetLDB(args),
+        args.c_offset + id*GetStrideC(args), GetLDC(args)
+      };
+      for (const auto &value: problem) { problems.push_back(static_cast<int>(value)); }
+      alphas.push_back(GetAlpha(args, id));
+      betas.push_back(GetBeta(args, id));
+    }
+    const auto context = queue.GetContext();
+    auto problems_buffer = Buffer<int>(context, queue, problems.begin(), problems.end());
+    auto alphas_buffer = Buffer<T>(context, queue, alphas.begin(), alphas.end());
+    auto betas_buffer = Buffer<T>(context, queue, betas.begin(), betas.end());
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = GemmGroupedBatched<T>(args.layout, args.a_transpose, args.b_transpose,
+                                        args.batch_count, problems_buffer(),
+                                        alphas_buffer(), betas_buffer(),
+                                        buffers.a_mat(), buffers.b_mat(), buffers.c_mat(),
+                                        &queue_plain, &event);
+    clWaitForEvents(1, &event);
+    return status;
+  }
+
+  // Describes how to run the clBLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CLBLAS
+    static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+      auto queue_plain = queue();
+      for (auto id = size_t{0}; id < args.batch_count; ++id) {
+        const auto a_offset = args.a_offset + id*GetStrideA(args);
+        const auto b_offset = args.b_offset + id*GetStrideB(args);
+        const auto c_offset = args.c_offset + id*GetStrideC(args);
+        auto event = cl_event{};
+        auto status = clblasXgemm(convertToCLBLAS(args.layout),
+                                  convertToCLBLAS(args.a_transpose),
+                                  convertToCLBLAS(args.b_transpose),
+                                  GetM(args, id), GetN(args, id), GetK(args, id),
+                                  GetAlpha(args, id),
+                                  buffers.a_mat(), a_offset, GetLDA(args),
+                                  buffers.b_mat(), b_offset, GetLDB(args),
+                                  GetBeta(args, id),
+                                  buffers.c_mat(), c_offset, GetLDC(args),
+                                  1, &queue_plain, 0, nullptr, &event);
+        if (static_cast<StatusCode>(status) != StatusCode::kSuccess) {
+          return static_cast<StatusCode>(status);
+        }
+        clWaitForEvents(1, &event);
+      }
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CBLAS
+    static StatusCode RunReference2(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+      std::vector<T> a_mat_cpu(args.a_size, static_cast<T>(0));
+      std::vector<T> b_mat_cpu(args.b_size, static_cast<T>(0));
+      std::vector<T> c_mat_cpu(args.c_size, static_cast<T>(0));
+      buffers.a_mat.Read(queue, args.a_size, a_mat_cpu);
+      buffers.b_mat.Read(queue, args.b_size, b_mat_cpu);
+      buffers.c_mat.Read(queue, args.c_size, c_mat_cpu);
+      for (auto id = size_t{0}; id < args.batch_count; ++id) {
+        cblasXgemm(convertToCBLAS(args.layout),
+                   convertToCBLAS(args.a_transpose),
+                   convertToCBLAS(args.b_transpose),
+                   GetM(args, id), GetN(args, id), GetK(args, id), GetAlpha(args, id),
+                   a_mat_cpu, args.a_offset + id*GetStrideA(args), GetLDA(args),
+                   b_mat_cpu, args.b_offset + id*GetStrideB(args), GetLDB(args),
+                   GetBeta(args, id),
+                   c_mat_cpu, args.c_offset + id*GetStrideC(args), GetLDC(args));
+      }
+      buffers.c_mat.Write(queue, args.c_size, c_mat_cpu);
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.c_size, static_cast<T>(0));
+    buffers.c_mat.Read(queue, args.c_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer: the second index also iterates over
+  // the matrices of the group. Elements outside of a (smaller) problem are compared as well.
+  static size_t ResultID1(const Arguments<T> &args) { return args.m; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n * args.batch_count; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2_3) {
+    const auto id2 = id2_3 % args.n;
+    const auto offset = (id2_3 / args.n) * GetStrideC(args) + args.c_offset;
+    return (args.layout == Layout::kRowMajor) ?
+           id1*GetLDC(args) + id2 + offset:
+           id2*GetLDC(args) + id1 + offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    auto flops = size_t{0};
+    for (auto id = size_t{0}; id < args.batch_count; ++id) {
+      flops += 2 * GetM(args, id) * GetN(args, id) * GetK(args, id);
+    }
+    return flops;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    auto bytes = size_t{0};
+    for (auto id = size_t{0}; id < args.batch_count; ++id) {
+      const auto m = GetM(args, id);
+      const auto n = GetN(args, id);
+      const auto k = GetK(args, id);
+      bytes += (m*k + k*n + 2*m*n) * sizeof(T);
+    }
+    return bytes;
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGEMMGROUPEDBATCHED_H_
+#endif
@@ -40,6 +40,16 @@ CBLAS_SIDE convertToCBLAS(const Side v) { return (v == Side::kLeft) ? CblasLeft
   using return_pointer_double = void*;
 #endif
 
+// Half-precision is not supported by CPU BLAS: buffers are converted from and to single-precision
+std::vector<float> HalfToFloatBuffer(const std::vector<half>& source) {
+  auto result = std::vector<float>(source.size());
+  for (auto i = size_t{0}; i < source.size(); ++i) { result[i] = HalfToFloat(source[i]); }
+  return result;
+}
+void FloatToHalfBuffer(std::vector<half>& result, const std::vector<float>& source) {
+  for (auto i = size_t{0}; i < source.size(); ++i) { result[i] = FloatToHalf(source[i]); }
+}
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 // =================================================================================================
@@ -132,7 +142,7 @@ void cblasXrotm(const size_t n,
               &sparam_buffer[sparam_offset]);
 }
 
-// Forwards the Netlib BLAS calls for SSWAP/DSWAP/CSWAP/ZSWAP
+// Forwards the Netlib BLAS calls for SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
 void cblasXswap(const size_t n,
                 std::vector<float>& x_buffer, const size_t x_offset, const size_t x_inc,
                 std::vector<float>& y_buffer, const size_t y_offset, const size_t y_inc) {
@@ -161,8 +171,19 @@ void cblasXswap(const size_t n,
               reinterpret_cast<double*>(&x_buffer[x_offset]), static_cast<int>(x_inc),
               reinterpret_cast<double*>(&y_buffer[y_offset]), static_cast<int>(y_inc));
 }
+void cblasXswap(const size_t n,
+                std::vector<half>& x_buffer, const size_t x_offset, const size_t x_inc,
+                std::vector<half>& y_buffer, const size_t y_offset, const size_t y_inc) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer);
+  cblasXswap(n,
+             x_buffer_bis, x_offset, x_inc,
+             y_buffer_bis, y_offset, y_inc);
+  FloatToHalfBuffer(x_buffer, x_buffer_bis);
+  FloatToHalfBuffer(y_buffer, y_buffer_bis);
+}
 
-// Forwards the Netlib BLAS calls for SSCAL/DSCAL/CSCAL/ZSCAL
+// Forwards the Netlib BLAS calls for SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
 void cblasXscal(const size_t n,
                 const float alpha,
                 std::vector<float>& x_buffer, const size_t x_offset, const size_t x_inc) {
@@ -193,8 +214,17 @@ void cblasXscal(const size_t n,
               alpha_array.data(),
               reinterpret_cast<double*>(&x_buffer[x_offset]), static_cast<int>(x_inc));
 }
+void cblasXscal(const size_t n,
+                const half alpha,
+                std::vector<half>& x_buffer, const size_t x_offset, const size_t x_inc) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer);
+  cblasXscal(n,
+             HalfToFloat(alpha),
+             x_buffer_bis, x_offset, x_inc);
+  FloatToHalfBuffer(x_buffer, x_buffer_bis);
+}
 
-// Forwards the Netlib BLAS calls for SCOPY/DCOPY/CCOPY/ZCOPY
+// Forwards the Netlib BLAS calls for SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
 void cblasXcopy(const size_t n,
                 const std::vector<float>& x_buffer, const size_t x_offset, const size_t x_inc,
                 std::vector<float>& y_buffer, const size_t y_offset, const size_t y_inc) {
@@ -223,8 +253,18 @@ void cblasXcopy(const size_t n,
               reinterpret_cast<const double*>(&x_buffer[x_offset]), static_cast<int>(x_inc),
               reinterpret_cast<double*>(&y_buffer[y_offset]), static_cast<int>(y_inc));
 }
+void cblasXcopy(const size_t n,
+                const std::vector<half>& x_buffer, const size_t x_offset, const size_t x_inc,
+                std::vector<half>& y_buffer, const size_t y_offset, const size_t y_inc) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer);
+  cblasXcopy(n,
+             x_buffer_bis, x_offset, x_inc,
+             y_buffer_bis, y_offset, y_inc);
+  FloatToHalfBuffer(y_buffer, y_buffer_bis);
+}
 
-// Forwards the Netlib BLAS calls for SAXPY/DAXPY/CAXPY/ZAXPY
+// Forwards the Netlib BLAS calls for SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
 void cblasXaxpy(const size_t n,
                 const float alpha,
                 const std::vector<float>& x_buffer, const size_t x_offset, const size_t x_inc,
@@ -263,8 +303,20 @@ void cblasXaxpy(const size_t n,
               reinterpret_cast<const double*>(&x_buffer[x_offset]), static_cast<int>(x_inc),
               reinterpret_cast<double*>(&y_buffer[y_offset]), static_cast<int>(y_inc));
 }
+void cblasXaxpy(const size_t n,
+                const half alpha,
+                const std::vector<half>& x_buffer, const size_t x_offset, const size_t x_inc,
+                std::vector<half>& y_buffer, const size_t y_offset, const size_t y_inc) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer);
+  cblasXaxpy(n,
+             HalfToFloat(alpha),
+             x_buffer_bis, x_offset, x_inc,
+             y_buffer_bis, y_offset, y_inc);
+  FloatToHalfBuffer(y_buffer, y_buffer_bis);
+}
 
-// Forwards the Netlib BLAS calls for SDOT/DDOT
+// Forwards the Netlib BLAS calls for SDOT/DDOT/HDOT
 void cblasXdot(const size_t n,
                std::vector<float>& dot_buffer, const size_t dot_offset,
                const std::vector<float>& x_buffer, const size_t x_offset, const size_t x_inc,
@@ -281,6 +333,19 @@ void cblasXdot(const size_t n,
                                       &x_buffer[x_offset], static_cast<int>(x_inc),
                                       &y_buffer[y_offset], static_cast<int>(y_inc));
 }
+void cblasXdot(const size_t n,
+               std::vector<half>& dot_buffer, const size_t dot_offset,
+               const std::vector<half>& x_buffer, const size_t x_offset, const size_t x_inc,
+               const std::vector<half>& y_buffer, const size_t y_offset, const size_t y_inc) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer);
+  auto dot_buffer_bis = HalfToFloatBuffer(dot_buffer);
+  cblasXdot(n,
+            dot_buffer_bis, dot_offset,
+            x_buffer_bis, x_offset, x_inc,
+            y_buffer_bis, y_offset, y_inc);
+  FloatToHalfBuffer(dot_buffer, dot_buffer_bis);
+}
 
 // Forwards the Netlib BLAS calls for CDOTU/ZDOTU
 void cblasXdotu(const size_t n,
@@ -404,7 +469,7 @@ void cblasXamax(const size_t n,
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
 
-// Forwards the Netlib BLAS calls for SGEMV/DGEMV/CGEMV/ZGEMV
+// Forwards the Netlib BLAS calls for SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
 void cblasXgemv(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose,
                 const size_t m, const size_t n,
                 const float alpha,
@@ -469,6 +534,25 @@ void cblasXgemv(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose,
               beta_array.data(),
               reinterpret_cast<double*>(&y_buffer[y_offset]), static_cast<int>(y_inc));
 }
+void cblasXgemv(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose,
+                const size_t m, const size_t n,
+                const half alpha,
+                const std::vector<half>& a_buffer, const size_t a_offset, const size_t a_ld,
+                const std::vector<half>& x_buffer, const size_t x_offset, const size_t x_inc,
+                const half beta,
+                std::vector<half>& y_buffer, const size_t y_offset, const size_t y_inc) {
+  auto a_buffer_bis = HalfToFloatBuffer(a_buffer);
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer);
+  cblasXgemv(layout, a_transpose,
+             m, n,
+             HalfToFloat(alpha),
+             a_buffer_bis, a_offset, a_ld,
+             x_buffer_bis, x_offset, x_inc,
+             HalfToFloat(beta),
+             y_buffer_bis, y_offset, y_inc);
+  FloatToHalfBuffer(y_buffer, y_buffer_bis);
+}
 
 // Forwards the Netlib BLAS calls for SGBMV/DGBMV/CGBMV/ZGBMV
 void cblasXgbmv(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose,
@@ -968,7 +1052,7 @@ void cblasXtpsv(const CBLAS_ORDER layout, const CBLAS_UPLO triangle, const CBLAS
               reinterpret_cast<double*>(&x_buffer[x_offset]), static_cast<int>(x_inc));
 }
 
-// Forwards the Netlib BLAS calls for SGER/DGER
+// Forwards the Netlib BLAS calls for SGER/DGER/HGER
 void cblasXger(const CBLAS_ORDER layout,
                const size_t m, const size_t n,
                const float alpha,
@@ -995,6 +1079,23 @@ void cblasXger(const CBLAS_ORDER layout,
              &y_buffer[y_offset], static_cast<int>(y_inc),
              &a_buffer[a_offset], a_ld);
 }
+void cblasXger(const CBLAS_ORDER layout,
+               const size_t m, const size_t n,
+               const half alpha,
+               const std::vector<half>& x_buffer, const size_t x_offset, const size_t x_inc,
+               const std::vector<half>& y_buffer, const size_t y_offset, const size_t y_inc,
+               std::vector<half>& a_buffer, const size_t a_offset, const size_t a_ld) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer);
+  auto a_buffer_bis = HalfToFloatBuffer(a_buffer);
+  cblasXger(layout,
+            m, n,
+            HalfToFloat(alpha),
+            x_buffer_bis, x_offset, x_inc,
+            y_buffer_bis, y_offset, y_inc,
+            a_buffer_bis, a_offset, a_ld);
+  FloatToHalfBuffer(a_buffer, a_buffer_bis);
+}
 
 // Forwards the Netlib BLAS calls for CGERU/ZGERU
 void cblasXgeru(const CBLAS_ORDER layout,
@@ -1272,7 +1373,7 @@ void cblasXspr2(const CBLAS_ORDER layout, const CBLAS_UPLO triangle,
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// Forwards the Netlib BLAS calls for SGEMM/DGEMM/CGEMM/ZGEMM
+// Forwards the Netlib BLAS calls for SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
 void cblasXgemm(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose, const CBLAS_TRANSPOSE b_transpose,
                 const size_t m, const size_t n, const size_t k,
                 const float alpha,
@@ -1337,6 +1438,25 @@ void cblasXgemm(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose, con
               beta_array.data(),
               reinterpret_cast<double*>(&c_buffer[c_offset]), c_ld);
 }
+void cblasXgemm(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose, const CBLAS_TRANSPOSE b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const half alpha,
+                const std::vector<half>& a_buffer, const size_t a_offset, const size_t a_ld,
+                const std::vector<half>& b_buffer, const size_t b_offset, const size_t b_ld,
+                const half beta,
+                std::vector<half>& c_buffer, const size_t c_offset, const size_t c_ld) {
+  auto a_buffer_bis = HalfToFloatBuffer(a_buffer);
+  auto b_buffer_bis = HalfToFloatBuffer(b_buffer);
+  auto c_buffer_bis = HalfToFloatBuffer(c_buffer);
+  cblasXgemm(layout, a_transpose, b_transpose,
+             m, n, k,
+             HalfToFloat(alpha),
+             a_buffer_bis, a_offset, a_ld,
+             b_buffer_bis, b_offset, b_ld,
+             HalfToFloat(beta),
+             c_buffer_bis, c_offset, c_ld);
+  FloatToHalfBuffer(c_buffer, c_buffer_bis);
+}
 
 // Forwards the Netlib BLAS calls for SSYMM/DSYMM/CSYMM/ZSYMM
 void cblasXsymm(const CBLAS_ORDER layout, const CBLAS_SIDE side, const CBLAS_UPLO triangle,
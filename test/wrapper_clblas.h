@@ -28,6 +28,29 @@ clblasUplo convertToCLBLAS(const Triangle v) { return (v == Triangle::kUpper) ?
 clblasDiag convertToCLBLAS(const Diagonal v) { return (v == Diagonal::kUnit) ? clblasUnit : clblasNonUnit; }
 clblasSide convertToCLBLAS(const Side v) { return (v == Side::kLeft) ? clblasLeft : clblasRight; }
 
+// Half-precision is not supported by clBLAS: its buffers are converted from and to single-precision
+Buffer<float> HalfToFloatBuffer(const cl_mem buffer, const cl_command_queue queue_raw) {
+  const auto queue = Queue(queue_raw);
+  const auto buffer_half = Buffer<half>(buffer);
+  const auto size = buffer_half.GetSize() / sizeof(half);
+  auto host_half = std::vector<half>(size);
+  buffer_half.Read(queue, size, host_half);
+  auto host_float = std::vector<float>(size);
+  for (auto i = size_t{0}; i < size; ++i) { host_float[i] = HalfToFloat(host_half[i]); }
+  return Buffer<float>(queue.GetContext(), queue, host_float.begin(), host_float.end());
+}
+void FloatToHalfBuffer(cl_mem buffer, const Buffer<float> &buffer_float,
+                       const cl_command_queue queue_raw) {
+  const auto queue = Queue(queue_raw);
+  auto buffer_half = Buffer<half>(buffer);
+  const auto size = buffer_half.GetSize() / sizeof(half);
+  auto host_float = std::vector<float>(size);
+  buffer_float.Read(queue, size, host_float);
+  auto host_half = std::vector<half>(size);
+  for (auto i = size_t{0}; i < size; ++i) { host_half[i] = FloatToHalf(host_float[i]); }
+  buffer_half.Write(queue, size, host_half);
+}
+
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
 // =================================================================================================
@@ -172,7 +195,7 @@ clblasStatus clblasXrotm<double>(const size_t n,
                      num_queues, queues, num_wait_events, wait_events, events);
 }
 
-// Forwards the clBLAS calls for SSWAP/DSWAP/CSWAP/ZSWAP
+// Forwards the clBLAS calls for SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
 template <typename T>
 clblasStatus clblasXswap(const size_t n,
                          cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -223,8 +246,24 @@ clblasStatus clblasXswap<double2>(const size_t n,
                      y_buffer, y_offset, static_cast<int>(y_inc),
                      num_queues, queues, num_wait_events, wait_events, events);
 }
+template <>
+clblasStatus clblasXswap<half>(const size_t n,
+                               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               cl_uint num_queues, cl_command_queue *queues,
+                               cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer, queues[0]);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer, queues[0]);
+  auto status = clblasXswap<float>(n,
+                                   x_buffer_bis(), x_offset, x_inc,
+                                   y_buffer_bis(), y_offset, y_inc,
+                                   num_queues, queues, num_wait_events, wait_events, events);
+  FloatToHalfBuffer(x_buffer, x_buffer_bis, queues[0]);
+  FloatToHalfBuffer(y_buffer, y_buffer_bis, queues[0]);
+  return status;
+}
 
-// Forwards the clBLAS calls for SSCAL/DSCAL/CSCAL/ZSCAL
+// Forwards the clBLAS calls for SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
 clblasStatus clblasXscal(const size_t n,
                          const float alpha,
                          cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -265,8 +304,21 @@ clblasStatus clblasXscal(const size_t n,
                      x_buffer, x_offset, static_cast<int>(x_inc),
                      num_queues, queues, num_wait_events, wait_events, events);
 }
+clblasStatus clblasXscal(const size_t n,
+                         const half alpha,
+                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                         cl_uint num_queues, cl_command_queue *queues,
+                         cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer, queues[0]);
+  auto status = clblasXscal(n,
+                            HalfToFloat(alpha),
+                            x_buffer_bis(), x_offset, x_inc,
+                            num_queues, queues, num_wait_events, wait_events, events);
+  FloatToHalfBuffer(x_buffer, x_buffer_bis, queues[0]);
+  return status;
+}
 
-// Forwards the clBLAS calls for SCOPY/DCOPY/CCOPY/ZCOPY
+// Forwards the clBLAS calls for SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
 template <typename T>
 clblasStatus clblasXcopy(const size_t n,
                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -317,8 +369,23 @@ clblasStatus clblasXcopy<double2>(const size_t n,
                      y_buffer, y_offset, static_cast<int>(y_inc),
                      num_queues, queues, num_wait_events, wait_events, events);
 }
+template <>
+clblasStatus clblasXcopy<half>(const size_t n,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               cl_uint num_queues, cl_command_queue *queues,
+                               cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer, queues[0]);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer, queues[0]);
+  auto status = clblasXcopy<float>(n,
+                                   x_buffer_bis(), x_offset, x_inc,
+                                   y_buffer_bis(), y_offset, y_inc,
+                                   num_queues, queues, num_wait_events, wait_events, events);
+  FloatToHalfBuffer(y_buffer, y_buffer_bis, queues[0]);
+  return status;
+}
 
-// Forwards the clBLAS calls for SAXPY/DAXPY/CAXPY/ZAXPY
+// Forwards the clBLAS calls for SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
 clblasStatus clblasXaxpy(const size_t n,
                          const float alpha,
                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -367,8 +434,24 @@ clblasStatus clblasXaxpy(const size_t n,
                      y_buffer, y_offset, static_cast<int>(y_inc),
                      num_queues, queues, num_wait_events, wait_events, events);
 }
+clblasStatus clblasXaxpy(const size_t n,
+                         const half alpha,
+                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                         cl_uint num_queues, cl_command_queue *queues,
+                         cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer, queues[0]);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer, queues[0]);
+  auto status = clblasXaxpy(n,
+                            HalfToFloat(alpha),
+                            x_buffer_bis(), x_offset, x_inc,
+                            y_buffer_bis(), y_offset, y_inc,
+                            num_queues, queues, num_wait_events, wait_events, events);
+  FloatToHalfBuffer(y_buffer, y_buffer_bis, queues[0]);
+  return status;
+}
 
-// Forwards the clBLAS calls for SDOT/DDOT
+// Forwards the clBLAS calls for SDOT/DDOT/HDOT
 template <typename T>
 clblasStatus clblasXdot(const size_t n,
                         cl_mem dot_buffer, const size_t dot_offset,
@@ -410,6 +493,24 @@ clblasStatus clblasXdot<double>(const size_t n,
                     scratch_buffer(),
                     num_queues, queues, num_wait_events, wait_events, events);
 }
+template <>
+clblasStatus clblasXdot<half>(const size_t n,
+                              cl_mem dot_buffer, const size_t dot_offset,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                              cl_uint num_queues, cl_command_queue *queues,
+                              cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer, queues[0]);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer, queues[0]);
+  auto dot_buffer_bis = HalfToFloatBuffer(dot_buffer, queues[0]);
+  auto status = clblasXdot<float>(n,
+                                  dot_buffer_bis(), dot_offset,
+                                  x_buffer_bis(), x_offset, x_inc,
+                                  y_buffer_bis(), y_offset, y_inc,
+                                  num_queues, queues, num_wait_events, wait_events, events);
+  FloatToHalfBuffer(dot_buffer, dot_buffer_bis, queues[0]);
+  return status;
+}
 
 // Forwards the clBLAS calls for CDOTU/ZDOTU
 template <typename T>
@@ -705,7 +806,7 @@ clblasStatus clblasXamax<double2>(const size_t n,
 // BLAS level-2 (matrix-vector) routines
 // =================================================================================================
 
-// Forwards the clBLAS calls for SGEMV/DGEMV/CGEMV/ZGEMV
+// Forwards the clBLAS calls for SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
 clblasStatus clblasXgemv(const clblasOrder layout, const clblasTranspose a_transpose,
                          const size_t m, const size_t n,
                          const float alpha,
@@ -778,6 +879,29 @@ clblasStatus clblasXgemv(const clblasOrder layout, const clblasTranspose a_trans
                      y_buffer, y_offset, static_cast<int>(y_inc),
                      num_queues, queues, num_wait_events, wait_events, events);
 }
+clblasStatus clblasXgemv(const clblasOrder layout, const clblasTranspose a_transpose,
+                         const size_t m, const size_t n,
+                         const half alpha,
+                         const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                         const half beta,
+                         cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                         cl_uint num_queues, cl_command_queue *queues,
+                         cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto a_buffer_bis = HalfToFloatBuffer(a_buffer, queues[0]);
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer, queues[0]);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer, queues[0]);
+  auto status = clblasXgemv(layout, a_transpose,
+                            m, n,
+                            HalfToFloat(alpha),
+                            a_buffer_bis(), a_offset, a_ld,
+                            x_buffer_bis(), x_offset, x_inc,
+                            HalfToFloat(beta),
+                            y_buffer_bis(), y_offset, y_inc,
+                            num_queues, queues, num_wait_events, wait_events, events);
+  FloatToHalfBuffer(y_buffer, y_buffer_bis, queues[0]);
+  return status;
+}
 
 // Forwards the clBLAS calls for SGBMV/DGBMV/CGBMV/ZGBMV
 clblasStatus clblasXgbmv(const clblasOrder layout, const clblasTranspose a_transpose,
@@ -1495,7 +1619,7 @@ clblasStatus clblasXtpsv<double2>(const clblasOrder layout, const clblasUplo tri
                      num_queues, queues, num_wait_events, wait_events, events);
 }
 
-// Forwards the clBLAS calls for SGER/DGER
+// Forwards the clBLAS calls for SGER/DGER/HGER
 clblasStatus clblasXger(const clblasOrder layout,
                         const size_t m, const size_t n,
                         const float alpha,
@@ -1528,6 +1652,27 @@ clblasStatus clblasXger(const clblasOrder layout,
                     a_buffer, a_offset, a_ld,
                     num_queues, queues, num_wait_events, wait_events, events);
 }
+clblasStatus clblasXger(const clblasOrder layout,
+                        const size_t m, const size_t n,
+                        const half alpha,
+                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                        const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                        cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        cl_uint num_queues, cl_command_queue *queues,
+                        cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto x_buffer_bis = HalfToFloatBuffer(x_buffer, queues[0]);
+  auto y_buffer_bis = HalfToFloatBuffer(y_buffer, queues[0]);
+  auto a_buffer_bis = HalfToFloatBuffer(a_buffer, queues[0]);
+  auto status = clblasXger(layout,
+                           m, n,
+                           HalfToFloat(alpha),
+                           x_buffer_bis(), x_offset, x_inc,
+                           y_buffer_bis(), y_offset, y_inc,
+                           a_buffer_bis(), a_offset, a_ld,
+                           num_queues, queues, num_wait_events, wait_events, events);
+  FloatToHalfBuffer(a_buffer, a_buffer_bis, queues[0]);
+  return status;
+}
 
 // Forwards the clBLAS calls for CGERU/ZGERU
 clblasStatus clblasXgeru(const clblasOrder layout,
@@ -1857,7 +2002,7 @@ clblasStatus clblasXspr2(const clblasOrder layout, const clblasUplo triangle,
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// Forwards the clBLAS calls for SGEMM/DGEMM/CGEMM/ZGEMM
+// Forwards the clBLAS calls for SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
 clblasStatus clblasXgemm(const clblasOrder layout, const clblasTranspose a_transpose, const clblasTranspose b_transpose,
                          const size_t m, const size_t n, const size_t k,
                          const float alpha,
@@ -1930,6 +2075,29 @@ clblasStatus clblasXgemm(const clblasOrder layout, const clblasTranspose a_trans
                      c_buffer, c_offset, c_ld,
                      num_queues, queues, num_wait_events, wait_events, events);
 }
+clblasStatus clblasXgemm(const clblasOrder layout, const clblasTranspose a_transpose, const clblasTranspose b_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const half alpha,
+                         const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                         const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                         const half beta,
+                         cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                         cl_uint num_queues, cl_command_queue *queues,
+                         cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto a_buffer_bis = HalfToFloatBuffer(a_buffer, queues[0]);
+  auto b_buffer_bis = HalfToFloatBuffer(b_buffer, queues[0]);
+  auto c_buffer_bis = HalfToFloatBuffer(c_buffer, queues[0]);
+  auto status = clblasXgemm(layout, a_transpose, b_transpose,
+                            m, n, k,
+                            HalfToFloat(alpha),
+                            a_buffer_bis(), a_offset, a_ld,
+                            b_buffer_bis(), b_offset, b_ld,
+                            HalfToFloat(beta),
+                            c_buffer_bis(), c_offset, c_ld,
+                            num_queues, queues, num_wait_events, wait_events, events);
+  FloatToHalfBuffer(c_buffer, c_buffer_bis, queues[0]);
+  return status;
+}
 
 // Forwards the clBLAS calls for SSYMM/DSYMM/CSYMM/ZSYMM
 clblasStatus clblasXsymm(const clblasOrder layout, const clblasSide side, const clblasUplo triangle,